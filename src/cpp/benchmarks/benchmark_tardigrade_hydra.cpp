@@ -0,0 +1,525 @@
+/**
+  * \file benchmark_tardigrade_hydra.cpp
+  *
+  * Benchmarks for tardigrade-hydra
+  */
+
+#include<tardigrade_hydra.h>
+#include<tardigrade_hydraLinearElasticity.h>
+#include<tardigrade_hydraThermalExpansion.h>
+#include<tardigrade_hydraPeryznaViscoplasticity.h>
+#include<chrono>
+#include<iomanip>
+#include<iostream>
+#include<memory>
+#include<thread>
+
+typedef tardigradeHydra::floatType floatType; //!< Redefinition of the floating point type
+typedef tardigradeHydra::floatVector floatVector; //!< Redefinition of the vector of floating points type
+typedef tardigradeHydra::floatMatrix floatMatrix; //!< Redefinition of the matrix of floating points type
+
+void buildArrowheadJacobian( const unsigned int numConfigurations, const unsigned int numISVs,
+                             floatVector &jacobian, std::vector< unsigned int > &blockSizes, std::vector< bool > &blockSparsity ){
+    /*!
+     * Build a jacobian with the block structure of a multiplicative decomposition where the stress depends on
+     * all of the configurations and each of the remaining configurations depends on the stress, itself, and the
+     * state variables.
+     *
+     * \param numConfigurations: The number of configurations
+     * \param numISVs: The number of non-linear solve state variables
+     * \param &jacobian: The row-major jacobian
+     * \param &blockSizes: The sizes of the blocks of unknowns
+     * \param &blockSparsity: The row-major flags for the non-zero blocks of the jacobian
+     */
+
+    blockSizes = std::vector< unsigned int >( numConfigurations, 9 );
+
+    blockSizes.push_back( numISVs );
+
+    const unsigned int numBlocks = blockSizes.size( );
+
+    const unsigned int numUnknowns = 9 * numConfigurations + numISVs;
+
+    blockSparsity = std::vector< bool >( numBlocks * numBlocks, false );
+
+    for ( unsigned int b = 0; b < numBlocks; b++ ){
+
+        blockSparsity[ numBlocks * 0 + b ] = true;
+
+        blockSparsity[ numBlocks * b + 0 ] = true;
+
+        blockSparsity[ numBlocks * b + b ] = true;
+
+        blockSparsity[ numBlocks * b + numBlocks - 1 ] = true;
+
+        blockSparsity[ numBlocks * ( numBlocks - 1 ) + b ] = true;
+
+    }
+
+    jacobian = floatVector( numUnknowns * numUnknowns, 0 );
+
+    for ( unsigned int a = 0, rowOffset = 0; a < numBlocks; rowOffset += blockSizes[ a ], a++ ){
+
+        for ( unsigned int b = 0, colOffset = 0; b < numBlocks; colOffset += blockSizes[ b ], b++ ){
+
+            if ( !blockSparsity[ numBlocks * a + b ] ){
+
+                continue;
+
+            }
+
+            for ( unsigned int i = 0; i < blockSizes[ a ]; i++ ){
+
+                for ( unsigned int j = 0; j < blockSizes[ b ]; j++ ){
+
+                    jacobian[ numUnknowns * ( rowOffset + i ) + colOffset + j ] = 0.01 * ( ( 7 * ( rowOffset + i ) + 3 * ( colOffset + j ) ) % 11 );
+
+                }
+
+            }
+
+        }
+
+    }
+
+    for ( unsigned int i = 0; i < numUnknowns; i++ ){
+
+        jacobian[ numUnknowns * i + i ] += numUnknowns;
+
+    }
+
+}
+
+double timeFactorization( const floatVector &jacobian, const unsigned int numUnknowns,
+                          const std::vector< unsigned int > &blockSizes, const std::vector< bool > &blockSparsity,
+                          const unsigned int numRepetitions ){
+    /*!
+     * Time the factorization and solution of the jacobian for a right hand side with nine columns (i.e., the
+     * total derivatives with respect to the deformation gradient)
+     *
+     * \param &jacobian: The row-major jacobian
+     * \param numUnknowns: The number of unknowns
+     * \param &blockSizes: The sizes of the blocks of unknowns. If empty the dense factorization is used.
+     * \param &blockSparsity: The row-major flags for the non-zero blocks of the jacobian
+     * \param numRepetitions: The number of times to repeat the factorization
+     *
+     * Returns the mean time in microseconds
+     */
+
+    tardigradeHydra::floatRowMajorMatrix rhs = tardigradeHydra::floatRowMajorMatrix::Ones( numUnknowns, 9 );
+
+    tardigradeHydra::jacobianFactorization factorization;
+
+    floatType checksum = 0;
+
+    auto start = std::chrono::steady_clock::now( );
+
+    for ( unsigned int i = 0; i < numRepetitions; i++ ){
+
+        factorization.compute( jacobian, numUnknowns, { }, { }, blockSizes, blockSparsity );
+
+        checksum += factorization.solve( rhs ).sum( );
+
+    }
+
+    auto end = std::chrono::steady_clock::now( );
+
+    if ( !std::isfinite( checksum ) ){
+
+        std::cerr << "non-finite solution\n";
+
+    }
+
+    return std::chrono::duration< double, std::micro >( end - start ).count( ) / numRepetitions;
+
+}
+
+class elasticityWithPreviousStress : public tardigradeHydra::linearElasticity::residual{
+    /*!
+     * An elastic residual which provides the previous Cauchy stress required by the viscoplastic residual. The
+     * previous points of the batch are stress free.
+     */
+
+    public:
+
+        using tardigradeHydra::linearElasticity::residual::residual;
+
+        floatVector previousCauchyStress = floatVector( 9, 0 ); //!< The previous Cauchy stress
+
+    private:
+
+        virtual void setPreviousCauchyStress( ) override{
+
+            tardigradeHydra::residualBase::setPreviousCauchyStress( previousCauchyStress );
+
+        }
+
+};
+
+class thermoElastoViscoplasticHydra : public tardigradeHydra::hydraBase{
+    /*!
+     * A thermo-elasto-viscoplastic hydra model used to benchmark the batch evaluation
+     */
+
+    public:
+
+        using tardigradeHydra::hydraBase::hydraBase;
+
+        floatVector elasticityParameters = { 123.4, 56.7 }; //!< The Lame parameters
+
+        floatVector viscoPlasticParameters = { 10.0, 1e1, 1e2, 10, 200, 293.15, 5, 0.34, 0.12, 13., 14. }; //!< The viscoplastic parameters
+
+        std::vector< unsigned int > stateVariableIndices = { 0 }; //!< The indices of the plastic state variables
+
+        floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 7e-5, 8e-5, 9e-5, 10e-5, 11e-5, 12e-5 }; //!< The thermal expansion parameters
+
+        elasticityWithPreviousStress elasticity; //!< The elastic residual
+
+        tardigradeHydra::peryznaViscoplasticity::residual viscoPlasticity; //!< The viscoplastic residual
+
+        tardigradeHydra::thermalExpansion::residual thermalExpansion; //!< The thermal expansion residual
+
+    private:
+
+        using tardigradeHydra::hydraBase::setResidualClasses;
+
+        virtual void setResidualClasses( ){
+
+            std::vector< tardigradeHydra::residualBase* > residuals( 3 );
+
+            elasticity = elasticityWithPreviousStress( this, 9, elasticityParameters );
+
+            viscoPlasticity = tardigradeHydra::peryznaViscoplasticity::residual( this, 10, 1, stateVariableIndices, viscoPlasticParameters );
+
+            thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 2, thermalParameters );
+
+            residuals[ 0 ] = &elasticity;
+
+            residuals[ 1 ] = &viscoPlasticity;
+
+            residuals[ 2 ] = &thermalExpansion;
+
+            setResidualClasses( residuals );
+
+        }
+
+};
+
+//! The number of state variables of the batch model i.e., the plastic and thermal configurations and the plastic state variable
+const unsigned int numStateVariables = 19;
+
+double timeBatch( const unsigned int numThreads, const tardigradeHydra::materialPointBuffers &buffers, const unsigned int numRepetitions ){
+    /*!
+     * Time the parallel evaluation of a batch of material points
+     *
+     * \param numThreads: The number of threads
+     * \param &buffers: The buffers of the points
+     * \param numRepetitions: The number of times to repeat the evaluation
+     *
+     * Returns the mean time in milliseconds
+     */
+
+    floatVector eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    std::vector< std::unique_ptr< thermoElastoViscoplasticHydra > > hydras;
+
+    std::vector< tardigradeHydra::hydraBase* > hydraPointers;
+
+    for ( unsigned int t = 0; t < numThreads; t++ ){
+
+        hydras.push_back( std::unique_ptr< thermoElastoViscoplasticHydra >( new thermoElastoViscoplasticHydra( 0., 0.1, 293.15, 293.15, eye, eye, floatVector( numStateVariables, 0 ), { },
+                                                                                                             3, 1, 3, 1e-9, 1e-9 ) ) );
+
+        hydraPointers.push_back( hydras.back( ).get( ) );
+
+    }
+
+    tardigradeHydra::parallelMaterialPointBatch batch( hydraPointers );
+
+    auto start = std::chrono::steady_clock::now( );
+
+    for ( unsigned int i = 0; i < numRepetitions; i++ ){
+
+        batch.evaluate( buffers );
+
+    }
+
+    auto end = std::chrono::steady_clock::now( );
+
+    return std::chrono::duration< double, std::milli >( end - start ).count( ) / numRepetitions;
+
+}
+
+void benchmarkBatchScaling( ){
+    /*!
+     * Report the scaling of the parallel batch evaluation of a thermo-elasto-viscoplastic model from one thread to
+     * all of the hardware threads
+     */
+
+    const unsigned int numPoints = 4096;
+
+    const unsigned int numRepetitions = 5;
+
+    floatVector eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector temperature( numPoints ), previousTemperature( numPoints, 293.15 );
+
+    floatVector F( 9 * numPoints ), Fn( 9 * numPoints ), ISVs( numStateVariables * numPoints, 0 );
+
+    // Vary the loading so that the cost of the points is not uniform
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        temperature[ p ] = 293.15 + 5. * ( p % 17 ) / 16.;
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            F[ numPoints * i + p ] = eye[ i ] + 0.01 * ( ( 3 * p + 5 * i ) % 13 ) / 12.;
+
+            Fn[ numPoints * i + p ] = eye[ i ];
+
+        }
+
+    }
+
+    floatVector cauchyStress( 9 * numPoints ), stateVariables( numStateVariables * numPoints ), dCauchyStressdF( 81 * numPoints );
+
+    tardigradeHydra::materialPointBuffers buffers = { numPoints, 1., 0.1, temperature.data( ), previousTemperature.data( ),
+                                                      F.data( ), Fn.data( ), ISVs.data( ),
+                                                      cauchyStress.data( ), stateVariables.data( ), dCauchyStressdF.data( ), NULL };
+
+    const unsigned int maxThreads = std::max( std::thread::hardware_concurrency( ), 1u );
+
+    std::cout << "\n" << std::setw( 16 ) << "threads" << std::setw( 12 ) << "points"
+              << std::setw( 14 ) << "time (ms)" << std::setw( 10 ) << "speedup" << "\n";
+
+    double serial = 0;
+
+    for ( unsigned int numThreads = 1; numThreads <= maxThreads; numThreads++ ){
+
+        double time = timeBatch( numThreads, buffers, numRepetitions );
+
+        if ( numThreads == 1 ){
+
+            serial = time;
+
+        }
+
+        std::cout << std::setw( 16 ) << numThreads << std::setw( 12 ) << numPoints
+                  << std::setw( 14 ) << std::fixed << std::setprecision( 2 ) << time
+                  << std::setw( 10 ) << serial / time << "\n";
+
+    }
+
+}
+
+void denseFirstConfigurationGradients( const floatVector &deformationGradient, const floatVector &Fsc, const floatMatrix &dFscdFs,
+                                       const unsigned int numConfigurations, floatMatrix &dF1dF, floatMatrix &dF1dFn ){
+    /*!
+     * The original computation of the gradients of the first configuration which contracts the dense gradient of the
+     * sub-configuration. Kept as the reference for the benchmark.
+     *
+     * \param &deformationGradient: The deformation gradient
+     * \param &Fsc: The sub-configuration following the first configuration
+     * \param &dFscdFs: The dense gradient of the sub-configuration w.r.t. all of the configurations
+     * \param numConfigurations: The number of configurations
+     * \param &dF1dF: The gradient of the first configuration w.r.t. the deformation gradient
+     * \param &dF1dFn: The gradient of the first configuration w.r.t. the remaining configurations
+     */
+
+    const unsigned int dim = 3;
+
+    dF1dF = floatMatrix( dim * dim, floatVector( dim * dim, 0 ) );
+
+    dF1dFn = floatMatrix( dim * dim, floatVector( dim * dim * ( numConfigurations - 1 ), 0 ) );
+
+    floatVector eye( dim * dim );
+    tardigradeVectorTools::eye( eye );
+
+    floatVector invFsc = tardigradeVectorTools::inverse( Fsc, dim, dim );
+
+    floatMatrix dInvFscdFsc = tardigradeVectorTools::computeDInvADA( invFsc, dim, dim );
+
+    floatMatrix dInvFscdFs = tardigradeVectorTools::dot( dInvFscdFsc, dFscdFs );
+
+    for ( unsigned int i = 0; i < dim; i++ ){
+
+        for ( unsigned int barI = 0; barI < dim; barI++ ){
+
+            for ( unsigned int a = 0; a < dim; a++ ){
+
+                for ( unsigned int A = 0; A < dim; A++ ){
+
+                    dF1dF[ dim * i + barI ][ dim * a + A ] += eye[ dim * i + a ] * invFsc[ dim * A + barI ];
+
+                    for ( unsigned int index = 0; index < numConfigurations - 1; index++ ){
+
+                        for ( unsigned int J = 0; J < dim; J++ ){
+
+                            dF1dFn[ dim * i + barI ][ dim * dim * index + dim * a + A ]
+                                += deformationGradient[ dim * i + J ] * dInvFscdFs[ dim * J + barI ][ dim * dim * ( index + 1 ) + dim * a + A ];
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+}
+
+void benchmarkFirstConfigurationGradients( ){
+    /*!
+     * Report the per-call cost of the gradients of the first configuration for the original dense contraction, the
+     * factored form, and the fixed-size kernel
+     */
+
+    const unsigned int numRepetitions = 20000;
+
+    std::cout << "\n" << std::setw( 16 ) << "configurations" << std::setw( 14 ) << "dense (us)"
+              << std::setw( 14 ) << "factored (us)" << std::setw( 14 ) << "fixed (us)" << "\n";
+
+    for ( unsigned int numConfigurations = 2; numConfigurations <= 5; numConfigurations++ ){
+
+        floatMatrix configurations( numConfigurations, floatVector( 9, 0 ) );
+
+        for ( unsigned int c = 0; c < numConfigurations; c++ ){
+
+            for ( unsigned int i = 0; i < 9; i++ ){
+
+                configurations[ c ][ i ] = ( i % 4 == 0 ? 1 : 0 ) + 0.01 * ( ( 3 * c + 5 * i ) % 7 );
+
+            }
+
+        }
+
+        // The products of the configurations between every pair of indices
+        const unsigned int stride = numConfigurations + 1;
+
+        floatMatrix subConfigurations( stride * stride, floatVector( 9, 0 ) );
+
+        for ( unsigned int lower = 0; lower <= numConfigurations; lower++ ){
+
+            tardigradeVectorTools::eye( subConfigurations[ stride * lower + lower ] );
+
+            for ( unsigned int upper = lower + 1; upper <= numConfigurations; upper++ ){
+
+                subConfigurations[ stride * lower + upper ] = tardigradeVectorTools::matrixMultiply( subConfigurations[ stride * lower + upper - 1 ], configurations[ upper - 1 ], 3, 3, 3, 3 );
+
+            }
+
+        }
+
+        const floatVector &deformationGradient = subConfigurations[ numConfigurations ];
+
+        tardigradeHydra::subConfigurationGradient dFscdFs( &subConfigurations, 3, numConfigurations, 1, numConfigurations );
+
+        floatMatrix denseGradient = dFscdFs.toDense( );
+
+        floatMatrix dF1dF, dF1dFn;
+
+        floatVector flatdF1dF( 81 ), flatdF1dFn( 81 * ( numConfigurations - 1 ) );
+
+        floatType checksum = 0;
+
+        auto start = std::chrono::steady_clock::now( );
+
+        for ( unsigned int r = 0; r < numRepetitions; r++ ){
+
+            denseFirstConfigurationGradients( deformationGradient, subConfigurations[ stride + numConfigurations ], denseGradient, numConfigurations, dF1dF, dF1dFn );
+
+            checksum += dF1dFn[ 0 ][ 0 ];
+
+        }
+
+        auto end = std::chrono::steady_clock::now( );
+
+        double dense = std::chrono::duration< double, std::micro >( end - start ).count( ) / numRepetitions;
+
+        start = std::chrono::steady_clock::now( );
+
+        for ( unsigned int r = 0; r < numRepetitions; r++ ){
+
+            tardigradeHydra::computeFirstConfigurationGradients( deformationGradient, dFscdFs, dF1dF, dF1dFn );
+
+            checksum += dF1dFn[ 0 ][ 0 ];
+
+        }
+
+        end = std::chrono::steady_clock::now( );
+
+        double factored = std::chrono::duration< double, std::micro >( end - start ).count( ) / numRepetitions;
+
+        start = std::chrono::steady_clock::now( );
+
+        for ( unsigned int r = 0; r < numRepetitions; r++ ){
+
+            tardigradeHydra::computeFixedSizeFirstConfigurationGradients< 3 >( deformationGradient.data( ), dFscdFs, flatdF1dF.data( ), flatdF1dFn.data( ) );
+
+            checksum += flatdF1dFn[ 0 ];
+
+        }
+
+        end = std::chrono::steady_clock::now( );
+
+        double fixed = std::chrono::duration< double, std::micro >( end - start ).count( ) / numRepetitions;
+
+        if ( !std::isfinite( checksum ) ){
+
+            std::cerr << "non-finite gradient\n";
+
+        }
+
+        std::cout << std::setw( 16 ) << numConfigurations << std::setw( 14 ) << std::fixed << std::setprecision( 3 ) << dense
+                  << std::setw( 14 ) << factored << std::setw( 14 ) << fixed << "\n";
+
+    }
+
+}
+
+int main( ){
+    /*!
+     * Compare the dense and block elimination factorizations of the jacobian as the number of configurations grows,
+     * report the cost of the gradients of the first configuration, and the scaling of the parallel batch evaluation
+     */
+
+    const unsigned int numISVs = 10;
+
+    const unsigned int numRepetitions = 200;
+
+    std::cout << std::setw( 16 ) << "configurations" << std::setw( 12 ) << "unknowns"
+              << std::setw( 14 ) << "dense (us)" << std::setw( 14 ) << "block (us)" << std::setw( 10 ) << "speedup" << "\n";
+
+    for ( unsigned int numConfigurations = 2; numConfigurations <= 12; numConfigurations += 2 ){
+
+        floatVector jacobian;
+
+        std::vector< unsigned int > blockSizes;
+
+        std::vector< bool > blockSparsity;
+
+        buildArrowheadJacobian( numConfigurations, numISVs, jacobian, blockSizes, blockSparsity );
+
+        const unsigned int numUnknowns = 9 * numConfigurations + numISVs;
+
+        double dense = timeFactorization( jacobian, numUnknowns, { }, { }, numRepetitions );
+
+        double block = timeFactorization( jacobian, numUnknowns, blockSizes, blockSparsity, numRepetitions );
+
+        std::cout << std::setw( 16 ) << numConfigurations << std::setw( 12 ) << numUnknowns
+                  << std::setw( 14 ) << std::fixed << std::setprecision( 2 ) << dense
+                  << std::setw( 14 ) << block << std::setw( 10 ) << dense / block << "\n";
+
+    }
+
+    benchmarkFirstConfigurationGradients( );
+
+    benchmarkBatchScaling( );
+
+    return 0;
+
+}
@@ -0,0 +1,537 @@
+/**
+  * \file benchmark_tardigrade_hydraResiduals.cpp
+  *
+  * Benchmarks of the residual classes and the full solve of tardigrade-hydra
+  *
+  * Each fixture mirrors one of the hydraBase compositions used in the tests. The cost per call, the number of
+  * allocations per call, and the number of Newton iterations are written as JSON so that the results of two
+  * releases may be compared with a diff.
+  */
+
+#include<tardigrade_hydra.h>
+#include<tardigrade_hydraLinearElasticity.h>
+#include<tardigrade_hydraLinearViscoelasticity.h>
+#include<tardigrade_hydraPeryznaViscoplasticity.h>
+#include<tardigrade_hydraThermalExpansion.h>
+#include<chrono>
+#include<cstdlib>
+#include<fstream>
+#include<functional>
+#include<iomanip>
+#include<iostream>
+#include<memory>
+#include<new>
+
+typedef tardigradeHydra::floatType floatType; //!< Redefinition of the floating point type
+typedef tardigradeHydra::floatVector floatVector; //!< Redefinition of the vector of floating points type
+
+#ifdef __GLIBC__
+
+// Count every allocation from the heap (see tardigradeHydra::solveStatistics::countAllocation). Eigen allocates with
+// malloc rather than operator new so malloc, calloc, and realloc are replaced and forward to the allocator of glibc.
+extern "C" void *__libc_malloc( std::size_t size ) noexcept;
+
+extern "C" void *__libc_calloc( std::size_t num, std::size_t size ) noexcept;
+
+extern "C" void *__libc_realloc( void *ptr, std::size_t size ) noexcept;
+
+extern "C" void *malloc( std::size_t size ) noexcept{
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    return __libc_malloc( size );
+
+}
+
+extern "C" void *calloc( std::size_t num, std::size_t size ) noexcept{
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    return __libc_calloc( num, size );
+
+}
+
+extern "C" void *realloc( void *ptr, std::size_t size ) noexcept{
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    return __libc_realloc( ptr, size );
+
+}
+
+#else
+
+// Count the allocations made through the global operator new (see tardigradeHydra::solveStatistics::countAllocation).
+// The allocations Eigen makes with malloc are not counted.
+void* operator new( std::size_t size ){
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    if ( void *ptr = std::malloc( size > 0 ? size : 1 ) ){
+
+        return ptr;
+
+    }
+
+    throw std::bad_alloc( );
+
+}
+
+void* operator new[]( std::size_t size ){
+
+    return operator new( size );
+
+}
+
+void operator delete( void *ptr ) noexcept{
+
+    std::free( ptr );
+
+}
+
+void operator delete[]( void *ptr ) noexcept{
+
+    std::free( ptr );
+
+}
+
+void operator delete( void *ptr, std::size_t ) noexcept{
+
+    std::free( ptr );
+
+}
+
+void operator delete[]( void *ptr, std::size_t ) noexcept{
+
+    std::free( ptr );
+
+}
+
+#endif
+
+class elasticHydra : public tardigradeHydra::hydraBase{
+    /*!
+     * An elastic hydra model
+     */
+
+    public:
+
+        using tardigradeHydra::hydraBase::hydraBase;
+
+        floatVector elasticityParameters = { 123.4, 56.7 }; //!< The Lame parameters
+
+        tardigradeHydra::linearElasticity::residual elasticity; //!< The elastic residual
+
+    private:
+
+        using tardigradeHydra::hydraBase::setResidualClasses;
+
+        virtual void setResidualClasses( ){
+
+            std::vector< tardigradeHydra::residualBase* > residuals( 1 );
+
+            elasticity = tardigradeHydra::linearElasticity::residual( this, 9, elasticityParameters );
+
+            residuals[ 0 ] = &elasticity;
+
+            setResidualClasses( residuals );
+
+        }
+
+};
+
+class thermoElasticHydra : public tardigradeHydra::hydraBase{
+    /*!
+     * A thermo-elastic hydra model
+     */
+
+    public:
+
+        using tardigradeHydra::hydraBase::hydraBase;
+
+        floatVector elasticityParameters = { 123.4, 56.7 }; //!< The Lame parameters
+
+        floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 1e-8, 2e-8, 3e-8, 4e-8, 5e-8, 6e-8 }; //!< The thermal expansion parameters
+
+        tardigradeHydra::linearElasticity::residual elasticity; //!< The elastic residual
+
+        tardigradeHydra::thermalExpansion::residual thermalExpansion; //!< The thermal expansion residual
+
+    private:
+
+        using tardigradeHydra::hydraBase::setResidualClasses;
+
+        virtual void setResidualClasses( ){
+
+            std::vector< tardigradeHydra::residualBase* > residuals( 2 );
+
+            elasticity = tardigradeHydra::linearElasticity::residual( this, 9, elasticityParameters );
+
+            thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 1, thermalParameters );
+
+            residuals[ 0 ] = &elasticity;
+
+            residuals[ 1 ] = &thermalExpansion;
+
+            setResidualClasses( residuals );
+
+        }
+
+};
+
+class thermoViscoelasticHydra : public tardigradeHydra::hydraBase{
+    /*!
+     * A thermo-viscoelastic hydra model
+     */
+
+    public:
+
+        using tardigradeHydra::hydraBase::hydraBase;
+
+        floatVector viscoelasticParameters = { 2, 3, 123.4, 56.7, 10.0, 5.0, 293.15, 2, 3, 293.15, 23.4, 25.6, 0.1, 0.2, 12.3, 13.4, 14.5, 0.1, 1.0, 10.0 }; //!< The viscoelastic parameters
+
+        floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 1e-8, 2e-8, 3e-8, 4e-8, 5e-8, 6e-8 }; //!< The thermal expansion parameters
+
+        unsigned int viscoelasticISVLowerIndex = 2; //!< The lower index of the viscoelastic state variables
+
+        unsigned int viscoelasticISVUpperIndex = 31; //!< The upper index of the viscoelastic state variables
+
+        std::unique_ptr< tardigradeHydra::linearViscoelasticity::residual > viscoelasticity; //!< The viscoelastic residual which has no default constructor
+
+        tardigradeHydra::thermalExpansion::residual thermalExpansion; //!< The thermal expansion residual
+
+    private:
+
+        using tardigradeHydra::hydraBase::setResidualClasses;
+
+        virtual void setResidualClasses( ){
+
+            std::vector< tardigradeHydra::residualBase* > residuals( 2 );
+
+            viscoelasticity.reset( new tardigradeHydra::linearViscoelasticity::residual( this, 9, viscoelasticParameters,
+                                                                                         viscoelasticISVLowerIndex, viscoelasticISVUpperIndex, 0.5 ) );
+
+            thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 1, thermalParameters );
+
+            residuals[ 0 ] = viscoelasticity.get( );
+
+            residuals[ 1 ] = &thermalExpansion;
+
+            setResidualClasses( residuals );
+
+        }
+
+};
+
+class elasticityWithPreviousStress : public tardigradeHydra::linearElasticity::residual{
+    /*!
+     * An elastic residual which provides the previous Cauchy stress required by the viscoplastic residual. The
+     * previous point of the fixture is stress free.
+     */
+
+    public:
+
+        using tardigradeHydra::linearElasticity::residual::residual;
+
+        floatVector previousCauchyStress = floatVector( 9, 0 ); //!< The previous Cauchy stress
+
+    private:
+
+        virtual void setPreviousCauchyStress( ) override{
+
+            tardigradeHydra::residualBase::setPreviousCauchyStress( previousCauchyStress );
+
+        }
+
+};
+
+class thermoElastoViscoplasticHydra : public tardigradeHydra::hydraBase{
+    /*!
+     * A thermo-elasto-viscoplastic hydra model
+     */
+
+    public:
+
+        using tardigradeHydra::hydraBase::hydraBase;
+
+        floatVector elasticityParameters = { 123.4, 56.7 }; //!< The Lame parameters
+
+        floatVector viscoPlasticParameters = { 10.0, 1e1, 1e2, 10, 200, 293.15, 5, 0.34, 0.12, 13., 14. }; //!< The viscoplastic parameters
+
+        std::vector< unsigned int > stateVariableIndices = { 0 }; //!< The indices of the plastic state variables
+
+        floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 7e-5, 8e-5, 9e-5, 10e-5, 11e-5, 12e-5 }; //!< The thermal expansion parameters
+
+        elasticityWithPreviousStress elasticity; //!< The elastic residual
+
+        tardigradeHydra::peryznaViscoplasticity::residual viscoPlasticity; //!< The viscoplastic residual
+
+        tardigradeHydra::thermalExpansion::residual thermalExpansion; //!< The thermal expansion residual
+
+    private:
+
+        using tardigradeHydra::hydraBase::setResidualClasses;
+
+        virtual void setResidualClasses( ){
+
+            std::vector< tardigradeHydra::residualBase* > residuals( 3 );
+
+            elasticity = elasticityWithPreviousStress( this, 9, elasticityParameters );
+
+            viscoPlasticity = tardigradeHydra::peryznaViscoplasticity::residual( this, 10, 1, stateVariableIndices, viscoPlasticParameters );
+
+            thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 2, thermalParameters );
+
+            residuals[ 0 ] = &elasticity;
+
+            residuals[ 1 ] = &viscoPlasticity;
+
+            residuals[ 2 ] = &thermalExpansion;
+
+            setResidualClasses( residuals );
+
+        }
+
+};
+
+/*!
+ * The material point at which a fixture is evaluated
+ */
+struct fixturePoint{
+
+    floatType time; //!< The current time
+
+    floatType deltaTime; //!< The change in time
+
+    floatType temperature; //!< The current temperature
+
+    floatType previousTemperature; //!< The previous temperature
+
+    floatVector deformationGradient; //!< The current deformation gradient
+
+    floatVector previousDeformationGradient; //!< The previous deformation gradient
+
+    floatVector previousStateVariables; //!< The previous state variables
+
+};
+
+/*!
+ * The cost of a call
+ */
+struct callCost{
+
+    double nanoseconds = 0; //!< The total time of the calls in nanoseconds
+
+    unsigned long long allocations = 0; //!< The total number of allocations of the calls
+
+};
+
+void timeCall( const std::function< void( ) > &call, callCost &cost ){
+    /*!
+     * Time a call and count its allocations
+     *
+     * \param &call: The call
+     * \param &cost: The cost which is incremented by the cost of the call
+     */
+
+    const unsigned long long initialAllocations = tardigradeHydra::solveStatistics::getAllocationCount( );
+
+    auto start = std::chrono::steady_clock::now( );
+
+    call( );
+
+    auto end = std::chrono::steady_clock::now( );
+
+    cost.nanoseconds += std::chrono::duration< double, std::nano >( end - start ).count( );
+
+    cost.allocations += tardigradeHydra::solveStatistics::getAllocationCount( ) - initialAllocations;
+
+}
+
+void writeCost( const callCost &cost, const unsigned int numRepetitions, std::ostream &json ){
+    /*!
+     * Write the mean cost of a call as a JSON object
+     *
+     * \param &cost: The total cost of the calls
+     * \param numRepetitions: The number of calls
+     * \param &json: The output stream
+     */
+
+    json << "{ \"ns_per_call\": " << std::fixed << std::setprecision( 1 ) << cost.nanoseconds / numRepetitions
+         << ", \"allocations_per_call\": " << std::setprecision( 2 ) << ( double )cost.allocations / numRepetitions << " }";
+
+}
+
+void benchmarkFixture( const std::string &name, tardigradeHydra::hydraBase &hydra, const fixturePoint &point,
+                       const std::vector< std::string > &residualNames, const unsigned int numRepetitions, std::ostream &json ){
+    /*!
+     * Benchmark the full solve, the consistent tangent, and each stage of each residual class of a fixture.
+     *
+     * The residual classes are evaluated at the initial iterate of the point. Because the residual classes cache
+     * their intermediate quantities, the shared quantities are attributed to the first stage which requests them.
+     *
+     * \param &name: The name of the fixture
+     * \param &hydra: The hydra object of the fixture
+     * \param &point: The material point
+     * \param &residualNames: The names of the residual classes
+     * \param numRepetitions: The number of times to repeat each call
+     * \param &json: The output stream
+     */
+
+    auto setPoint = [ & ]( ){
+
+        hydra.setMaterialPoint( point.time, point.deltaTime, point.temperature, point.previousTemperature,
+                                point.deformationGradient.data( ), point.previousDeformationGradient.data( ),
+                                point.previousStateVariables.data( ) );
+
+    };
+
+    callCost solve, tangent;
+
+    unsigned int iterations = 0;
+
+    for ( unsigned int r = 0; r < numRepetitions; r++ ){
+
+        setPoint( );
+
+        timeCall( [ & ]( ){ hydra.evaluate( ); }, solve );
+
+        timeCall( [ & ]( ){ hydra.getdCauchyStressdF( ); }, tangent );
+
+        iterations = *hydra.getNumIterations( );
+
+    }
+
+    std::vector< tardigradeHydra::residualBase* > residuals = *hydra.getResidualClasses( );
+
+    std::vector< std::vector< callCost > > stages( residuals.size( ), std::vector< callCost >( tardigradeHydra::residualStage::numStages ) );
+
+    for ( unsigned int i = 0; i < residuals.size( ); i++ ){
+
+        tardigradeHydra::residualBase *residual = residuals[ i ];
+
+        for ( unsigned int r = 0; r < numRepetitions; r++ ){
+
+            setPoint( );
+
+            timeCall( [ & ]( ){ residual->getResidual( ); }, stages[ i ][ tardigradeHydra::residualStage::residual ] );
+
+            timeCall( [ & ]( ){ residual->getJacobian( ); }, stages[ i ][ tardigradeHydra::residualStage::jacobian ] );
+
+            timeCall( [ & ]( ){ residual->getdRdF( ); residual->getdRdT( ); }, stages[ i ][ tardigradeHydra::residualStage::derivatives ] );
+
+        }
+
+    }
+
+    json << "    {\n";
+    json << "      \"name\": \"" << name << "\",\n";
+    json << "      \"configurations\": " << *hydra.getNumConfigurations( ) << ",\n";
+    json << "      \"unknowns\": " << hydra.getUnknownVector( )->size( ) << ",\n";
+    json << "      \"repetitions\": " << numRepetitions << ",\n";
+    json << "      \"iterations\": " << iterations << ",\n";
+    json << "      \"solve\": "; writeCost( solve, numRepetitions, json ); json << ",\n";
+    json << "      \"tangent\": "; writeCost( tangent, numRepetitions, json ); json << ",\n";
+    json << "      \"residuals\": [\n";
+
+    for ( unsigned int i = 0; i < residuals.size( ); i++ ){
+
+        json << "        { \"name\": \"" << residualNames[ i ] << "\",\n";
+        json << "          \"residual\": "; writeCost( stages[ i ][ tardigradeHydra::residualStage::residual ], numRepetitions, json ); json << ",\n";
+        json << "          \"jacobian\": "; writeCost( stages[ i ][ tardigradeHydra::residualStage::jacobian ], numRepetitions, json ); json << ",\n";
+        json << "          \"derivatives\": "; writeCost( stages[ i ][ tardigradeHydra::residualStage::derivatives ], numRepetitions, json );
+        json << " }" << ( i + 1 < residuals.size( ) ? "," : "" ) << "\n";
+
+    }
+
+    json << "      ]\n";
+    json << "    }";
+
+}
+
+int main( int argc, char **argv ){
+    /*!
+     * Benchmark each of the fixtures and write the results as JSON to the file named by the first argument or to
+     * the standard output if no file is given
+     */
+
+    const unsigned int numRepetitions = 200;
+
+    floatVector eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector deformationGradient = { 1.01, 0.01, 0.00,
+                                        0.00, 1.00, 0.00,
+                                        0.00, 0.00, 1.00 };
+
+    fixturePoint elasticPoint = { 1.1, 2.2, 300.0, 293.15, deformationGradient, eye, { } };
+
+    fixturePoint thermoElasticPoint = { 1.1, 2.2, 300.0, 293.15, deformationGradient, eye, floatVector( 9, 0 ) };
+
+    // The configuration of the thermal expansion followed by the viscoelastic state variables
+    floatVector viscoelasticStateVariables = { -1, 0, 1e-3, 1e-1 };
+    viscoelasticStateVariables.resize( 31, 0 );
+
+    floatVector thermoViscoelasticStateVariables( 9, 0 );
+    thermoViscoelasticStateVariables.insert( thermoViscoelasticStateVariables.end( ), viscoelasticStateVariables.begin( ), viscoelasticStateVariables.end( ) );
+
+    fixturePoint thermoViscoelasticPoint = { 1.1, 2.2, 300.0, 293.15, deformationGradient, eye, thermoViscoelasticStateVariables };
+
+    // The plastic and thermal configurations followed by the plastic state variable. The increment is small enough
+    // that the viscoplastic solve converges without sub-stepping.
+    fixturePoint thermoElastoViscoplasticPoint = { 1.1, 0.1, 293.5, 293.15, { 1.05, 0.05, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 }, eye, floatVector( 19, 0 ) };
+
+    elasticHydra elastic( elasticPoint.time, elasticPoint.deltaTime, elasticPoint.temperature, elasticPoint.previousTemperature,
+                          elasticPoint.deformationGradient, elasticPoint.previousDeformationGradient,
+                          elasticPoint.previousStateVariables, { }, 1, 0 );
+
+    thermoElasticHydra thermoElastic( thermoElasticPoint.time, thermoElasticPoint.deltaTime, thermoElasticPoint.temperature, thermoElasticPoint.previousTemperature,
+                                      thermoElasticPoint.deformationGradient, thermoElasticPoint.previousDeformationGradient,
+                                      thermoElasticPoint.previousStateVariables, { }, 2, 0 );
+
+    thermoViscoelasticHydra thermoViscoelastic( thermoViscoelasticPoint.time, thermoViscoelasticPoint.deltaTime, thermoViscoelasticPoint.temperature, thermoViscoelasticPoint.previousTemperature,
+                                                thermoViscoelasticPoint.deformationGradient, thermoViscoelasticPoint.previousDeformationGradient,
+                                                thermoViscoelasticPoint.previousStateVariables, { }, 2, 0 );
+
+    thermoElastoViscoplasticHydra thermoElastoViscoplastic( thermoElastoViscoplasticPoint.time, thermoElastoViscoplasticPoint.deltaTime, thermoElastoViscoplasticPoint.temperature, thermoElastoViscoplasticPoint.previousTemperature,
+                                                            thermoElastoViscoplasticPoint.deformationGradient, thermoElastoViscoplasticPoint.previousDeformationGradient,
+                                                            thermoElastoViscoplasticPoint.previousStateVariables, { }, 3, 1 );
+
+    std::ofstream file;
+
+    if ( argc > 1 ){
+
+        file.open( argv[ 1 ] );
+
+        if ( !file.good( ) ){
+
+            std::cerr << "unable to open " << argv[ 1 ] << "\n";
+
+            return 1;
+
+        }
+
+    }
+
+    std::ostream &json = ( argc > 1 ) ? file : std::cout;
+
+    json << "{\n";
+    json << "  \"fixtures\": [\n";
+
+    benchmarkFixture( "elastic", elastic, elasticPoint, { "linearElasticity" }, numRepetitions, json );
+    json << ",\n";
+
+    benchmarkFixture( "thermoElastic", thermoElastic, thermoElasticPoint, { "linearElasticity", "thermalExpansion" }, numRepetitions, json );
+    json << ",\n";
+
+    benchmarkFixture( "thermoViscoelastic", thermoViscoelastic, thermoViscoelasticPoint, { "linearViscoelasticity", "thermalExpansion" }, numRepetitions, json );
+    json << ",\n";
+
+    benchmarkFixture( "thermoElastoViscoplastic", thermoElastoViscoplastic, thermoElastoViscoplasticPoint, { "linearElasticity", "peryznaViscoplasticity", "thermalExpansion" }, numRepetitions, json );
+    json << "\n";
+
+    json << "  ]\n";
+    json << "}\n";
+
+    return 0;
+
+}
@@ -39,7 +39,39 @@ namespace tardigradeHydra{
 
     void residualBase::setJacobian( const floatMatrix &jacobian ){
         /*!
-         * Set the value of the jacobian
+         * Set the value of the jacobian from a matrix. The values are stored in row-major form
+         * and the matrix is retained so that it doesn't need to be re-formed if requested.
+         * 
+         * \param &jacobian: The jacobian matrix
+         */
+
+        for ( auto row = jacobian.begin( ); row != jacobian.end( ); row++ ){
+
+            if ( row->size( ) != jacobian.begin( )->size( ) ){
+
+                std::string message = "Row " + std::to_string( row - jacobian.begin( ) ) + " of jacobian is not the same length as the first row\n";
+                message            += "  expected: " + std::to_string( jacobian.begin( )->size( ) ) + "\n";
+                message            += "  actual:   " + std::to_string( row->size( ) ) + "\n";
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
+
+        }
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( setFlatJacobian( tardigradeVectorTools::appendVectors( jacobian ) ) );
+
+        _jacobianMatrix.second = jacobian;
+
+        _jacobianMatrix.first = true;
+
+        addIterationData( &_jacobianMatrix );
+
+    }
+
+    void residualBase::setFlatJacobian( const floatVector &jacobian ){
+        /*!
+         * Set the value of the jacobian in row-major form
          * 
          * \param &jacobian: The jacobian matrix
          */
@@ -48,13 +80,47 @@ namespace tardigradeHydra{
 
         _jacobian.first = true;
 
+        _jacobianMatrix.first = false;
+
         addIterationData( &_jacobian );
 
     }
 
     void residualBase::setdRdF( const floatMatrix &dRdF ){
         /*!
-         * Set the value of dRdF
+         * Set the value of dRdF from a matrix. The values are stored in row-major form
+         * and the matrix is retained so that it doesn't need to be re-formed if requested.
+         * 
+         * \param &dRdF: The derivative of the residual w.r.t. the deformation gradient
+         */
+
+        for ( auto row = dRdF.begin( ); row != dRdF.end( ); row++ ){
+
+            if ( row->size( ) != dRdF.begin( )->size( ) ){
+
+                std::string message = "Row " + std::to_string( row - dRdF.begin( ) ) + " of dRdF is not the same length as the first row\n";
+                message            += "  expected: " + std::to_string( dRdF.begin( )->size( ) ) + "\n";
+                message            += "  actual:   " + std::to_string( row->size( ) ) + "\n";
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
+
+        }
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( setFlatdRdF( tardigradeVectorTools::appendVectors( dRdF ) ) );
+
+        _dRdFMatrix.second = dRdF;
+
+        _dRdFMatrix.first = true;
+
+        addIterationData( &_dRdFMatrix );
+
+    }
+
+    void residualBase::setFlatdRdF( const floatVector &dRdF ){
+        /*!
+         * Set the value of dRdF in row-major form
          * 
          * \param &dRdF: The derivative of the residual w.r.t. the deformation gradient
          */
@@ -63,6 +129,8 @@ namespace tardigradeHydra{
 
         _dRdF.first = true;
 
+        _dRdFMatrix.first = false;
+
         addIterationData( &_dRdF );
 
     }
@@ -84,7 +152,39 @@ namespace tardigradeHydra{
 
     void residualBase::setAdditionalDerivatives( const floatMatrix &additionalDerivatives ){
         /*!
-         * Set the value of the additional derivatives of the residual
+         * Set the value of the additional derivatives of the residual from a matrix. The values are stored in row-major form
+         * and the matrix is retained so that it doesn't need to be re-formed if requested.
+         * 
+         * \param &additionalDerivatives: Additional derivatives of the residual
+         */
+
+        for ( auto row = additionalDerivatives.begin( ); row != additionalDerivatives.end( ); row++ ){
+
+            if ( row->size( ) != additionalDerivatives.begin( )->size( ) ){
+
+                std::string message = "Row " + std::to_string( row - additionalDerivatives.begin( ) ) + " of additionalDerivatives is not the same length as the first row\n";
+                message            += "  expected: " + std::to_string( additionalDerivatives.begin( )->size( ) ) + "\n";
+                message            += "  actual:   " + std::to_string( row->size( ) ) + "\n";
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
+
+        }
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( setFlatAdditionalDerivatives( tardigradeVectorTools::appendVectors( additionalDerivatives ) ) );
+
+        _additionalDerivativesMatrix.second = additionalDerivatives;
+
+        _additionalDerivativesMatrix.first = true;
+
+        addIterationData( &_additionalDerivativesMatrix );
+
+    }
+
+    void residualBase::setFlatAdditionalDerivatives( const floatVector &additionalDerivatives ){
+        /*!
+         * Set the value of the additional derivatives of the residual in row-major form
          * 
          * \param &additionalDerivatives: Additional derivatives of the residual
          */
@@ -93,6 +193,8 @@ namespace tardigradeHydra{
 
         _additionalDerivatives.first = true;
 
+        _additionalDerivativesMatrix.first = false;
+
         addIterationData( &_additionalDerivatives );
 
     }
@@ -123,6 +225,8 @@ namespace tardigradeHydra{
 
         _previousCauchyStress.first = true;
 
+        addPointData( &_previousCauchyStress );
+
     }
 
     const floatVector* residualBase::getResidual( ){
@@ -140,10 +244,12 @@ namespace tardigradeHydra{
 
     }
 
-    const floatMatrix* residualBase::getJacobian( ){
+    const floatVector* residualBase::getFlatJacobian( ){
         /*!
          * Get the Jacobian matrix. Must be of size numEquations x numUnknowns
          * numUnknowns is of the size numConfigurations * dim * dim + numNonLinearSolveStateVariables
+         *
+         * The values are stored in row-major form
          */
 
         if ( !_jacobian.first ){
@@ -156,9 +262,49 @@ namespace tardigradeHydra{
 
     }
 
-    const floatMatrix* residualBase::getdRdF( ){
+    const floatMatrix* residualBase::getJacobian( ){
+        /*!
+         * Get the Jacobian matrix. Must be of size numEquations x numUnknowns
+         * numUnknowns is of the size numConfigurations * dim * dim + numNonLinearSolveStateVariables
+         *
+         * The matrix is formed from the row-major values returned by getFlatJacobian
+         */
+
+        if ( !_jacobianMatrix.first ){
+
+            const floatVector *flat;
+            TARDIGRADE_ERROR_TOOLS_CATCH( flat = getFlatJacobian( ) );
+
+            // The matrix will already be set if the user defined the values using a matrix
+            if ( _jacobianMatrix.first ){
+
+                return &_jacobianMatrix.second;
+
+            }
+
+            _jacobianMatrix.second.clear( );
+
+            if ( ( flat->size( ) > 0 ) && ( *getNumEquations( ) > 0 ) ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( _jacobianMatrix.second = tardigradeVectorTools::inflate( *flat, *getNumEquations( ), flat->size( ) / ( *getNumEquations( ) ) ) );
+
+            }
+
+            _jacobianMatrix.first = true;
+
+            addIterationData( &_jacobianMatrix );
+
+        }
+
+        return &_jacobianMatrix.second;
+
+    }
+
+    const floatVector* residualBase::getFlatdRdF( ){
         /*!
          * Get the derivative of the residual w.r.t. the deformation gradient
+         *
+         * The values are stored in row-major form
          */
 
         if ( !_dRdF.first ){
@@ -171,6 +317,43 @@ namespace tardigradeHydra{
 
     }
 
+    const floatMatrix* residualBase::getdRdF( ){
+        /*!
+         * Get the derivative of the residual w.r.t. the deformation gradient
+         *
+         * The matrix is formed from the row-major values returned by getFlatdRdF
+         */
+
+        if ( !_dRdFMatrix.first ){
+
+            const floatVector *flat;
+            TARDIGRADE_ERROR_TOOLS_CATCH( flat = getFlatdRdF( ) );
+
+            // The matrix will already be set if the user defined the values using a matrix
+            if ( _dRdFMatrix.first ){
+
+                return &_dRdFMatrix.second;
+
+            }
+
+            _dRdFMatrix.second.clear( );
+
+            if ( ( flat->size( ) > 0 ) && ( *getNumEquations( ) > 0 ) ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( _dRdFMatrix.second = tardigradeVectorTools::inflate( *flat, *getNumEquations( ), flat->size( ) / ( *getNumEquations( ) ) ) );
+
+            }
+
+            _dRdFMatrix.first = true;
+
+            addIterationData( &_dRdFMatrix );
+
+        }
+
+        return &_dRdFMatrix.second;
+
+    }
+
     const floatVector* residualBase::getdRdT( ){
         /*!
          * Get the derivative of the residual w.r.t. the temperature
@@ -186,9 +369,11 @@ namespace tardigradeHydra{
 
     }
 
-    const floatMatrix* residualBase::getAdditionalDerivatives( ){
+    const floatVector* residualBase::getFlatAdditionalDerivatives( ){
         /*!
          * Get the derivative of the residual w.r.t. additional terms
+         *
+         * The values are stored in row-major form
          */
 
         if ( !_additionalDerivatives.first ){
@@ -201,6 +386,43 @@ namespace tardigradeHydra{
 
     }
 
+    const floatMatrix* residualBase::getAdditionalDerivatives( ){
+        /*!
+         * Get the derivative of the residual w.r.t. additional terms
+         *
+         * The matrix is formed from the row-major values returned by getFlatAdditionalDerivatives
+         */
+
+        if ( !_additionalDerivativesMatrix.first ){
+
+            const floatVector *flat;
+            TARDIGRADE_ERROR_TOOLS_CATCH( flat = getFlatAdditionalDerivatives( ) );
+
+            // The matrix will already be set if the user defined the values using a matrix
+            if ( _additionalDerivativesMatrix.first ){
+
+                return &_additionalDerivativesMatrix.second;
+
+            }
+
+            _additionalDerivativesMatrix.second.clear( );
+
+            if ( ( flat->size( ) > 0 ) && ( *getNumEquations( ) > 0 ) ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( _additionalDerivativesMatrix.second = tardigradeVectorTools::inflate( *flat, *getNumEquations( ), flat->size( ) / ( *getNumEquations( ) ) ) );
+
+            }
+
+            _additionalDerivativesMatrix.first = true;
+
+            addIterationData( &_additionalDerivativesMatrix );
+
+        }
+
+        return &_additionalDerivativesMatrix.second;
+
+    }
+
     const floatVector* residualBase::getCauchyStress( ){
         /*!
          * Get the Cauchy stress
@@ -262,17 +484,86 @@ namespace tardigradeHydra{
 
     }
 
+    void residualBase::setExplicitUnknownIndices( const std::vector< unsigned int > &explicitUnknownIndices ){
+        /*!
+         * Declare that the residual defines unknowns explicitly. The residual equations must be of the form
+         *
+         * \f$ R_i = g_i - X_{u_i} \f$
+         *
+         * where \f$ g_i \f$ does not depend on the unknown vector and \f$ u_i \f$ is the index of the unknown
+         * defined by the \f$ i^{\text{th}} \f$ equation. hydraBase will condense these unknowns out of the
+         * factored jacobian.
+         *
+         * \param &explicitUnknownIndices: The indices of the unknowns defined by each of the residual equations
+         */
+
+        if ( ( explicitUnknownIndices.size( ) != 0 ) && ( explicitUnknownIndices.size( ) != *getNumEquations( ) ) ){
+
+            std::string message = "An explicit residual must define one unknown for each of its equations\n";
+            message            += "  number of equations:         " + std::to_string( *getNumEquations( ) ) + "\n";
+            message            += "  number of explicit unknowns: " + std::to_string( explicitUnknownIndices.size( ) ) + "\n";
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+        }
+
+        _explicitUnknownIndices = explicitUnknownIndices;
+
+    }
+
+    void residualBase::setUnknownBlockDependencies( const std::vector< unsigned int > &unknownBlockDependencies ){
+        /*!
+         * Declare the blocks of the unknown vector which the residual equations depend on. The blocks are the
+         * configurations (where block 0 is the Cauchy stress) followed by the non-linear solve state variables
+         * if there are any. hydraBase uses the declared dependencies to factor the jacobian by block elimination.
+         * If no dependencies are declared the residual is assumed to depend on all of the unknowns.
+         *
+         * \param &unknownBlockDependencies: The indices of the blocks of the unknown vector the residual depends on
+         */
+
+        const unsigned int numBlocks = *hydra->getNumConfigurations( ) + ( *hydra->getNumNonLinearSolveStateVariables( ) > 0 ? 1 : 0 );
+
+        for ( auto b = unknownBlockDependencies.begin( ); b != unknownBlockDependencies.end( ); b++ ){
+
+            if ( *b >= numBlocks ){
+
+                std::string message = "The block of the unknown vector is out of range\n";
+                message            += "  block:            " + std::to_string( *b ) + "\n";
+                message            += "  number of blocks: " + std::to_string( numBlocks ) + "\n";
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
+
+        }
+
+        _unknownBlockDependencies = unknownBlockDependencies;
+
+    }
+
     void residualBase::addIterationData( dataBase *data ){
         /*!
-         * Add data to the vector of values which will be cleared after each iteration
+         * Add data to the values which will be invalidated after each iteration
          * 
-         * \param *data: The dataBase object to be cleared
+         * \param *data: The dataBase object to be invalidated
          */
 
         hydra->addIterationData( data );
 
     }
 
+    void residualBase::addPointData( dataBase *data ){
+        /*!
+         * Add data to the values which will be invalidated when the containing hydra object is moved to a
+         * new material point (i.e., values which don't change during the non-linear solve)
+         * 
+         * \param *data: The dataBase object to be invalidated
+         */
+
+        hydra->addPointData( data );
+
+    }
+
     hydraBase::hydraBase( const floatType &time, const floatType &deltaTime,
                           const floatType &temperature, const floatType &previousTemperature,
                           const floatVector &deformationGradient, const floatVector &previousDeformationGradient,
@@ -331,41 +622,20 @@ namespace tardigradeHydra{
         const unsigned int* nConfig = getNumConfigurations( );
 
         // Set the cauchy stress
-        _cauchyStress.second = floatVector( unknownVector->begin( ),
-                                            unknownVector->begin( ) + ( *dim ) * ( *dim ) );
+        _cauchyStress.second.assign( unknownVector->begin( ),
+                                     unknownVector->begin( ) + ( *dim ) * ( *dim ) );
 
         _cauchyStress.first = true;
 
         addIterationData( &_cauchyStress );
 
         // Set the configurations
-        _configurations.second = floatMatrix( *nConfig, floatVector( ( *dim ) * ( *dim ), 0 ) );
-
-        _inverseConfigurations.second = floatMatrix( *nConfig, floatVector( ( *dim ) * ( *dim ), 0 ) );
-
-        // Initialize the first configuration with the total deformation gradient
-        _configurations.second[ 0 ] = *getDeformationGradient( );
-
-        for ( unsigned int i = ( *nConfig ) - 1; i >= 1; i-- ){
-
-            // Set the current configuration as being equal to the previous
-            _configurations.second[ i ] = floatVector( unknownVector->begin( ) + i * ( *dim ) * ( *dim ),
-                                                       unknownVector->begin( ) + ( i + 1 ) * ( *dim ) * ( *dim ) );
-
-            // Compute the inverse of the current configuration and store it
-            _inverseConfigurations.second[ i ] = tardigradeVectorTools::inverse( _configurations.second[ i ], ( *dim ), ( *dim ) );
-
-            // Add contribution of deformation gradient to the first configuration
-            _configurations.second[ 0 ] = tardigradeVectorTools::matrixMultiply( _configurations.second[ 0 ], _inverseConfigurations.second[ i ],
-                                                                       ( *dim ), ( *dim ), ( *dim ), ( *dim ) );
-
-        }
-
-        _inverseConfigurations.second[ 0 ] = tardigradeVectorTools::inverse( _configurations.second[ 0 ], ( *dim ), ( *dim ) );
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeConfigurations( getDeformationGradient( )->data( ), unknownVector->data( ) + ( *dim ) * ( *dim ), false,
+                                                             _configurations.second, _inverseConfigurations.second ) );
 
         // Extract the remaining state variables required for the non-linear solve
-        _nonLinearSolveStateVariables.second = floatVector( unknownVector->begin( ) + ( *nConfig ) * ( *dim ) * ( *dim ),
-                                                            unknownVector->end( ) );
+        _nonLinearSolveStateVariables.second.assign( unknownVector->begin( ) + ( *nConfig ) * ( *dim ) * ( *dim ),
+                                                     unknownVector->end( ) );
 
         addIterationData( &_configurations );
 
@@ -398,10 +668,6 @@ namespace tardigradeHydra{
 
         const unsigned int* nNLISV  = getNumNonLinearSolveStateVariables( );
 
-        // Extract the previous configurations
-        floatVector eye( ( *dim ) * ( *dim ) );
-        tardigradeVectorTools::eye( eye );
-
         if ( getPreviousStateVariables( )->size( ) < ( ( ( *nConfig ) - 1 ) * ( *dim ) * ( *dim ) + ( *nNLISV ) ) ){
 
             std::string message = "The number of state variables is less than required for the configurations and ";
@@ -415,47 +681,12 @@ namespace tardigradeHydra{
 
         }
 
-        _previousConfigurations.second = floatMatrix( *nConfig, floatVector( ( *dim ) * ( *dim ), 0 ) );
-
-        _configurations.second = floatMatrix( *nConfig, floatVector( ( *dim ) * ( *dim ), 0 ) );
-
-        _previousInverseConfigurations.second = floatMatrix( *nConfig, floatVector( ( *dim ) * ( *dim ), 0 ) );
-
-        _inverseConfigurations.second = floatMatrix( *nConfig, floatVector( ( *dim ) * ( *dim ), 0 ) );
-
-        // Initialize the first configuration with the total deformation gradient
-        _configurations.second[ 0 ] = *getDeformationGradient( );
-
-        _previousConfigurations.second[ 0 ] = *getPreviousDeformationGradient( );
-
-        for ( unsigned int i = ( *nConfig ) - 1; i >= 1; i-- ){
-
-            // Set the current configuration as being equal to the previous
-            _configurations.second[ i ] = floatVector( getPreviousStateVariables( )->begin( ) + ( i - 1 ) * ( *dim ) * ( *dim ),
-                                                       getPreviousStateVariables( )->begin( ) + i * ( *dim ) * ( *dim ) ) + eye;
-
-            // Compute the inverse of the current configuration and store it
-            _inverseConfigurations.second[ i ] = tardigradeVectorTools::inverse( _configurations.second[ i ], ( *dim ), ( *dim ) );
-
-            // Set the previous configuration
-            _previousConfigurations.second[ i ] = _configurations.second[ i ];
-
-            // Set the previous inverse configuration
-            _previousInverseConfigurations.second[ i ] = _inverseConfigurations.second[ i ];
-
-            // Add contribution of deformation gradient to the first configuration
-            _configurations.second[ 0 ] = tardigradeVectorTools::matrixMultiply( _configurations.second[ 0 ], _inverseConfigurations.second[ i ],
-                                                                       ( *dim ), ( *dim ), ( *dim ), ( *dim ) );
-
-            // Add the contribution of the deformation gradient to the previous configuration
-            _previousConfigurations.second[ 0 ] = tardigradeVectorTools::matrixMultiply( _previousConfigurations.second[ 0 ], _previousInverseConfigurations.second[ i ],
-                                                                               ( *dim ), ( *dim ), ( *dim ), ( *dim ) );
-
-        }
-
-        _inverseConfigurations.second[ 0 ] = tardigradeVectorTools::inverse( _configurations.second[ 0 ], ( *dim ), ( *dim ) );
+        // Set the current and previous configurations. The configurations are stored as F - I in the state variables
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeConfigurations( getDeformationGradient( )->data( ), getPreviousStateVariables( )->data( ), true,
+                                                             _configurations.second, _inverseConfigurations.second ) );
 
-        _previousInverseConfigurations.second[ 0 ] = tardigradeVectorTools::inverse( _previousConfigurations.second[ 0 ], ( *dim ), ( *dim ) );
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeConfigurations( getPreviousDeformationGradient( )->data( ), getPreviousStateVariables( )->data( ), true,
+                                                             _previousConfigurations.second, _previousInverseConfigurations.second ) );
 
         // Extract the remaining state variables required for the non-linear solve
         _nonLinearSolveStateVariables.second = floatVector( getPreviousStateVariables( )->begin( ) + ( ( *nConfig ) - 1 ) * ( *dim ) * ( *dim ),
@@ -493,105 +724,414 @@ namespace tardigradeHydra{
 
     }
 
-    floatVector hydraBase::getSubConfiguration( const floatMatrix &configurations, const unsigned int &lowerIndex,
-                                                const unsigned int &upperIndex ){
+    void hydraBase::computeConfigurations( const floatType *deformationGradient, const floatType *subConfigurations, const bool addIdentity,
+                                           floatMatrix &configurations, floatMatrix &inverseConfigurations ){
         /*!
-         * Get a sub-configuration \f$\bf{F}^{sc}\f$ defined as
+         * Compute the configurations and their inverses from the deformation gradient and the
+         * flattened row-major sub-configurations \f$\bf{F}^2, \bf{F}^3, \cdots, \bf{F}^n\f$. The first
+         * configuration is solved for from
          *
-         * \f$ F^{sc}_{iI} = F^{\text{lowerIndex}}_{i\hat{I}} F^{\text{lowerIndex} + 1}_{\hat{I}\breve{I}} \cdots F^{\text{upperIndex-1}}_{\bar{I}I} \f$
-         * \param &configurations: The configurations to operate on
-         * \param &lowerIndex: The index of the lower configuration (starts at 0 and goes to numConfigurations - 1)
-         * \param &upperIndex: The index of the upper configuration (starts at 0 and goes to numConfigurations)
-         *   Note, the configuration indicated by the index is NOT included in the sub-configuration
+         * \f$\bf{F}^1 = \bf{F} \left(\bf{F}^n\right)^{-1} \cdots \left(\bf{F}^2\right)^{-1}\f$
+         *
+         * \param *deformationGradient: A pointer to the start of the deformation gradient
+         * \param *subConfigurations: A pointer to the start of the sub-configurations \f$\bf{F}^2, \bf{F}^3, \cdots, \bf{F}^n\f$
+         * \param addIdentity: Flag for whether the identity should be added to the sub-configurations (i.e., they
+         *     are stored as \f$\bf{F}^x - \bf{I}\f$ as is done in the state variable vector)
+         * \param &configurations: The resulting configurations
+         * \param &inverseConfigurations: The resulting inverse configurations
          */
 
-        if ( upperIndex > configurations.size( ) ){
+        const unsigned int* dim = getDimension( );
 
-            std::string message = "The upper index must be less than or equal to the total number of configurations\n";
-            message            += "  upperIndex      : " + std::to_string( upperIndex ) + "\n";
-            message            += "  # configurations: " + std::to_string( configurations.size( ) );
+        const unsigned int* nConfig = getNumConfigurations( );
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+        if ( ( *dim ) == 3 ){
 
-        }
+            TARDIGRADE_ERROR_TOOLS_CATCH( computeFixedSizeConfigurations< 3 >( deformationGradient, subConfigurations, addIdentity, configurations, inverseConfigurations ) );
 
-        if ( lowerIndex > upperIndex ){
+            return;
 
-            std::string message = "The upper index must be greater than or equal to the lower index\n";
-            message            += "  lowerIndex: " + std::to_string( lowerIndex ) + "\n";
-            message            += "  upperIndex: " + std::to_string( upperIndex ) + "\n";
+        }
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+        const unsigned int sot_dim = ( *dim ) * ( *dim );
 
+        floatVector eye( sot_dim, 0 );
+        if ( addIdentity ){
+            tardigradeVectorTools::eye( eye );
         }
 
-        const unsigned int* dim = getDimension( );
+        configurations = floatMatrix( *nConfig, floatVector( sot_dim, 0 ) );
 
-        floatVector Fsc( ( *dim ) * ( *dim ), 0 );
-        tardigradeVectorTools::eye( Fsc );
+        inverseConfigurations = floatMatrix( *nConfig, floatVector( sot_dim, 0 ) );
 
-        for ( unsigned int i = lowerIndex; i < upperIndex; i++ ){
+        // Initialize the first configuration with the total deformation gradient
+        configurations[ 0 ] = floatVector( deformationGradient, deformationGradient + sot_dim );
 
-            Fsc = tardigradeVectorTools::matrixMultiply( Fsc, configurations[ i ], ( *dim ), ( *dim ), ( *dim ), ( *dim ) );
+        for ( unsigned int i = ( *nConfig ) - 1; i >= 1; i-- ){
+
+            // Set the current configuration
+            configurations[ i ] = floatVector( subConfigurations + ( i - 1 ) * sot_dim, subConfigurations + i * sot_dim ) + eye;
+
+            // Compute the inverse of the current configuration and store it
+            inverseConfigurations[ i ] = tardigradeVectorTools::inverse( configurations[ i ], ( *dim ), ( *dim ) );
+
+            // Add contribution of deformation gradient to the first configuration
+            configurations[ 0 ] = tardigradeVectorTools::matrixMultiply( configurations[ 0 ], inverseConfigurations[ i ],
+                                                                         ( *dim ), ( *dim ), ( *dim ), ( *dim ) );
 
         }
 
-        return Fsc;
+        inverseConfigurations[ 0 ] = tardigradeVectorTools::inverse( configurations[ 0 ], ( *dim ), ( *dim ) );
 
     }
 
-    floatMatrix hydraBase::getSubConfigurationGradient( const floatMatrix &configurations, const unsigned int &lowerIndex,
-                                                        const unsigned int &upperIndex ){
+    template< unsigned int dim >
+    void hydraBase::computeFixedSizeConfigurations( const floatType *deformationGradient, const floatType *subConfigurations, const bool addIdentity,
+                                                    floatMatrix &configurations, floatMatrix &inverseConfigurations ){
         /*!
-         * Get the gradient a sub-configuration \f$\bf{F}^{sc}\f$ defined as
+         * Compute the configurations and their inverses for a spatial dimension known at compile time. All of the
+         * intermediate quantities are fixed-size and the storage of the results is re-used so that no heap
+         * allocations are made once the results have been sized.
          *
-         * \f$ F^{sc}_{iI} = F^{\text{lowerIndex}}_{i\hat{I}} F^{\text{lowerIndex} + 1}_{\hat{I}\breve{I}} \cdots F^{\text{upperIndex-1}}_{\bar{I}I} \f$
-         * 
-         * with respect to all of the configurations. The returned matrix will be of size ( dimensions**2, configurations.size( ) * dimensions**2 )
-         * 
-         * \param &configurations: The configurations to operate on
+         * \param *deformationGradient: A pointer to the start of the deformation gradient
+         * \param *subConfigurations: A pointer to the start of the sub-configurations \f$\bf{F}^2, \bf{F}^3, \cdots, \bf{F}^n\f$
+         * \param addIdentity: Flag for whether the identity should be added to the sub-configurations
+         * \param &configurations: The resulting configurations
+         * \param &inverseConfigurations: The resulting inverse configurations
+         */
+
+        typedef typename fixedSizeTypes< dim >::secondOrderTensor secondOrderTensor;
+
+        typedef typename fixedSizeTypes< dim >::secondOrderTensorMap secondOrderTensorMap;
+
+        typedef typename fixedSizeTypes< dim >::constSecondOrderTensorMap constSecondOrderTensorMap;
+
+        constexpr unsigned int sot_dim = dim * dim;
+
+        const unsigned int* nConfig = getNumConfigurations( );
+
+        configurations.resize( *nConfig );
+
+        inverseConfigurations.resize( *nConfig );
+
+        for ( unsigned int i = 0; i < *nConfig; i++ ){
+
+            configurations[ i ].resize( sot_dim );
+
+            inverseConfigurations[ i ].resize( sot_dim );
+
+        }
+
+        secondOrderTensor F1 = constSecondOrderTensorMap( deformationGradient );
+
+        for ( unsigned int i = ( *nConfig ) - 1; i >= 1; i-- ){
+
+            secondOrderTensorMap Fi( configurations[ i ].data( ) );
+
+            Fi = constSecondOrderTensorMap( subConfigurations + ( i - 1 ) * sot_dim );
+
+            if ( addIdentity ){
+
+                Fi += secondOrderTensor::Identity( );
+
+            }
+
+            secondOrderTensorMap invFi( inverseConfigurations[ i ].data( ) );
+
+            invFi = Fi.inverse( );
+
+            F1 = ( F1 * invFi ).eval( );
+
+        }
+
+        secondOrderTensorMap( configurations[ 0 ].data( ) ) = F1;
+
+        secondOrderTensorMap( inverseConfigurations[ 0 ].data( ) ) = F1.inverse( );
+
+    }
+
+    template< unsigned int dim >
+    void hydraBase::computeFixedSizeSubConfiguration( const floatMatrix &configurations, const unsigned int &lowerIndex,
+                                                      const unsigned int &upperIndex, floatVector &subConfiguration ){
+        /*!
+         * Compute a sub-configuration for a spatial dimension known at compile time
+         *
+         * \param &configurations: The configurations to operate on
+         * \param &lowerIndex: The index of the lower configuration
+         * \param &upperIndex: The index of the upper configuration (not included in the product)
+         * \param &subConfiguration: The resulting sub-configuration
+         */
+
+        typedef typename fixedSizeTypes< dim >::secondOrderTensor secondOrderTensor;
+
+        typedef typename fixedSizeTypes< dim >::constSecondOrderTensorMap constSecondOrderTensorMap;
+
+        secondOrderTensor Fsc = secondOrderTensor::Identity( );
+
+        for ( unsigned int i = lowerIndex; i < upperIndex; i++ ){
+
+            Fsc = ( Fsc * constSecondOrderTensorMap( configurations[ i ].data( ) ) ).eval( );
+
+        }
+
+        subConfiguration = floatVector( Fsc.data( ), Fsc.data( ) + dim * dim );
+
+    }
+
+    template< unsigned int dim >
+    void hydraBase::computeFixedSizeSubConfigurations( const floatMatrix &configurations, floatMatrix &subConfigurations ){
+        /*!
+         * Compute the sub-configurations between every pair of indices for a spatial dimension known at compile time
+         *
+         * \param &configurations: The configurations to operate on
+         * \param &subConfigurations: The sub-configurations where the product of the configurations from lowerIndex
+         *     up to but not including upperIndex is stored at ( configurations.size( ) + 1 ) * lowerIndex + upperIndex
+         */
+
+        typedef typename fixedSizeTypes< dim >::secondOrderTensorMap secondOrderTensorMap;
+
+        typedef typename fixedSizeTypes< dim >::constSecondOrderTensorMap constSecondOrderTensorMap;
+
+        const unsigned int numConfigurations = configurations.size( );
+
+        const unsigned int stride = numConfigurations + 1;
+
+        subConfigurations.resize( stride * stride );
+
+        for ( unsigned int lowerIndex = 0; lowerIndex <= numConfigurations; lowerIndex++ ){
+
+            floatVector &identity = subConfigurations[ stride * lowerIndex + lowerIndex ];
+
+            identity.resize( dim * dim );
+
+            secondOrderTensorMap( identity.data( ) ).setIdentity( );
+
+            if ( lowerIndex == numConfigurations ){
+
+                continue;
+
+            }
+
+            subConfigurations[ stride * lowerIndex + lowerIndex + 1 ] = configurations[ lowerIndex ];
+
+            // Extend the product one configuration at a time
+            for ( unsigned int upperIndex = lowerIndex + 2; upperIndex <= numConfigurations; upperIndex++ ){
+
+                floatVector &Fsc = subConfigurations[ stride * lowerIndex + upperIndex ];
+
+                Fsc.resize( dim * dim );
+
+                secondOrderTensorMap( Fsc.data( ) ).noalias( ) = constSecondOrderTensorMap( subConfigurations[ stride * lowerIndex + upperIndex - 1 ].data( ) )
+                                                               * constSecondOrderTensorMap( configurations[ upperIndex - 1 ].data( ) );
+
+            }
+
+        }
+
+    }
+
+    void hydraBase::computeSubConfigurations( const floatMatrix &configurations, floatMatrix &subConfigurations ){
+        /*!
+         * Compute the sub-configurations between every pair of indices. The products which start at the first
+         * configuration are the prefix products and those which end at the last configuration are the suffix products.
+         *
+         * \param &configurations: The configurations to operate on
+         * \param &subConfigurations: The sub-configurations where the product of the configurations from lowerIndex
+         *     up to but not including upperIndex is stored at ( configurations.size( ) + 1 ) * lowerIndex + upperIndex
+         */
+
+        const unsigned int* dim = getDimension( );
+
+        if ( ( *dim ) == 3 ){
+
+            computeFixedSizeSubConfigurations< 3 >( configurations, subConfigurations );
+
+            return;
+
+        }
+
+        const unsigned int numConfigurations = configurations.size( );
+
+        const unsigned int stride = numConfigurations + 1;
+
+        subConfigurations.resize( stride * stride );
+
+        for ( unsigned int lowerIndex = 0; lowerIndex <= numConfigurations; lowerIndex++ ){
+
+            subConfigurations[ stride * lowerIndex + lowerIndex ] = floatVector( ( *dim ) * ( *dim ), 0 );
+            tardigradeVectorTools::eye( subConfigurations[ stride * lowerIndex + lowerIndex ] );
+
+            for ( unsigned int upperIndex = lowerIndex + 1; upperIndex <= numConfigurations; upperIndex++ ){
+
+                subConfigurations[ stride * lowerIndex + upperIndex ] = tardigradeVectorTools::matrixMultiply( subConfigurations[ stride * lowerIndex + upperIndex - 1 ],
+                                                                                                               configurations[ upperIndex - 1 ],
+                                                                                                               ( *dim ), ( *dim ), ( *dim ), ( *dim ) );
+
+            }
+
+        }
+
+    }
+
+    void hydraBase::computeSubConfigurationGradient( const floatMatrix &subConfigurations, const unsigned int &numConfigurations,
+                                                     const unsigned int &lowerIndex, const unsigned int &upperIndex,
+                                                     floatMatrix &gradient ){
+        /*!
+         * Compute the dense gradient of a sub-configuration with respect to all of the configurations from the
+         * sub-configurations between every pair of indices
+         *
+         * \param &subConfigurations: The sub-configurations (see computeSubConfigurations)
+         * \param &numConfigurations: The number of configurations
+         * \param &lowerIndex: The index of the lower configuration
+         * \param &upperIndex: The index of the upper configuration (not included in the product)
+         * \param &gradient: The gradient of size ( dimensions**2, numConfigurations * dimensions**2 )
+         */
+
+        gradient = subConfigurationGradient( &subConfigurations, *getDimension( ), numConfigurations, lowerIndex, upperIndex ).toDense( );
+
+    }
+
+    void hydraBase::checkSubConfigurationIndices( const unsigned int &numConfigurations, const unsigned int &lowerIndex,
+                                                  const unsigned int &upperIndex ){
+        /*!
+         * Check that the indices of a sub-configuration are valid
+         *
+         * \param &numConfigurations: The number of configurations
          * \param &lowerIndex: The index of the lower configuration (starts at 0 and goes to numConfigurations - 1)
          * \param &upperIndex: The index of the upper configuration (starts at 0 and goes to numConfigurations)
-         *   Note, the configuration indicated by the index is NOT included in the sub-configuration
          */
 
-        const unsigned int *dim = getDimension( );
+        if ( upperIndex > numConfigurations ){
+
+            std::string message = "The upper index must be less than or equal to the total number of configurations\n";
+            message            += "  upperIndex      : " + std::to_string( upperIndex ) + "\n";
+            message            += "  # configurations: " + std::to_string( numConfigurations );
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+        }
+
+        if ( lowerIndex > upperIndex ){
+
+            std::string message = "The upper index must be greater than or equal to the lower index\n";
+            message            += "  lowerIndex: " + std::to_string( lowerIndex ) + "\n";
+            message            += "  upperIndex: " + std::to_string( upperIndex ) + "\n";
 
-        floatMatrix gradient( ( *dim ) * ( *dim ), floatVector( ( *dim ) * ( *dim ) * configurations.size( ), 0 ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
 
-        for ( unsigned int index = lowerIndex; index < upperIndex; index++ ){
+        }
 
-            floatVector Fm, Fp;
+    }
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( Fm = getSubConfiguration( configurations, lowerIndex, index ) );
+    floatVector hydraBase::getSubConfiguration( const floatMatrix &configurations, const unsigned int &lowerIndex,
+                                                const unsigned int &upperIndex ){
+        /*!
+         * Get a sub-configuration \f$\bf{F}^{sc}\f$ defined as
+         *
+         * \f$ F^{sc}_{iI} = F^{\text{lowerIndex}}_{i\hat{I}} F^{\text{lowerIndex} + 1}_{\hat{I}\breve{I}} \cdots F^{\text{upperIndex-1}}_{\bar{I}I} \f$
+         * \param &configurations: The configurations to operate on
+         * \param &lowerIndex: The index of the lower configuration (starts at 0 and goes to numConfigurations - 1)
+         * \param &upperIndex: The index of the upper configuration (starts at 0 and goes to numConfigurations)
+         *   Note, the configuration indicated by the index is NOT included in the sub-configuration
+         */
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( Fp = getSubConfiguration( configurations, index + 1, upperIndex ) );
+        TARDIGRADE_ERROR_TOOLS_CATCH( checkSubConfigurationIndices( configurations.size( ), lowerIndex, upperIndex ) );
 
-            for ( unsigned int i = 0; i < *dim; i++ ){
+        const unsigned int* dim = getDimension( );
 
-                for ( unsigned int I = 0; I < *dim; I++ ){
+        floatVector Fsc;
 
-                    for ( unsigned int a = 0; a < *dim; a++ ){
+        if ( ( *dim ) == 3 ){
 
-                        for ( unsigned int A = 0; A < *dim; A++ ){
+            computeFixedSizeSubConfiguration< 3 >( configurations, lowerIndex, upperIndex, Fsc );
 
-                            gradient[ ( *dim ) * i + I ][ ( *dim ) * ( *dim ) * index + ( *dim ) * a + A ] = Fm[ ( *dim ) * i + a ] * Fp[ ( *dim ) * A + I ];
+            return Fsc;
 
-                        }
+        }
 
-                    }
+        Fsc = floatVector( ( *dim ) * ( *dim ), 0 );
+        tardigradeVectorTools::eye( Fsc );
 
-                }
+        for ( unsigned int i = lowerIndex; i < upperIndex; i++ ){
 
-            } 
+            Fsc = tardigradeVectorTools::matrixMultiply( Fsc, configurations[ i ], ( *dim ), ( *dim ), ( *dim ), ( *dim ) );
 
         }
 
+        return Fsc;
+
+    }
+
+    floatMatrix hydraBase::getSubConfigurationGradient( const floatMatrix &configurations, const unsigned int &lowerIndex,
+                                                        const unsigned int &upperIndex ){
+        /*!
+         * Get the gradient a sub-configuration \f$\bf{F}^{sc}\f$ defined as
+         *
+         * \f$ F^{sc}_{iI} = F^{\text{lowerIndex}}_{i\hat{I}} F^{\text{lowerIndex} + 1}_{\hat{I}\breve{I}} \cdots F^{\text{upperIndex-1}}_{\bar{I}I} \f$
+         * 
+         * with respect to all of the configurations. The returned matrix will be of size ( dimensions**2, configurations.size( ) * dimensions**2 )
+         * 
+         * \param &configurations: The configurations to operate on
+         * \param &lowerIndex: The index of the lower configuration (starts at 0 and goes to numConfigurations - 1)
+         * \param &upperIndex: The index of the upper configuration (starts at 0 and goes to numConfigurations)
+         *   Note, the configuration indicated by the index is NOT included in the sub-configuration
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( checkSubConfigurationIndices( configurations.size( ), lowerIndex, upperIndex ) );
+
+        floatMatrix subConfigurations;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeSubConfigurations( configurations, subConfigurations ) );
+
+        floatMatrix gradient;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( computeSubConfigurationGradient( subConfigurations, configurations.size( ), lowerIndex, upperIndex, gradient ) );
+
         return gradient;
 
     }
 
-    floatVector hydraBase::getSubConfiguration( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
+    const floatMatrix* hydraBase::getSubConfigurations( ){
+        /*!
+         * Get the current sub-configurations between every pair of indices (see computeSubConfigurations). They are
+         * computed once each time the unknown vector is updated.
+         */
+
+        if ( !_subConfigurations.first ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( computeSubConfigurations( *getConfigurations( ), _subConfigurations.second ) );
+
+            _subConfigurations.first = true;
+
+            addIterationData( &_subConfigurations );
+
+        }
+
+        return &_subConfigurations.second;
+
+    }
+
+    const floatMatrix* hydraBase::getPreviousSubConfigurations( ){
+        /*!
+         * Get the previous sub-configurations between every pair of indices (see computeSubConfigurations). They
+         * are computed once for each material point.
+         */
+
+        if ( !_previousSubConfigurations.first ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( computeSubConfigurations( *getPreviousConfigurations( ), _previousSubConfigurations.second ) );
+
+            _previousSubConfigurations.first = true;
+
+            addPointData( &_previousSubConfigurations );
+
+        }
+
+        return &_previousSubConfigurations.second;
+
+    }
+
+    const floatVector& hydraBase::getSubConfiguration( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
         /*!
          * Get a sub-configuration \f$\bf{F}^{sc}\f$ defined as
          *
@@ -601,11 +1141,17 @@ namespace tardigradeHydra{
          *   Note, the configuration indicated by the index is NOT included in the sub-configuration
          */
 
-        return getSubConfiguration( *getConfigurations( ), lowerIndex, upperIndex );
+        TARDIGRADE_ERROR_TOOLS_CATCH( checkSubConfigurationIndices( *getNumConfigurations( ), lowerIndex, upperIndex ) );
+
+        const floatMatrix *subConfigurations;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( subConfigurations = getSubConfigurations( ) );
+
+        return ( *subConfigurations )[ ( ( *getNumConfigurations( ) ) + 1 ) * lowerIndex + upperIndex ];
 
     }
 
-    floatVector hydraBase::getPrecedingConfiguration( const unsigned int &index ){
+    const floatVector& hydraBase::getPrecedingConfiguration( const unsigned int &index ){
         /*!
          * Get the sub-configuration preceding but not including the index
          * 
@@ -616,7 +1162,7 @@ namespace tardigradeHydra{
 
     }
 
-    floatVector hydraBase::getFollowingConfiguration( const unsigned int &index ){
+    const floatVector& hydraBase::getFollowingConfiguration( const unsigned int &index ){
         /*!
          * Get the sub-configuration following but not including the index
          * 
@@ -627,7 +1173,7 @@ namespace tardigradeHydra{
 
     }
 
-    floatVector hydraBase::getConfiguration( const unsigned int &index ){
+    const floatVector& hydraBase::getConfiguration( const unsigned int &index ){
         /*!
          * Get the configuration indicated by the provided index
          * 
@@ -638,7 +1184,7 @@ namespace tardigradeHydra{
 
     }
 
-    floatVector hydraBase::getPreviousSubConfiguration( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
+    const floatVector& hydraBase::getPreviousSubConfiguration( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
         /*!
          * Get a previous sub-configuration \f$\bf{F}^{sc}\f$ defined as
          *
@@ -648,11 +1194,17 @@ namespace tardigradeHydra{
          *   Note, the configuration indicated by the index is NOT included in the sub-configuration
          */
 
-        return getSubConfiguration( *getPreviousConfigurations( ), lowerIndex, upperIndex );
+        TARDIGRADE_ERROR_TOOLS_CATCH( checkSubConfigurationIndices( *getNumConfigurations( ), lowerIndex, upperIndex ) );
+
+        const floatMatrix *subConfigurations;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( subConfigurations = getPreviousSubConfigurations( ) );
+
+        return ( *subConfigurations )[ ( ( *getNumConfigurations( ) ) + 1 ) * lowerIndex + upperIndex ];
 
     }
 
-    floatVector hydraBase::getPreviousPrecedingConfiguration( const unsigned int &index ){
+    const floatVector& hydraBase::getPreviousPrecedingConfiguration( const unsigned int &index ){
         /*!
          * Get the previous sub-configuration preceding but not including the index
          * 
@@ -663,7 +1215,7 @@ namespace tardigradeHydra{
 
     }
 
-    floatVector hydraBase::getPreviousFollowingConfiguration( const unsigned int &index ){
+    const floatVector& hydraBase::getPreviousFollowingConfiguration( const unsigned int &index ){
         /*!
          * Get the previous sub-configuration following but not including the index
          * 
@@ -674,7 +1226,7 @@ namespace tardigradeHydra{
 
     }
 
-    floatVector hydraBase::getPreviousConfiguration( const unsigned int &index ){
+    const floatVector& hydraBase::getPreviousConfiguration( const unsigned int &index ){
         /*!
          * Get the previous configuration indicated by the provided index
          * 
@@ -685,24 +1237,47 @@ namespace tardigradeHydra{
 
     }
 
-    floatMatrix hydraBase::getSubConfigurationGradient( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
+    const floatMatrix& hydraBase::getSubConfigurationGradient( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
         /*!
          * Get the gradient of a sub-configuration \f$\bf{F}^{sc}\f$ defined as
          *
          * \f$ F^{sc}_{iI} = F^{\text{lowerIndex}}_{i\hat{I}} F^{\text{lowerIndex} + 1}_{\hat{I}\breve{I}} \cdots F^{\text{upperIndex-1}}_{\bar{I}I} \f$
          * 
-         * with respect to the current configurations.
+         * with respect to the current configurations. The gradient is computed once each time the unknown vector
+         * is updated.
          *
          * \param &lowerIndex: The index of the lower configuration (starts at 0 and goes to numConfigurations - 1)
          * \param &upperIndex: The index of the upper configuration (starts at 0 and goes to numConfigurations)
          *   Note, the configuration indicated by the index is NOT included in the sub-configuration
          */
 
-        return getSubConfigurationGradient( *getConfigurations( ), lowerIndex, upperIndex );
+        TARDIGRADE_ERROR_TOOLS_CATCH( checkSubConfigurationIndices( *getNumConfigurations( ), lowerIndex, upperIndex ) );
+
+        const unsigned int stride = ( *getNumConfigurations( ) ) + 1;
+
+        if ( !_subConfigurationGradients.first ){
+
+            _subConfigurationGradients.second = std::vector< floatMatrix >( stride * stride );
+
+            _subConfigurationGradients.first = true;
+
+            addIterationData( &_subConfigurationGradients );
+
+        }
+
+        floatMatrix &gradient = _subConfigurationGradients.second[ stride * lowerIndex + upperIndex ];
+
+        if ( gradient.size( ) == 0 ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( computeSubConfigurationGradient( *getSubConfigurations( ), *getNumConfigurations( ), lowerIndex, upperIndex, gradient ) );
+
+        }
+
+        return gradient;
 
     }
 
-    floatMatrix hydraBase::getPrecedingConfigurationGradient( const unsigned int &index ){
+    const floatMatrix& hydraBase::getPrecedingConfigurationGradient( const unsigned int &index ){
         /*!
          * Get the gradient of the sub-configuration preceding but not including the index with respect to the current configurations.
          * 
@@ -713,7 +1288,7 @@ namespace tardigradeHydra{
 
     }
 
-    floatMatrix hydraBase::getFollowingConfigurationGradient( const unsigned int &index ){
+    const floatMatrix& hydraBase::getFollowingConfigurationGradient( const unsigned int &index ){
         /*!
          * Get the gradient of the sub-configuration following but not including the index with respect to the current configurations.
          * 
@@ -724,24 +1299,46 @@ namespace tardigradeHydra{
 
     }
 
-    floatMatrix hydraBase::getPreviousSubConfigurationGradient( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
+    const floatMatrix& hydraBase::getPreviousSubConfigurationGradient( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
         /*!
          * Get the gradient of a previous sub-configuration \f$\bf{F}^{sc}\f$ defined as
          *
          * \f$ F^{sc}_{iI} = F^{\text{lowerIndex}}_{i\hat{I}} F^{\text{lowerIndex} + 1}_{\hat{I}\breve{I}} \cdots F^{\text{upperIndex-1}}_{\bar{I}I} \f$
          * 
-         * with respect to the previous configurations.
+         * with respect to the previous configurations. The gradient is computed once for each material point.
          *
          * \param &lowerIndex: The index of the lower configuration (starts at 0 and goes to numConfigurations - 1)
          * \param &upperIndex: The index of the upper configuration (starts at 0 and goes to numConfigurations)
          *   Note, the configuration indicated by the index is NOT included in the sub-configuration
          */
 
-        return getSubConfigurationGradient( *getPreviousConfigurations( ), lowerIndex, upperIndex );
+        TARDIGRADE_ERROR_TOOLS_CATCH( checkSubConfigurationIndices( *getNumConfigurations( ), lowerIndex, upperIndex ) );
+
+        const unsigned int stride = ( *getNumConfigurations( ) ) + 1;
+
+        if ( !_previousSubConfigurationGradients.first ){
+
+            _previousSubConfigurationGradients.second = std::vector< floatMatrix >( stride * stride );
+
+            _previousSubConfigurationGradients.first = true;
+
+            addPointData( &_previousSubConfigurationGradients );
+
+        }
+
+        floatMatrix &gradient = _previousSubConfigurationGradients.second[ stride * lowerIndex + upperIndex ];
+
+        if ( gradient.size( ) == 0 ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( computeSubConfigurationGradient( *getPreviousSubConfigurations( ), *getNumConfigurations( ), lowerIndex, upperIndex, gradient ) );
+
+        }
+
+        return gradient;
 
     }
 
-    floatMatrix hydraBase::getPreviousPrecedingConfigurationGradient( const unsigned int &index ){
+    const floatMatrix& hydraBase::getPreviousPrecedingConfigurationGradient( const unsigned int &index ){
         /*!
          * Get the gradient of the previous sub-configuration preceding but not including the index with
          * respect to the previous configurations.
@@ -753,7 +1350,7 @@ namespace tardigradeHydra{
 
     }
 
-    floatMatrix hydraBase::getPreviousFollowingConfigurationGradient( const unsigned int &index ){
+    const floatMatrix& hydraBase::getPreviousFollowingConfigurationGradient( const unsigned int &index ){
         /*!
          * Get the gradient of the previous sub-configuration following but not including the index with
          * respect to the previous configurations
@@ -765,134 +1362,181 @@ namespace tardigradeHydra{
 
     }
 
-    void hydraBase::setFirstConfigurationGradients( ){
+    subConfigurationGradient hydraBase::getSubConfigurationGradientFactors( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
         /*!
-         * Get the gradient of the first configuration w.r.t. the deformation gradient (the first entry of the pair)
-         * and the remaining gradients (the second entry) i.e.,
-         * 
-         * \f$\text{return.first} = \frac{\partial F^1}{\partial F}\f$
-         * \f$\text{return.second} = \frac{\partial F^1}{\partial F^n}\f$
-         * 
-         * where \f$F^n = F^2, F^3, \cdots\f$
+         * Get the gradient of a sub-configuration with respect to the current configurations in factored form. The
+         * result is valid until the unknown vector is updated.
+         *
+         * \param &lowerIndex: The index of the lower configuration (starts at 0 and goes to numConfigurations - 1)
+         * \param &upperIndex: The index of the upper configuration (starts at 0 and goes to numConfigurations)
+         *   Note, the configuration indicated by the index is NOT included in the sub-configuration
          */
 
-        const unsigned int* dim = getDimension( );
+        TARDIGRADE_ERROR_TOOLS_CATCH( checkSubConfigurationIndices( *getNumConfigurations( ), lowerIndex, upperIndex ) );
 
-        _dF1dF.second = floatMatrix( ( *dim ) * ( *dim ), floatVector( ( *dim ) * ( *dim ), 0 ) );
+        const floatMatrix *subConfigurations;
 
-        _dF1dFn.second = floatMatrix( ( *dim ) * ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( ( *getNumConfigurations( ) ) - 1 ), 0 ) );
+        TARDIGRADE_ERROR_TOOLS_CATCH( subConfigurations = getSubConfigurations( ) );
 
-        floatVector eye( ( *dim ) * ( *dim ) );
-        tardigradeVectorTools::eye( eye );
+        return subConfigurationGradient( subConfigurations, *getDimension( ), *getNumConfigurations( ), lowerIndex, upperIndex );
 
-        floatVector invFsc = tardigradeVectorTools::inverse( getFollowingConfiguration( 0 ), ( *dim ), ( *dim ) );
+    }
 
-        floatMatrix dInvFscdFsc = tardigradeVectorTools::computeDInvADA( invFsc, ( *dim ), ( *dim ) );
+    subConfigurationGradient hydraBase::getPrecedingConfigurationGradientFactors( const unsigned int &index ){
+        /*!
+         * Get the gradient of the sub-configuration preceding but not including the index with respect to the current
+         * configurations in factored form.
+         *
+         * \param &index: The index of the configuration immediately following the sub-configuration
+         */
 
-        floatMatrix dInvFscdFs = tardigradeVectorTools::dot( dInvFscdFsc, getFollowingConfigurationGradient( 0 ) );
+        return getSubConfigurationGradientFactors( 0, index );
 
-        // Compute the gradients
-        for ( unsigned int i = 0; i < ( *dim ); i++ ){
+    }
 
-            for ( unsigned int barI = 0; barI < ( *dim ); barI++ ){
+    subConfigurationGradient hydraBase::getFollowingConfigurationGradientFactors( const unsigned int &index ){
+        /*!
+         * Get the gradient of the sub-configuration following but not including the index with respect to the current
+         * configurations in factored form.
+         *
+         * \param &index: The index of the current configuration immediately before the sub-configuration
+         */
 
-                for ( unsigned int a = 0; a < ( *dim ); a++ ){
+        return getSubConfigurationGradientFactors( index + 1, *getNumConfigurations( ) );
 
-                    for ( unsigned int A = 0; A < ( *dim ); A++ ){
-
-                        _dF1dF.second[ ( *dim ) * i + barI ][ ( * dim ) * a + A ] += eye[ ( *dim ) * i + a ] * invFsc[ ( *dim ) * A + barI ];
-
-                        for ( unsigned int index = 0; index < ( *getNumConfigurations( ) ) - 1; index++ ){
-
-                            for ( unsigned int J = 0; J < ( *dim ); J++ ){
+    }
 
-                                _dF1dFn.second[ ( *dim ) * i + barI ][ ( *dim ) * ( *dim ) * index + ( *dim ) * a + A ]
-                                    += ( *getDeformationGradient( ) )[ ( *dim ) * i + J ]
-                                     * dInvFscdFs[ ( *dim ) * J + barI ][ ( *dim ) * ( *dim ) * ( index + 1 ) + ( *dim ) * a + A ];
+    subConfigurationGradient hydraBase::getPreviousSubConfigurationGradientFactors( const unsigned int &lowerIndex, const unsigned int &upperIndex ){
+        /*!
+         * Get the gradient of a previous sub-configuration with respect to the previous configurations in factored
+         * form. The result is valid until the material point is changed.
+         *
+         * \param &lowerIndex: The index of the lower configuration (starts at 0 and goes to numConfigurations - 1)
+         * \param &upperIndex: The index of the upper configuration (starts at 0 and goes to numConfigurations)
+         *   Note, the configuration indicated by the index is NOT included in the sub-configuration
+         */
 
-                            }
+        TARDIGRADE_ERROR_TOOLS_CATCH( checkSubConfigurationIndices( *getNumConfigurations( ), lowerIndex, upperIndex ) );
 
-                        }
+        const floatMatrix *subConfigurations;
 
-                    }
+        TARDIGRADE_ERROR_TOOLS_CATCH( subConfigurations = getPreviousSubConfigurations( ) );
 
-                }
+        return subConfigurationGradient( subConfigurations, *getDimension( ), *getNumConfigurations( ), lowerIndex, upperIndex );
 
-            }
+    }
 
-        }
+    subConfigurationGradient hydraBase::getPreviousPrecedingConfigurationGradientFactors( const unsigned int &index ){
+        /*!
+         * Get the gradient of the previous sub-configuration preceding but not including the index with respect to
+         * the previous configurations in factored form.
+         *
+         * \param &index: The index of the configuration immediately following the sub-configuration
+         */
 
-        _dF1dF.first = true;
+        return getPreviousSubConfigurationGradientFactors( 0, index );
 
-        _dF1dFn.first = true;
+    }
 
-        addIterationData( &_dF1dF );
+    subConfigurationGradient hydraBase::getPreviousFollowingConfigurationGradientFactors( const unsigned int &index ){
+        /*!
+         * Get the gradient of the previous sub-configuration following but not including the index with respect to
+         * the previous configurations in factored form.
+         *
+         * \param &index: The index of the current configuration immediately before the sub-configuration
+         */
 
-        addIterationData( &_dF1dFn );
+        return getPreviousSubConfigurationGradientFactors( index + 1, *getNumConfigurations( ) );
 
     }
 
-    void hydraBase::setPreviousFirstConfigurationGradients( ){
+    void hydraBase::formFirstConfigurationGradients( const floatVector &deformationGradient, const subConfigurationGradient &dFscdFs,
+                                                     floatMatrix &dF1dF, floatMatrix &dF1dFn ){
         /*!
-         * Get the gradient of the previous first configuration w.r.t. the deformation gradient (the first entry of the pair)
-         * and the remaining gradients (the second entry) i.e.,
-         * 
-         * \f$\text{return.first} = \frac{\partial F^1}{\partial F}\f$
-         * \f$\text{return.second} = \frac{\partial F^1}{\partial F^n}\f$
-         * 
-         * where \f$F^n = F^2, F^3, \cdots\f$
+         * Form the gradients of the first configuration using the fixed-size kernel when the dimension is three
+         *
+         * \param &deformationGradient: The deformation gradient
+         * \param &dFscdFs: The gradient of the sub-configuration following the first configuration
+         * \param &dF1dF: The gradient of the first configuration w.r.t. the deformation gradient
+         * \param &dF1dFn: The gradient of the first configuration w.r.t. the remaining configurations
          */
 
-        const unsigned int* dim = getDimension( );
+        if ( ( *getDimension( ) ) != 3 ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( computeFirstConfigurationGradients( deformationGradient, dFscdFs, dF1dF, dF1dFn ) );
 
-        _previousdF1dF.second = floatMatrix( ( *dim ) * ( *dim ), floatVector( ( *dim ) * ( *dim ), 0 ) );
+            return;
 
-        _previousdF1dFn.second = floatMatrix( ( *dim ) * ( *dim ), floatVector( ( *dim ) * ( *dim ) * ( ( *getNumConfigurations( ) ) - 1 ), 0 ) );
+        }
+
+        const unsigned int numColumns = 9 * ( ( *getNumConfigurations( ) ) - 1 );
 
-        floatVector eye( ( *dim ) * ( *dim ) );
-        tardigradeVectorTools::eye( eye );
+        floatType flatdF1dF[ 81 ];
 
-        floatVector invFsc = tardigradeVectorTools::inverse( getPreviousFollowingConfiguration( 0 ), ( *dim ), ( *dim ) );
+        _flatdF1dFn.resize( 9 * numColumns );
 
-        floatMatrix dInvFscdFsc = tardigradeVectorTools::computeDInvADA( invFsc, ( *dim ), ( *dim ) );
+        computeFixedSizeFirstConfigurationGradients< 3 >( deformationGradient.data( ), dFscdFs, flatdF1dF, _flatdF1dFn.data( ) );
 
-        floatMatrix dInvFscdFs = tardigradeVectorTools::dot( dInvFscdFsc, getPreviousFollowingConfigurationGradient( 0 ) );
+        dF1dF.resize( 9 );
 
-        // Compute the gradients
-        for ( unsigned int i = 0; i < ( *dim ); i++ ){
+        dF1dFn.resize( 9 );
 
-            for ( unsigned int barI = 0; barI < ( *dim ); barI++ ){
+        for ( unsigned int i = 0; i < 9; i++ ){
 
-                for ( unsigned int a = 0; a < ( *dim ); a++ ){
+            dF1dF[ i ].assign( flatdF1dF + 9 * i, flatdF1dF + 9 * ( i + 1 ) );
 
-                    for ( unsigned int A = 0; A < ( *dim ); A++ ){
+            dF1dFn[ i ].assign( _flatdF1dFn.begin( ) + numColumns * i, _flatdF1dFn.begin( ) + numColumns * ( i + 1 ) );
 
-                        _previousdF1dF.second[ ( *dim ) * i + barI ][ ( * dim ) * a + A ] += eye[ ( *dim ) * i + a ] * invFsc[ ( *dim ) * A + barI ];
+        }
 
-                        for ( unsigned int index = 0; index < ( *getNumConfigurations( ) ) - 1; index++ ){
+    }
 
-                            for ( unsigned int J = 0; J < ( *dim ); J++ ){
+    void hydraBase::setFirstConfigurationGradients( ){
+        /*!
+         * Get the gradient of the first configuration w.r.t. the deformation gradient (the first entry of the pair)
+         * and the remaining gradients (the second entry) i.e.,
+         * 
+         * \f$\text{return.first} = \frac{\partial F^1}{\partial F}\f$
+         * \f$\text{return.second} = \frac{\partial F^1}{\partial F^n}\f$
+         * 
+         * where \f$F^n = F^2, F^3, \cdots\f$
+         */
 
-                                _previousdF1dFn.second[ ( *dim ) * i + barI ][ ( *dim ) * ( *dim ) * index + ( *dim ) * a + A ]
-                                    += ( *getPreviousDeformationGradient( ) )[ ( *dim ) * i + J ]
-                                     * dInvFscdFs[ ( *dim ) * J + barI ][ ( *dim ) * ( *dim ) * ( index + 1 ) + ( *dim ) * a + A ];
+        TARDIGRADE_ERROR_TOOLS_CATCH( formFirstConfigurationGradients( *getDeformationGradient( ), getFollowingConfigurationGradientFactors( 0 ),
+                                                                       _dF1dF.second, _dF1dFn.second ) );
 
-                            }
+        _dF1dF.first = true;
 
-                        }
+        _dF1dFn.first = true;
 
-                    }
+        addIterationData( &_dF1dF );
 
-                }
+        addIterationData( &_dF1dFn );
 
-            }
+    }
 
-        }
+    void hydraBase::setPreviousFirstConfigurationGradients( ){
+        /*!
+         * Get the gradient of the previous first configuration w.r.t. the deformation gradient (the first entry of the pair)
+         * and the remaining gradients (the second entry) i.e.,
+         * 
+         * \f$\text{return.first} = \frac{\partial F^1}{\partial F}\f$
+         * \f$\text{return.second} = \frac{\partial F^1}{\partial F^n}\f$
+         * 
+         * where \f$F^n = F^2, F^3, \cdots\f$
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( formFirstConfigurationGradients( *getPreviousDeformationGradient( ), getPreviousFollowingConfigurationGradientFactors( 0 ),
+                                                                       _previousdF1dF.second, _previousdF1dFn.second ) );
 
         _previousdF1dF.first = true;
 
         _previousdF1dFn.first = true;
 
+        addPointData( &_previousdF1dF );
+
+        addPointData( &_previousdF1dFn );
+
     }
 
     const floatMatrix* hydraBase::getdF1dF( ){
@@ -957,16 +1601,13 @@ namespace tardigradeHydra{
 
     void hydraBase::resetIterationData( ){
         /*!
-         * Reset the iteration data to the new base state
+         * Reset the iteration data to the new base state by incrementing the iteration epoch which invalidates all
+         * of the data bound to it and releasing the iteration workspace
          */
 
-        for ( auto d = _iterationData.begin( ); d != _iterationData.end( ); d++ ){
-
-            ( *d )->clear( );
-
-        }
+        _iterationEpoch++;
 
-        _iterationData.clear( );
+        _iterationArena.reset( );
 
     }
 
@@ -1006,8 +1647,59 @@ namespace tardigradeHydra{
 
         _residualClasses.second = std::vector< residualBase* >( residualClasses.size( ) );
 
+        _explicitEquations.clear( );
+
+        _explicitUnknowns.clear( );
+
+        // The unknown vector is partitioned into blocks for each configuration and the non-linear solve state variables
+        _blockSizes = std::vector< unsigned int >( *getNumConfigurations( ), ( *dim ) * ( *dim ) );
+
+        if ( *getNumNonLinearSolveStateVariables( ) > 0 ){
+
+            _blockSizes.push_back( *getNumNonLinearSolveStateVariables( ) );
+
+        }
+
+        const unsigned int numBlocks = _blockSizes.size( );
+
+        std::vector< unsigned int > blockIndex;
+
+        for ( unsigned int b = 0; b < numBlocks; b++ ){
+
+            blockIndex.insert( blockIndex.end( ), _blockSizes[ b ], b );
+
+        }
+
+        _blockSparsity = std::vector< bool >( numBlocks * numBlocks, false );
+
         for ( auto c = residualClasses.begin( ); c != residualClasses.end( ); c++ ){
 
+            // Mark the blocks of the jacobian which the residual's equations may populate
+            for ( unsigned int i = numEquations; ( i < numEquations + *( *c )->getNumEquations( ) ) && ( i < blockIndex.size( ) ); i++ ){
+
+                if ( ( *c )->getUnknownBlockDependencies( )->size( ) == 0 ){
+
+                    std::fill( _blockSparsity.begin( ) + numBlocks * blockIndex[ i ], _blockSparsity.begin( ) + numBlocks * ( blockIndex[ i ] + 1 ), true );
+
+                }
+
+                for ( auto b = ( *c )->getUnknownBlockDependencies( )->begin( ); b != ( *c )->getUnknownBlockDependencies( )->end( ); b++ ){
+
+                    _blockSparsity[ numBlocks * blockIndex[ i ] + *b ] = true;
+
+                }
+
+            }
+
+            // Collect the unknowns which are defined explicitly so they can be condensed out of the jacobian
+            for ( auto u = ( *c )->getExplicitUnknownIndices( )->begin( ); u != ( *c )->getExplicitUnknownIndices( )->end( ); u++ ){
+
+                _explicitEquations.push_back( numEquations + ( unsigned int )( u - ( *c )->getExplicitUnknownIndices( )->begin( ) ) );
+
+                _explicitUnknowns.push_back( *u );
+
+            }
+
             numEquations += *( *c )->getNumEquations( );
 
             _residualClasses.second[ c - residualClasses.begin( ) ] = *c;
@@ -1026,6 +1718,10 @@ namespace tardigradeHydra{
 
         _residualClasses.first = true;
 
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+        setSolveStatisticsResidualNames( );
+#endif
+
     }
 
     std::vector< residualBase* >* hydraBase::getResidualClasses( ){
@@ -1043,51 +1739,38 @@ namespace tardigradeHydra{
 
     }
 
-    void hydraBase::formNonLinearProblem( ){
+    void hydraBase::formNonLinearResidual( ){
         /*!
-         * Form the residual, jacobian, and gradient matrices
+         * Form the residual of the non-linear problem.
+         *
+         * Only the residual of each of the residual classes is requested so none of
+         * the derivative chains are evaluated. This is what is required to evaluate
+         * the trial points in the line search.
          */
 
         const unsigned int *dim = getDimension( );
 
         unsigned int residualSize = ( *getNumConfigurations( ) ) * ( *dim ) * ( *dim ) + *getNumNonLinearSolveStateVariables( );
 
-        _residual.second = floatVector( residualSize, 0 );
-
-        _jacobian.second = floatVector( residualSize * residualSize, 0 );
-
-        _dRdF.second = floatVector( residualSize * ( *dim ) * ( *dim ), 0 );
-
-        _dRdT.second = floatVector( residualSize, 0 );
-
-        _additionalDerivatives.second.clear( );
+        // Re-use the storage of the previous residual
+        _residual.second.assign( residualSize, 0 );
 
         unsigned int offset = 0;
 
-        unsigned int numAdditionalDerivatives = 0;
-
         for ( auto residual_ptr = getResidualClasses( )->begin( ); residual_ptr != getResidualClasses( )->end( ); residual_ptr++ ){
 
             residualBase *residual = ( *residual_ptr );
 
-            // Extract the terms
-
             const floatVector* localResidual;
-            TARDIGRADE_ERROR_TOOLS_CATCH( localResidual = residual->getResidual( ) );
-
-            const floatMatrix* localJacobian;
-            TARDIGRADE_ERROR_TOOLS_CATCH( localJacobian = residual->getJacobian( ) );
-
-            const floatMatrix* localdRdF;
-            TARDIGRADE_ERROR_TOOLS_CATCH( localdRdF = residual->getdRdF( ) );
-
-            const floatVector* localdRdT;
-            TARDIGRADE_ERROR_TOOLS_CATCH( localdRdT = residual->getdRdT( ) );
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+#endif
 
-            const floatMatrix* localAdditionalDerivatives;
-            TARDIGRADE_ERROR_TOOLS_CATCH( localAdditionalDerivatives = residual->getAdditionalDerivatives( ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( localResidual = residual->getResidual( ) );
 
-            // Check the contributions to make sure they are consistent sizes
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            recordResidualTime( residual_ptr - getResidualClasses( )->begin( ), residualStage::residual, start );
+#endif
 
             if ( localResidual->size( ) != *residual->getNumEquations( ) ){
 
@@ -1099,126 +1782,184 @@ namespace tardigradeHydra{
 
             }
 
-            if ( localJacobian->size( ) != *residual->getNumEquations( ) ){
+            if ( offset + localResidual->size( ) > residualSize ){
 
-                std::string message = "The jacobian for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected length\n";
-                message            += "  expected: " + std::to_string( *residual->getNumEquations( ) ) + "\n";
-                message            += "  actual:   " + std::to_string( localJacobian->size( ) ) + "\n";
+                std::string message = "The residual classes define more equations than the expected residual size\n";
+                message            += "  expected: " + std::to_string( residualSize ) + "\n";
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
 
             }
 
-            if ( localdRdF->size( ) != *residual->getNumEquations( ) ){
+            std::copy( localResidual->begin( ), localResidual->end( ), _residual.second.begin( ) + offset );
 
-                std::string message = "dRdF for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected length\n";
-                message            += "  expected: " + std::to_string( *residual->getNumEquations( ) ) + "\n";
-                message            += "  actual:   " + std::to_string( localdRdF->size( ) ) + "\n";
+            offset += *residual->getNumEquations( );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+        }
 
-            }
+        _residual.first = true;
 
-            if ( localdRdT->size( ) != *residual->getNumEquations( ) ){
+        addIterationData( &_residual );
 
-                std::string message = "dRdT for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected length\n";
-                message            += "  expected: " + std::to_string( *residual->getNumEquations( ) ) + "\n";
-                message            += "  actual:   " + std::to_string( localdRdT->size( ) ) + "\n";
+    }
+
+    void hydraBase::formNonLinearJacobian( ){
+        /*!
+         * Form the jacobian of the non-linear problem.
+         *
+         * Only the jacobian of each of the residual classes is requested which is all
+         * that is required to compute the Newton update.
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        unsigned int residualSize = ( *getNumConfigurations( ) ) * ( *dim ) * ( *dim ) + *getNumNonLinearSolveStateVariables( );
+
+        // Re-use the storage of the previous jacobian
+        _jacobian.second.assign( residualSize * residualSize, 0 );
+
+        unsigned int offset = 0;
+
+        for ( auto residual_ptr = getResidualClasses( )->begin( ); residual_ptr != getResidualClasses( )->end( ); residual_ptr++ ){
+
+            residualBase *residual = ( *residual_ptr );
+
+            const floatVector* localJacobian;
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+#endif
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( localJacobian = residual->getFlatJacobian( ) );
+
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            recordResidualTime( residual_ptr - getResidualClasses( )->begin( ), residualStage::jacobian, start );
+#endif
+
+            if ( localJacobian->size( ) != ( *residual->getNumEquations( ) ) * residualSize ){
+
+                std::string message = "The jacobian for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected size\n";
+                message            += "  expected: " + std::to_string( ( *residual->getNumEquations( ) ) * residualSize ) + "\n";
+                message            += "  actual:   " + std::to_string( localJacobian->size( ) ) + "\n";
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
 
             }
 
-            if ( localAdditionalDerivatives->size( ) != 0 ){
+            // The residual's rows are contiguous in the row-major jacobian so they may be copied as a single block
+            std::copy( localJacobian->begin( ), localJacobian->end( ), _jacobian.second.begin( ) + residualSize * offset );
 
-                if ( localAdditionalDerivatives->size( ) != *residual->getNumEquations( ) ){
+            offset += *residual->getNumEquations( );
 
-                    std::string message = "additionalDerivatives for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected length\n";
-                    message            += "  expected: " + std::to_string( *residual->getNumEquations( ) ) + "\n";
-                    message            += "  actual:   " + std::to_string( localAdditionalDerivatives->size( ) ) + "\n";
-    
-                    TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+        }
 
-                }
+        _jacobian.first = true;
 
-                if ( ( *localAdditionalDerivatives )[ 0 ].size( ) != numAdditionalDerivatives ){
-    
-                    if ( ( residual_ptr - getResidualClasses( )->begin( ) ) == 0 ){
-    
-                        numAdditionalDerivatives = ( *localAdditionalDerivatives )[ 0 ].size( );
-    
-                        _additionalDerivatives.second = floatVector( residualSize * numAdditionalDerivatives, 0 );
-    
-                    }
-                    else{
-    
-                        std::string message = "The additional derivatives for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " are not the expected length as determined from the first residual\n";
-                        message            += "  expected: " + std::to_string( numAdditionalDerivatives ) + "\n";
-                        message            += "  actual:   " + std::to_string( ( *localAdditionalDerivatives )[ 0 ].size( ) ) + "\n";
-    
-                        TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
-    
-                    }
-    
-                }
+        addIterationData( &_jacobian );
 
-            }
+    }
 
-            // Store the values in the global quantities
+    void hydraBase::formNonLinearDerivatives( ){
+        /*!
+         * Form the derivatives of the residual of the non-linear problem w.r.t. the deformation gradient,
+         * the temperature, and any additional quantities.
+         *
+         * These are only required once the non-linear problem has converged (i.e. to compute the
+         * consistent tangent) and so are not assembled during the Newton iterations.
+         */
 
-            for ( unsigned int row = 0; row < *residual->getNumEquations( ); row++ ){
+        const unsigned int *dim = getDimension( );
 
-                _residual.second[ row + offset ] = ( *localResidual )[ row ];
+        unsigned int residualSize = ( *getNumConfigurations( ) ) * ( *dim ) * ( *dim ) + *getNumNonLinearSolveStateVariables( );
 
-                if ( ( *localJacobian )[ row ].size( ) != residualSize ){
+        _dRdF.second = floatVector( residualSize * ( *dim ) * ( *dim ), 0 );
 
-                    std::string message = "Row " + std::to_string( row ) + " of the jacobian for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected length\n";
-                    message            += "  expected: " + std::to_string( residualSize ) + "\n";
-                    message            += "  actual:   " + std::to_string( ( *localJacobian )[ row ].size( ) ) + "\n";
+        _dRdT.second = floatVector( residualSize, 0 );
 
-                    TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+        _additionalDerivatives.second.clear( );
 
-                }
+        unsigned int offset = 0;
 
-                for ( unsigned int col = 0; col < residualSize; col++ ){
-                
-                    _jacobian.second[ residualSize * ( row + offset ) + col ] = ( *localJacobian )[ row ][ col ];
+        unsigned int numAdditionalDerivatives = 0;
 
-                }
+        for ( auto residual_ptr = getResidualClasses( )->begin( ); residual_ptr != getResidualClasses( )->end( ); residual_ptr++ ){
 
-                if ( ( *localdRdF )[ row ].size( ) != ( *dim ) * ( *dim ) ){
+            residualBase *residual = ( *residual_ptr );
+
+            // Extract the terms
 
-                    std::string message = "Row " + std::to_string( row ) + " of dRdF for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected length\n";
-                    message            += "  expected: " + std::to_string( ( *dim ) * ( *dim ) ) + "\n";
-                    message            += "  actual:   " + std::to_string( ( *localJacobian )[ row ].size( ) ) + "\n";
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now( );
+#endif
 
-                    TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+            const floatVector* localdRdF;
+            TARDIGRADE_ERROR_TOOLS_CATCH( localdRdF = residual->getFlatdRdF( ) );
 
-                }
+            const floatVector* localdRdT;
+            TARDIGRADE_ERROR_TOOLS_CATCH( localdRdT = residual->getdRdT( ) );
 
-                for ( unsigned int col = 0; col < ( *dim ) * ( *dim ); col++ ){
+            const floatVector* localAdditionalDerivatives;
+            TARDIGRADE_ERROR_TOOLS_CATCH( localAdditionalDerivatives = residual->getFlatAdditionalDerivatives( ) );
 
-                    _dRdF.second[ ( *dim ) * ( *dim ) * ( row + offset ) + col ] = ( *localdRdF )[ row ][ col ];
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            recordResidualTime( residual_ptr - getResidualClasses( )->begin( ), residualStage::derivatives, start );
+#endif
 
-                }
+            // Check the contributions to make sure they are consistent sizes
+
+            if ( localdRdF->size( ) != ( *residual->getNumEquations( ) ) * ( *dim ) * ( *dim ) ){
+
+                std::string message = "dRdF for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected size\n";
+                message            += "  expected: " + std::to_string( ( *residual->getNumEquations( ) ) * ( *dim ) * ( *dim ) ) + "\n";
+                message            += "  actual:   " + std::to_string( localdRdF->size( ) ) + "\n";
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
+
+            if ( localdRdT->size( ) != *residual->getNumEquations( ) ){
+
+                std::string message = "dRdT for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " is not the expected length\n";
+                message            += "  expected: " + std::to_string( *residual->getNumEquations( ) ) + "\n";
+                message            += "  actual:   " + std::to_string( localdRdT->size( ) ) + "\n";
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
 
-                _dRdT.second[ row + offset ] = ( *localdRdT )[ row ];
+            if ( ( residual_ptr - getResidualClasses( )->begin( ) ) == 0 ){
 
-                for ( unsigned int col = 0; col < numAdditionalDerivatives; col++ ){
+                if ( ( *residual->getNumEquations( ) ) > 0 ){
 
-                    _additionalDerivatives.second[ numAdditionalDerivatives * ( row + offset ) + col ] = ( *localAdditionalDerivatives )[ row ][ col ];
+                    numAdditionalDerivatives = localAdditionalDerivatives->size( ) / ( *residual->getNumEquations( ) );
 
                 }
 
+                _additionalDerivatives.second = floatVector( residualSize * numAdditionalDerivatives, 0 );
+
             }
 
-            offset += *residual->getNumEquations( );
+            if ( ( localAdditionalDerivatives->size( ) != 0 ) && ( localAdditionalDerivatives->size( ) != ( *residual->getNumEquations( ) ) * numAdditionalDerivatives ) ){
 
-        }
+                std::string message = "The additional derivatives for residual " + std::to_string( residual_ptr - getResidualClasses( )->begin( ) ) + " are not the expected size as determined from the first residual\n";
+                message            += "  expected: " + std::to_string( ( *residual->getNumEquations( ) ) * numAdditionalDerivatives ) + "\n";
+                message            += "  actual:   " + std::to_string( localAdditionalDerivatives->size( ) ) + "\n";
 
-        _residual.first = true;
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
 
-        _jacobian.first = true;
+            }
+
+            // Store the values in the global quantities. The rows of each residual are contiguous in the
+            // row-major global quantities so they may be copied as single blocks
+
+            std::copy( localdRdF->begin( ), localdRdF->end( ), _dRdF.second.begin( ) + ( *dim ) * ( *dim ) * offset );
+
+            std::copy( localdRdT->begin( ), localdRdT->end( ), _dRdT.second.begin( ) + offset );
+
+            std::copy( localAdditionalDerivatives->begin( ), localAdditionalDerivatives->end( ), _additionalDerivatives.second.begin( ) + numAdditionalDerivatives * offset );
+
+            offset += *residual->getNumEquations( );
+
+        }
 
         _dRdF.first = true;
 
@@ -1226,10 +1967,6 @@ namespace tardigradeHydra{
 
         _additionalDerivatives.first = true;
 
-        addIterationData( &_residual );
-
-        addIterationData( &_jacobian );
-
         addIterationData( &_dRdF );
 
         addIterationData( &_dRdT );
@@ -1238,6 +1975,19 @@ namespace tardigradeHydra{
 
     }
 
+    void hydraBase::formNonLinearProblem( ){
+        /*!
+         * Form the residual, jacobian, and gradient matrices of the non-linear problem.
+         */
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( getResidual( ) );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearJacobian( ) );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearDerivatives( ) );
+
+    }
+
     const floatVector* hydraBase::getResidual( ){
         /*!
          * Get the residual vector for the non-linear problem
@@ -1245,7 +1995,7 @@ namespace tardigradeHydra{
 
         if ( !_residual.first ){
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearProblem( ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearResidual( ) );
 
         }
 
@@ -1260,7 +2010,7 @@ namespace tardigradeHydra{
 
         if ( !_jacobian.first ){
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearProblem( ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearJacobian( ) );
 
         }
 
@@ -1284,7 +2034,7 @@ namespace tardigradeHydra{
 
         if ( !_dRdF.first ){
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearProblem( ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearDerivatives( ) );
 
         }
 
@@ -1307,7 +2057,7 @@ namespace tardigradeHydra{
 
         if ( !_dRdT.first ){
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearProblem( ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearDerivatives( ) );
 
         }
 
@@ -1322,7 +2072,7 @@ namespace tardigradeHydra{
 
         if ( !_additionalDerivatives.first ){
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearProblem( ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( formNonLinearDerivatives( ) );
 
         }
 
@@ -1398,6 +2148,8 @@ namespace tardigradeHydra{
 
             _previousCauchyStress.first = true;
 
+            addPointData( &_previousCauchyStress );
+
         }
 
         return &_previousCauchyStress.second;
@@ -1412,6 +2164,9 @@ namespace tardigradeHydra{
          * 
          * It is assumed that the first residual calculation also has a method `void getCauchyStress( )`
          * which returns a pointer to the current value of the Cauchy stress.
+         *
+         * If the symmetric formulation of the Cauchy stress is used the initial stress is symmetrized so that the
+         * iterations remain on the symmetric stresses.
          */
 
         const floatVector *cauchyStress;
@@ -1425,19 +2180,37 @@ namespace tardigradeHydra{
 
         Xmat[ 0 ] = *cauchyStress;
 
-        for ( unsigned int i = 1; i < configurations->size( ); i++ ){
+        if ( _symmetricCauchyStress && ( *getDimension( ) == 3 ) ){
 
-            Xmat[ i ] = ( *configurations )[ i ];
+            for ( unsigned int i = 0; i < 3; i++ ){
 
-        }
+                for ( unsigned int j = i + 1; j < 3; j++ ){
 
-        Xmat[ Xmat.size( ) - 1 ] = *nonLinearSolveStateVariables;
+                    Xmat[ 0 ][ 3 * i + j ] = 0.5 * ( ( *cauchyStress )[ 3 * i + j ] + ( *cauchyStress )[ 3 * j + i ] );
 
-        _X.second = tardigradeVectorTools::appendVectors( Xmat );
+                    Xmat[ 0 ][ 3 * j + i ] = Xmat[ 0 ][ 3 * i + j ];
 
-        _X.first = true;
+                }
 
-    }
+            }
+
+        }
+
+        for ( unsigned int i = 1; i < configurations->size( ); i++ ){
+
+            Xmat[ i ] = ( *configurations )[ i ];
+
+        }
+
+        Xmat[ Xmat.size( ) - 1 ] = *nonLinearSolveStateVariables;
+
+        _X.second = tardigradeVectorTools::appendVectors( Xmat );
+
+        _X.first = true;
+
+        addPointData( &_X );
+
+    }
 
     const floatVector* hydraBase::getUnknownVector( ){
         /*!
@@ -1480,6 +2253,8 @@ namespace tardigradeHydra{
 
         _tolerance.first = true;
 
+        addPointData( &_tolerance );
+
     }
 
     const floatVector* hydraBase::getTolerance( ){
@@ -1575,123 +2350,2977 @@ namespace tardigradeHydra{
 
         _X.first = true;
 
+        addPointData( &_X );
+
         // Decompose the unknown vector and update the state
         TARDIGRADE_ERROR_TOOLS_CATCH( decomposeUnknownVector( ) );
 
     }
 
-    void hydraBase::solveNonLinearProblem( ){
+    void hydraBase::setJacobianFactorization( ){
         /*!
-         * Solve the non-linear problem
+         * Set the partial-pivoting LU factorization of the jacobian of the non-linear problem.
+         *
+         * The jacobian is judged to be singular if the estimate of the reciprocal condition number of the
+         * jacobian is not larger than machine epsilon. The estimate uses the factorization so it is
+         * much less expensive than a rank-revealing decomposition.
          */
 
-        // Form the initial unknown vector
-        TARDIGRADE_ERROR_TOOLS_CATCH( initializeUnknownVector( ) );
+        const floatVector *flatJacobian;
+        TARDIGRADE_ERROR_TOOLS_CATCH( flatJacobian = getFlatJacobian( ) );
+
+        const unsigned int numUnknowns = getResidual( )->size( );
+
+        if ( flatJacobian->size( ) != numUnknowns * numUnknowns ){
+
+            std::string message = "The jacobian is not the expected size\n";
+            message            += "  expected: " + std::to_string( numUnknowns * numUnknowns ) + "\n";
+            message            += "  actual:   " + std::to_string( flatJacobian->size( ) ) + "\n";
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+        }
+
+        _jacobianFactorization.second.compute( *flatJacobian, numUnknowns, _explicitEquations, _explicitUnknowns, _blockSizes, _blockSparsity,
+                                               _symmetricCauchyStress && ( *getDimension( ) == 3 ) );
+
+        if ( !( _jacobianFactorization.second.rcond( ) > std::numeric_limits< floatType >::epsilon( ) ) ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "The Jacobian is not full rank" ) );
+
+        }
+
+        _jacobianFactorization.first = true;
+
+        // Factorizations at the converged solution (e.g., for the consistent tangent) are counted separately
+        if ( _isIterating ){
+
+            _numJacobianFactorizations++;
+
+        }
+        else{
+
+            _numTangentFactorizations++;
+
+        }
+
+        addIterationData( &_jacobianFactorization );
+
+    }
+
+    void jacobianFactorization::compute( const floatVector &jacobian, const unsigned int &numUnknowns,
+                                         const std::vector< unsigned int > &explicitEquations, const std::vector< unsigned int > &explicitUnknowns,
+                                         const std::vector< unsigned int > &blockSizes, const std::vector< bool > &blockSparsity,
+                                         const bool symmetricStress ){
+        /*!
+         * Factor the jacobian. The explicit unknowns are condensed out of the system if the rows of their equations
+         * in the jacobian are of the expected form (i.e., -1 for the unknown they define and zero otherwise). If they
+         * are not the full jacobian is factored.
+         *
+         * The intermediate quantities are stored in workspace owned by the factorization so no memory is allocated
+         * once the size and the structure of the jacobian stop changing.
+         *
+         * \param &jacobian: The jacobian in row-major form
+         * \param &numUnknowns: The number of unknowns
+         * \param &explicitEquations: The equations which define the explicit unknowns
+         * \param &explicitUnknowns: The explicit unknowns defined by each of the explicit equations
+         * \param &blockSizes: The sizes of the blocks of unknowns. The equations are assumed to be partitioned in the
+         *     same way. If empty the jacobian is treated as dense.
+         * \param &blockSparsity: The row-major flags for whether each block of the jacobian may be non-zero. Must be
+         *     of size blockSizes.size( ) x blockSizes.size( ).
+         * \param symmetricStress: Flag for whether the first nine unknowns are the components of a symmetric stress
+         *     which are reduced to their six independent components. Ignored if the stress equations of the jacobian
+         *     are not symmetric (see hasSymmetricStressEquations).
+         */
+
+        _useSymmetricStress = false;
+
+        if ( symmetricStress && ( numUnknowns >= 9 ) && hasSymmetricStressEquations( jacobian, numUnknowns ) ){
+
+            computeSymmetricStress( jacobian, numUnknowns, explicitEquations, explicitUnknowns, blockSizes, blockSparsity );
+
+            return;
+
+        }
+
+        Eigen::Map< const floatRowMajorMatrix > J( jacobian.data( ), numUnknowns, numUnknowns );
+
+        _explicitEquations = explicitEquations;
+
+        _explicitUnknowns = explicitUnknowns;
+
+        // The flags are members so that their storage is re-used by later factorizations
+        std::vector< bool > &isExplicitEquation = _isExplicitEquation;
+
+        std::vector< bool > &isExplicitUnknown = _isExplicitUnknown;
+
+        isExplicitEquation.assign( numUnknowns, false );
 
-        unsigned int rank;
+        isExplicitUnknown.assign( numUnknowns, false );
 
-        floatVector deltaX;
+        bool canCondense = ( explicitEquations.size( ) == explicitUnknowns.size( ) ) && ( explicitUnknowns.size( ) < numUnknowns );
 
-        resetLSIteration( );
+        for ( unsigned int i = 0; canCondense && ( i < explicitEquations.size( ) ); i++ ){
 
-        while( !checkConvergence( ) && checkIteration( ) ){
+            if ( ( explicitEquations[ i ] >= numUnknowns ) || ( explicitUnknowns[ i ] >= numUnknowns ) ||
+                 isExplicitEquation[ explicitEquations[ i ] ] || isExplicitUnknown[ explicitUnknowns[ i ] ] ){
 
-            floatVector X0 = *getUnknownVector( );
+                canCondense = false;
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( deltaX = -tardigradeVectorTools::solveLinearSystem( *getFlatJacobian( ), *getResidual( ),
-                                                                         getResidual( )->size( ), getResidual( )->size( ), rank ) );
+                break;
 
-            if ( rank != getResidual( )->size( ) ){
+            }
+
+            isExplicitEquation[ explicitEquations[ i ] ] = true;
+
+            isExplicitUnknown[ explicitUnknowns[ i ] ] = true;
+
+            for ( unsigned int j = 0; j < numUnknowns; j++ ){
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "The Jacobian is not full rank" ) );
+                if ( J( explicitEquations[ i ], j ) != ( j == explicitUnknowns[ i ] ? -1. : 0. ) ){
+
+                    canCondense = false;
+
+                    break;
+
+                }
 
             }
 
-            updateUnknownVector( X0 + *getLambda( ) * deltaX );
+        }
+
+        if ( !canCondense ){
+
+            _explicitEquations.clear( );
+
+            _explicitUnknowns.clear( );
+
+            std::fill( isExplicitEquation.begin( ), isExplicitEquation.end( ), false );
+
+            std::fill( isExplicitUnknown.begin( ), isExplicitUnknown.end( ), false );
+
+        }
+
+        _implicitEquations.clear( );
 
-            while ( !checkLSConvergence( ) && checkLSIteration( ) ){
+        _implicitUnknowns.clear( );
 
-                updateLambda( );
+        for ( unsigned int i = 0; i < numUnknowns; i++ ){
 
-                incrementLSIteration( );
+            if ( !isExplicitEquation[ i ] ){
 
-                updateUnknownVector( X0 + *getLambda( ) * deltaX );
+                _implicitEquations.push_back( i );
 
             }
 
-            if ( !checkLSConvergence( ) ){
+            if ( !isExplicitUnknown[ i ] ){
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw convergence_error( "Failure in line search" ) );
+                _implicitUnknowns.push_back( i );
 
             }
 
-            resetLSIteration( );
+        }
+
+        // Determine the block structure of the implicit system. The implicit equations and unknowns must be
+        // partitioned into the same blocks for the block elimination to be used.
+        _reducedBlockSizes.clear( );
+
+        _reducedBlockSparsity.clear( );
+
+        const unsigned int numBlocks = blockSizes.size( );
+
+        if ( ( numBlocks > 1 ) && ( blockSparsity.size( ) == numBlocks * numBlocks ) &&
+             ( std::accumulate( blockSizes.begin( ), blockSizes.end( ), 0u ) == numUnknowns ) ){
+
+            _blockIndex.resize( numUnknowns );
+
+            for ( unsigned int b = 0, offset = 0; b < numBlocks; offset += blockSizes[ b ], b++ ){
+
+                std::fill( _blockIndex.begin( ) + offset, _blockIndex.begin( ) + offset + blockSizes[ b ], b );
+
+            }
+
+            _reducedBlockIndices.clear( );
+
+            bool isConsistent = true;
+
+            for ( unsigned int i = 0; i < _implicitUnknowns.size( ); i++ ){
+
+                if ( _blockIndex[ _implicitUnknowns[ i ] ] != _blockIndex[ _implicitEquations[ i ] ] ){
 
-            // Increment the iteration count
-            incrementIteration( );
+                    isConsistent = false;
+
+                    break;
+
+                }
+
+                if ( ( _reducedBlockIndices.size( ) == 0 ) || ( _reducedBlockIndices.back( ) != _blockIndex[ _implicitUnknowns[ i ] ] ) ){
+
+                    _reducedBlockIndices.push_back( _blockIndex[ _implicitUnknowns[ i ] ] );
+
+                    _reducedBlockSizes.push_back( 0 );
+
+                }
+
+                _reducedBlockSizes.back( )++;
+
+            }
+
+            if ( isConsistent ){
+
+                const unsigned int numReducedBlocks = _reducedBlockIndices.size( );
+
+                _reducedBlockSparsity.assign( numReducedBlocks * numReducedBlocks, true );
+
+                for ( unsigned int a = 0; a < numReducedBlocks; a++ ){
+
+                    for ( unsigned int b = 0; b < numReducedBlocks; b++ ){
+
+                        _reducedBlockSparsity[ numReducedBlocks * a + b ] = blockSparsity[ numBlocks * _reducedBlockIndices[ a ] + _reducedBlockIndices[ b ] ];
+
+                    }
+
+                }
+
+            }
+            else{
+
+                _reducedBlockSizes.clear( );
+
+            }
 
         }
 
-        if ( !checkConvergence( ) ){
+        if ( _explicitUnknowns.size( ) == 0 ){
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( throw convergence_error( "Failure to converge main loop" ) );
+            _implicitExplicitBlock.resize( 0, 0 );
+
+            factorImplicitSystem( J, _reducedBlockSizes, _reducedBlockSparsity );
+
+            return;
 
         }
 
-        // Set the tolerance
-        TARDIGRADE_ERROR_TOOLS_CATCH( setTolerance( ) );
+        _reducedJacobian.resize( _implicitEquations.size( ), _implicitUnknowns.size( ) );
+
+        _implicitExplicitBlock.resize( _implicitEquations.size( ), _explicitUnknowns.size( ) );
+
+        for ( unsigned int i = 0; i < _implicitEquations.size( ); i++ ){
+
+            for ( unsigned int j = 0; j < _implicitUnknowns.size( ); j++ ){
+
+                _reducedJacobian( i, j ) = J( _implicitEquations[ i ], _implicitUnknowns[ j ] );
+
+            }
+
+            for ( unsigned int j = 0; j < _explicitUnknowns.size( ); j++ ){
+
+                _implicitExplicitBlock( i, j ) = J( _implicitEquations[ i ], _explicitUnknowns[ j ] );
+
+            }
+
+        }
+
+        factorImplicitSystem( _reducedJacobian, _reducedBlockSizes, _reducedBlockSparsity );
 
     }
 
-    void hydraBase::evaluate( ){
+    bool jacobianFactorization::hasSymmetricStressEquations( const floatVector &jacobian, const unsigned int &numUnknowns ) const{
         /*!
-         * Solve the non-linear problem and update the variables
+         * Check if each symmetric pair of stress equations is the same equation on the symmetric stresses i.e., if
+         * the rows of the pair are equal once the columns of the symmetric pairs of the stress unknowns are summed.
+         * If they are not (e.g., a residual class computes a stress which isn't symmetric) averaging the pair does not
+         * give an equivalent system and the stress unknowns can't be reduced.
+         *
+         * \param &jacobian: The jacobian in row-major form
+         * \param &numUnknowns: The number of unknowns
          */
 
-        TARDIGRADE_ERROR_TOOLS_CATCH( solveNonLinearProblem( ) );
+        constexpr floatType relativeTolerance = 1e-8;
+
+        Eigen::Map< const floatRowMajorMatrix > J( jacobian.data( ), numUnknowns, numUnknowns );
+
+        // Only the off-diagonal stress equations have a distinct symmetric pair
+        for ( unsigned int v = 3; v < 6; v++ ){
+
+            const unsigned int row = getSymmetricStressIndex( v );
+
+            const unsigned int mirror = getSymmetricStressMirrorIndex( v );
+
+            const floatType tolerance = relativeTolerance * std::max( J.row( row ).cwiseAbs( ).maxCoeff( ), J.row( mirror ).cwiseAbs( ).maxCoeff( ) );
+
+            for ( unsigned int w = 0; w < 6; w++ ){
+
+                const unsigned int col = getSymmetricStressIndex( w );
+
+                const unsigned int colMirror = getSymmetricStressMirrorIndex( w );
+
+                floatType difference = J( row, col ) - J( mirror, col );
+
+                if ( colMirror != col ){
+
+                    difference += J( row, colMirror ) - J( mirror, colMirror );
+
+                }
+
+                if ( std::fabs( difference ) > tolerance ){
+
+                    return false;
+
+                }
+
+            }
+
+            for ( unsigned int k = 9; k < numUnknowns; k++ ){
+
+                if ( std::fabs( J( row, k ) - J( mirror, k ) ) > tolerance ){
+
+                    return false;
+
+                }
+
+            }
+
+        }
+
+        return true;
 
     }
 
-    errorOut dummyMaterialModel( floatVector &stress,             floatVector &statev,        floatMatrix &ddsdde,       floatType &SSE,            floatType &SPD,
-                                 floatType &SCD,                  floatType &RPL,             floatVector &ddsddt,       floatVector &drplde,       floatType &DRPLDT,
-                                 const floatVector &strain,       const floatVector &dstrain, const floatVector &time,   const floatType &DTIME,    const floatType &TEMP,
-                                 const floatType &DTEMP,          const floatVector &predef,  const floatVector &dpred,  const std::string &cmname, const int &NDI,
-                                 const int &NSHR,                 const int &NTENS,           const int &NSTATV,         const floatVector &props,  const int &NPROPS,
-                                 const floatVector &coords,       const floatMatrix &drot,    floatType &PNEWDT,         const floatType &CELENT,   const floatMatrix &dfgrd0,
-                                 const floatMatrix &dfgrd1,       const int &NOEL,            const int &NPT,            const int &LAYER,          const int &KSPT,
-                                 const std::vector< int > &jstep, const int &KINC ){
+    void jacobianFactorization::computeSymmetricStress( const floatVector &jacobian, const unsigned int &numUnknowns,
+                                                        const std::vector< unsigned int > &explicitEquations, const std::vector< unsigned int > &explicitUnknowns,
+                                                        const std::vector< unsigned int > &blockSizes, const std::vector< bool > &blockSparsity ){
         /*!
-         * A template Abaqus c++ UMAT using c++ STL types. Variables in all caps reference ABAQUS FORTRAN
-         * memory directly. Variables in lower case are native c++ type conversions stored separately from the original
-         * ABAQUS FORTRAN memory.
+         * Factor the jacobian with the stress unknowns reduced to their six independent components. The reduced
+         * jacobian is \f$ Q J P \f$ where \f$ P \f$ copies each reduced stress unknown to the stress component and its
+         * transpose and \f$ Q \f$ averages the symmetric pairs of the stress equations.
+         *
+         * \param &jacobian: The jacobian in row-major form
+         * \param &numUnknowns: The number of unknowns
+         * \param &explicitEquations: The equations which define the explicit unknowns
+         * \param &explicitUnknowns: The explicit unknowns defined by each of the explicit equations
+         * \param &blockSizes: The sizes of the blocks of unknowns
+         * \param &blockSparsity: The row-major flags for whether each block of the jacobian may be non-zero
          */
 
-        //Call functions of constitutive model to do things
-        errorOut error = sayHello( "Abaqus" );
+        const unsigned int numReducedUnknowns = numUnknowns - 3;
+
+        Eigen::Map< const floatRowMajorMatrix > J( jacobian.data( ), numUnknowns, numUnknowns );
+
+        _symmetricJacobian.resize( numReducedUnknowns * numReducedUnknowns );
+
+        Eigen::Map< floatRowMajorMatrix > reducedJacobian( _symmetricJacobian.data( ), numReducedUnknowns, numReducedUnknowns );
+
+        // Average the symmetric pairs of the stress equations and sum the columns of the symmetric pairs of the stress unknowns
+        for ( unsigned int v = 0; v < 6; v++ ){
+
+            const unsigned int row = getSymmetricStressIndex( v );
+
+            const unsigned int mirror = getSymmetricStressMirrorIndex( v );
+
+            for ( unsigned int w = 0; w < 6; w++ ){
+
+                const unsigned int col = getSymmetricStressIndex( w );
+
+                const unsigned int colMirror = getSymmetricStressMirrorIndex( w );
+
+                reducedJacobian( v, w ) = 0.5 * ( J( row, col ) + J( mirror, col ) );
+
+                if ( colMirror != col ){
+
+                    reducedJacobian( v, w ) += 0.5 * ( J( row, colMirror ) + J( mirror, colMirror ) );
+
+                }
+
+            }
+
+            reducedJacobian.row( v ).tail( numUnknowns - 9 ) = 0.5 * ( J.row( row ).tail( numUnknowns - 9 ) + J.row( mirror ).tail( numUnknowns - 9 ) );
 
-        //Error handling
-        if ( error ){
-            errorOut result = new errorNode( __func__, "Error when calling sayHello" );
-            result->addNext( error );
-            return result;
         }
 
-        return NULL;
+        for ( unsigned int i = 9; i < numUnknowns; i++ ){
+
+            for ( unsigned int w = 0; w < 6; w++ ){
+
+                const unsigned int col = getSymmetricStressIndex( w );
+
+                const unsigned int colMirror = getSymmetricStressMirrorIndex( w );
+
+                reducedJacobian( i - 3, w ) = J( i, col ) + ( ( colMirror != col ) ? J( i, colMirror ) : 0 );
+
+            }
+
+            reducedJacobian.row( i - 3 ).tail( numUnknowns - 9 ) = J.row( i ).tail( numUnknowns - 9 );
+
+        }
+
+        // Map the explicit equations and unknowns to the reduced system. Explicit stress equations and unknowns are
+        // represented by their upper triangular component.
+        constexpr unsigned int reducedStressIndices[ 9 ] = { 0, 5, 4, 5, 1, 3, 4, 3, 2 };
+
+        constexpr bool isLowerStressIndex[ 9 ] = { false, false, false, true, false, false, true, true, false };
+
+        _symmetricExplicitEquations.clear( );
+
+        _symmetricExplicitUnknowns.clear( );
+
+        for ( unsigned int i = 0; i < std::min( explicitEquations.size( ), explicitUnknowns.size( ) ); i++ ){
+
+            if ( ( ( explicitEquations[ i ] < 9 ) && isLowerStressIndex[ explicitEquations[ i ] ] ) ||
+                 ( ( explicitUnknowns[ i ] < 9 ) && isLowerStressIndex[ explicitUnknowns[ i ] ] ) ){
+
+                continue;
+
+            }
+
+            _symmetricExplicitEquations.push_back( ( explicitEquations[ i ] < 9 ) ? reducedStressIndices[ explicitEquations[ i ] ] : explicitEquations[ i ] - 3 );
+
+            _symmetricExplicitUnknowns.push_back( ( explicitUnknowns[ i ] < 9 ) ? reducedStressIndices[ explicitUnknowns[ i ] ] : explicitUnknowns[ i ] - 3 );
+
+        }
+
+        // The stress is the first block of unknowns
+        _symmetricBlockSizes.clear( );
+
+        if ( ( blockSizes.size( ) > 0 ) && ( blockSizes[ 0 ] == 9 ) ){
+
+            _symmetricBlockSizes = blockSizes;
+
+            _symmetricBlockSizes[ 0 ] = 6;
+
+        }
+
+        compute( _symmetricJacobian, numReducedUnknowns, _symmetricExplicitEquations, _symmetricExplicitUnknowns, _symmetricBlockSizes,
+                 blockSparsity );
+
+        _useSymmetricStress = true;
+
     }
 
-    void abaqusInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
-                          double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
-                          const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
-                          const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
-                          const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
-                          const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
-                          const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
-                          const int *JSTEP,     const int &KINC ){
+    void jacobianFactorization::factorImplicitSystem( const Eigen::Ref< const floatRowMajorMatrix > &jacobian, const std::vector< unsigned int > &blockSizes,
+                                                      const std::vector< bool > &blockSparsity ){
         /*!
-         * A template Abaqus UMAT c++ interface that performs Fortran to C++ type conversions, calculates the material
-         * model's expected input, handles tensor shape changes, and calls a c++ material model.
+         * Factor the jacobian of the implicit unknowns.
+         *
+         * If the jacobian has blocks which are identically zero it is factored by block elimination. At each step the
+         * remaining block with the fewest non-zero couplings is eliminated (to minimize fill-in), its diagonal block is
+         * factored, and the Schur complement of the remaining blocks is formed only for the non-zero blocks. Otherwise,
+         * or if the declared sparsity doesn't match the jacobian or a diagonal block is singular, the jacobian is
+         * factored as a dense matrix.
+         *
+         * The blocks and their factorizations are overwritten in place so their storage is re-used by later
+         * factorizations of jacobians with the same structure.
+         *
+         * \param &jacobian: The jacobian of the implicit unknowns
+         * \param &blockSizes: The sizes of the blocks of the implicit unknowns
+         * \param &blockSparsity: The row-major flags for whether each block of the jacobian may be non-zero
          */
 
+        const unsigned int numBlocks = blockSizes.size( );
+
+        _useBlockElimination = false;
+
+        bool isSparse = ( numBlocks > 1 ) && ( blockSparsity.size( ) == numBlocks * numBlocks ) &&
+                        ( std::find( blockSparsity.begin( ), blockSparsity.end( ), false ) != blockSparsity.end( ) );
+
+        _blockOffsets.assign( numBlocks, 0 );
+
+        _blockSizes = blockSizes;
+
+        for ( unsigned int b = 1; b < numBlocks; b++ ){
+
+            _blockOffsets[ b ] = _blockOffsets[ b - 1 ] + blockSizes[ b - 1 ];
+
+        }
+
+        // Check that the blocks which are declared to be zero are zero
+        std::vector< bool > &isNonZero = _isNonZeroBlock;
+
+        isNonZero.assign( blockSparsity.begin( ), blockSparsity.end( ) );
+
+        for ( unsigned int a = 0; isSparse && ( a < numBlocks ); a++ ){
+
+            isNonZero[ numBlocks * a + a ] = true;
+
+            for ( unsigned int b = 0; b < numBlocks; b++ ){
+
+                if ( !isNonZero[ numBlocks * a + b ] && !jacobian.block( _blockOffsets[ a ], _blockOffsets[ b ], blockSizes[ a ], blockSizes[ b ] ).isZero( 0 ) ){
+
+                    isSparse = false;
+
+                    break;
+
+                }
+
+            }
+
+        }
+
+        if ( !isSparse ){
+
+            factorDenseSystem( jacobian );
+
+            return;
+
+        }
+
+        _blocks.resize( numBlocks * numBlocks );
+
+        for ( unsigned int a = 0; a < numBlocks; a++ ){
+
+            for ( unsigned int b = 0; b < numBlocks; b++ ){
+
+                if ( isNonZero[ numBlocks * a + b ] ){
+
+                    _blocks[ numBlocks * a + b ] = jacobian.block( _blockOffsets[ a ], _blockOffsets[ b ], blockSizes[ a ], blockSizes[ b ] );
+
+                }
+
+            }
+
+        }
+
+        std::vector< bool > &isEliminated = _isEliminatedBlock;
+
+        isEliminated.assign( numBlocks, false );
+
+        _eliminationOrder.clear( );
+
+        _blockLU.resize( numBlocks );
+
+        _blockNorms.resize( numBlocks );
+
+        _blockLower.resize( numBlocks );
+
+        _blockUpper.resize( numBlocks );
+
+        for ( unsigned int step = 0; step < numBlocks; step++ ){
+
+            // Choose the remaining block with the fewest couplings to the other remaining blocks
+            unsigned int k = numBlocks;
+
+            unsigned int minCouplings = numBlocks + 1;
+
+            for ( unsigned int a = 0; a < numBlocks; a++ ){
+
+                if ( isEliminated[ a ] ){
+
+                    continue;
+
+                }
+
+                unsigned int couplings = 0;
+
+                for ( unsigned int b = 0; b < numBlocks; b++ ){
+
+                    if ( ( a != b ) && !isEliminated[ b ] && ( isNonZero[ numBlocks * a + b ] || isNonZero[ numBlocks * b + a ] ) ){
+
+                        couplings++;
+
+                    }
+
+                }
+
+                if ( couplings < minCouplings ){
+
+                    k = a;
+
+                    minCouplings = couplings;
+
+                }
+
+            }
+
+            _blockNorms[ k ] = _blocks[ numBlocks * k + k ].cwiseAbs( ).colwise( ).sum( ).maxCoeff( );
+
+            _blockLU[ k ].compute( _blocks[ numBlocks * k + k ] );
+
+            if ( !( estimateReciprocalConditionNumber( _blockLU[ k ], _blockNorms[ k ] ) > std::numeric_limits< floatType >::epsilon( ) ) ){
+
+                // The pivot block is singular so fall back to the dense factorization
+                factorDenseSystem( jacobian );
+
+                return;
+
+            }
+
+            unsigned int numUpper = 0;
+
+            for ( unsigned int j = 0; j < numBlocks; j++ ){
+
+                if ( ( j != k ) && !isEliminated[ j ] && isNonZero[ numBlocks * k + j ] ){
+
+                    if ( numUpper == _blockUpper[ k ].size( ) ){
+
+                        _blockUpper[ k ].emplace_back( );
+
+                    }
+
+                    _blockUpper[ k ][ numUpper ].first = j;
+
+                    _blockUpper[ k ][ numUpper ].second = _blockLU[ k ].solve( _blocks[ numBlocks * k + j ] );
+
+                    numUpper++;
+
+                }
+
+            }
+
+            _blockUpper[ k ].resize( numUpper );
+
+            unsigned int numLower = 0;
+
+            for ( unsigned int i = 0; i < numBlocks; i++ ){
+
+                if ( ( i == k ) || isEliminated[ i ] || !isNonZero[ numBlocks * i + k ] ){
+
+                    continue;
+
+                }
+
+                if ( numLower == _blockLower[ k ].size( ) ){
+
+                    _blockLower[ k ].emplace_back( );
+
+                }
+
+                _blockLower[ k ][ numLower ].first = i;
+
+                _blockLower[ k ][ numLower ].second = _blocks[ numBlocks * i + k ];
+
+                numLower++;
+
+                // Form the Schur complement of the coupled blocks
+                for ( auto upper = _blockUpper[ k ].begin( ); upper != _blockUpper[ k ].end( ); upper++ ){
+
+                    const unsigned int j = upper->first;
+
+                    if ( !isNonZero[ numBlocks * i + j ] ){
+
+                        _blocks[ numBlocks * i + j ].noalias( ) = -_blocks[ numBlocks * i + k ] * upper->second;
+
+                        isNonZero[ numBlocks * i + j ] = true;
+
+                    }
+                    else{
+
+                        _blocks[ numBlocks * i + j ].noalias( ) -= _blocks[ numBlocks * i + k ] * upper->second;
+
+                    }
+
+                }
+
+            }
+
+            _blockLower[ k ].resize( numLower );
+
+            isEliminated[ k ] = true;
+
+            _eliminationOrder.push_back( k );
+
+        }
+
+        _useBlockElimination = true;
+
+    }
+
+    void jacobianFactorization::factorDenseSystem( const Eigen::Ref< const floatRowMajorMatrix > &jacobian ){
+        /*!
+         * Factor the jacobian of the implicit unknowns as a dense matrix
+         *
+         * \param &jacobian: The jacobian of the implicit unknowns
+         */
+
+        _useBlockElimination = false;
+
+        _norm = jacobian.cwiseAbs( ).colwise( ).sum( ).maxCoeff( );
+
+        _lu.compute( jacobian );
+
+    }
+
+    void jacobianFactorization::solveImplicitSystem( floatRowMajorMatrix &rhs ) const{
+        /*!
+         * Solve the system defined by the factored jacobian of the implicit unknowns in place
+         *
+         * \param &rhs: The right hand side. Will be overwritten by the solution.
+         */
+
+        // Sized for the whole system so that it isn't re-sized for blocks of different sizes
+        _implicitSolution.resize( rhs.rows( ), rhs.cols( ) );
+
+        if ( !_useBlockElimination ){
+
+            _implicitSolution = _lu.solve( rhs );
+
+            rhs = _implicitSolution;
+
+            return;
+
+        }
+
+        // Forward elimination
+        for ( auto k = _eliminationOrder.begin( ); k != _eliminationOrder.end( ); k++ ){
+
+            auto c = _implicitSolution.topRows( _blockSizes[ *k ] );
+
+            c = _blockLU[ *k ].solve( rhs.middleRows( _blockOffsets[ *k ], _blockSizes[ *k ] ) );
+
+            rhs.middleRows( _blockOffsets[ *k ], _blockSizes[ *k ] ) = c;
+
+            for ( auto lower = _blockLower[ *k ].begin( ); lower != _blockLower[ *k ].end( ); lower++ ){
+
+                rhs.middleRows( _blockOffsets[ lower->first ], _blockSizes[ lower->first ] ).noalias( ) -= lower->second * c;
+
+            }
+
+        }
+
+        // Back substitution
+        for ( auto k = _eliminationOrder.rbegin( ); k != _eliminationOrder.rend( ); k++ ){
+
+            for ( auto upper = _blockUpper[ *k ].begin( ); upper != _blockUpper[ *k ].end( ); upper++ ){
+
+                rhs.middleRows( _blockOffsets[ *k ], _blockSizes[ *k ] ).noalias( ) -= upper->second * rhs.middleRows( _blockOffsets[ upper->first ], _blockSizes[ upper->first ] );
+
+            }
+
+        }
+
+    }
+
+    floatType jacobianFactorization::rcond( ) const{
+        /*!
+         * Get an estimate of the reciprocal condition number of the factored jacobian. If block elimination was used
+         * the smallest estimate of the factored diagonal blocks is returned.
+         */
+
+        if ( !_useBlockElimination ){
+
+            return estimateReciprocalConditionNumber( _lu, _norm );
+
+        }
+
+        floatType result = std::numeric_limits< floatType >::max( );
+
+        for ( auto k = _eliminationOrder.begin( ); k != _eliminationOrder.end( ); k++ ){
+
+            result = std::min( result, estimateReciprocalConditionNumber( _blockLU[ *k ], _blockNorms[ *k ] ) );
+
+        }
+
+        return result;
+
+    }
+
+    floatType jacobianFactorization::estimateReciprocalConditionNumber( const Eigen::PartialPivLU< floatRowMajorMatrix > &lu, const floatType &norm ) const{
+        /*!
+         * Estimate the reciprocal of the 1-norm condition number of a factored matrix i.e.,
+         *
+         * \f$ \frac{1}{ \| A \|_1 \| A^{-1} \|_1 } \f$
+         *
+         * The norm of the inverse is estimated with the same algorithm as Eigen::PartialPivLU::rcond (Hager's method
+         * with Higham's alternating sign vector) but the solves are performed in the workspace of the factorization so
+         * that no memory is allocated once the size of the matrix stops changing.
+         *
+         * \param &lu: The factorization of the matrix
+         * \param &norm: The 1-norm of the matrix
+         */
+
+        const unsigned int n = lu.rows( );
+
+        if ( n == 0 ){
+
+            return std::numeric_limits< floatType >::infinity( );
+
+        }
+
+        if ( norm == 0 ){
+
+            return 0;
+
+        }
+
+        if ( n == 1 ){
+
+            return 1;
+
+        }
+
+        // The workspace only grows so that it isn't re-sized for the diagonal blocks of different sizes
+        if ( _conditionRHS.size( ) < static_cast< Eigen::Index >( n ) ){
+
+            _conditionRHS.resize( n );
+
+            _conditionSolution.resize( n );
+
+            _conditionSign.resize( n );
+
+            _previousConditionSign.resize( n );
+
+        }
+
+        auto b = _conditionRHS.head( n );
+
+        auto v = _conditionSolution.head( n );
+
+        auto sign = _conditionSign.head( n );
+
+        auto previousSign = _previousConditionSign.head( n );
+
+        b.setConstant( 1. / n );
+
+        v = lu.solve( b );
+
+        floatType lowerBound = v.lpNorm< 1 >( );
+
+        floatType previousLowerBound = lowerBound;
+
+        Eigen::Index index = -1;
+
+        Eigen::Index previousIndex = -1;
+
+        for ( unsigned int k = 0; k < 4; k++ ){
+
+            sign = v.unaryExpr( [ ]( const floatType &a ){ return a < 0 ? -1. : 1.; } );
+
+            if ( ( k > 0 ) && ( sign == previousSign ) ){
+
+                break;
+
+            }
+
+            // Solve the transposed system. With PA = LU we have A^T = U^T L^T P.
+            b = sign;
+
+            lu.matrixLU( ).triangularView< Eigen::Upper >( ).transpose( ).solveInPlace( b );
+
+            lu.matrixLU( ).triangularView< Eigen::UnitLower >( ).transpose( ).solveInPlace( b );
+
+            v = lu.permutationP( ).transpose( ) * b;
+
+            v.cwiseAbs( ).maxCoeff( &index );
+
+            if ( index == previousIndex ){
+
+                break;
+
+            }
+
+            b.setZero( );
+
+            b( index ) = 1;
+
+            v = lu.solve( b );
+
+            lowerBound = v.lpNorm< 1 >( );
+
+            if ( lowerBound <= previousLowerBound ){
+
+                break;
+
+            }
+
+            previousSign = sign;
+
+            previousIndex = index;
+
+            previousLowerBound = lowerBound;
+
+        }
+
+        // Guard against the cancellation the sign vectors may miss
+        for ( unsigned int i = 0; i < n; i++ ){
+
+            b( i ) = ( i % 2 == 0 ? 1. : -1. ) * ( 1. + floatType( i ) / floatType( n - 1 ) );
+
+        }
+
+        v = lu.solve( b );
+
+        lowerBound = std::max( lowerBound, 2 * v.lpNorm< 1 >( ) / ( 3 * floatType( n ) ) );
+
+        if ( lowerBound == 0 ){
+
+            return 0;
+
+        }
+
+        return ( 1 / lowerBound ) / norm;
+
+    }
+
+    void subConfigurationGradient::leftMultiply( const floatMatrix &A, floatMatrix &result ) const{
+        /*!
+         * Compute the product of a matrix with the gradient i.e.,
+         *
+         * \f$ \text{result}_{r,aA}^{k} = A_{r,iI} F^{-}_{ia} F^{+}_{AI} = \left( \bf{F}^{-T} \bf{A}_r \bf{F}^{+T} \right)_{aA} \f$
+         *
+         * where \f$ \bf{A}_r \f$ is row \f$ r \f$ of the matrix viewed as a second order tensor.
+         *
+         * \param &A: The matrix with dim**2 columns
+         * \param &result: The product with numConfigurations * dim**2 columns
+         */
+
+        const unsigned int dim = _dimension;
+
+        const unsigned int sot_dim = dim * dim;
+
+        result = floatMatrix( A.size( ), floatVector( sot_dim * _numConfigurations, 0 ) );
+
+        floatVector temp( sot_dim );
+
+        for ( unsigned int index = _lowerIndex; index < _upperIndex; index++ ){
+
+            const floatVector &Fm = getPrecedingFactor( index );
+
+            const floatVector &Fp = getFollowingFactor( index );
+
+            for ( unsigned int r = 0; r < A.size( ); r++ ){
+
+                // temp_{iA} = A_{r,iI} Fp_{AI}
+                for ( unsigned int i = 0; i < dim; i++ ){
+
+                    for ( unsigned int J = 0; J < dim; J++ ){
+
+                        floatType value = 0;
+
+                        for ( unsigned int I = 0; I < dim; I++ ){
+
+                            value += A[ r ][ dim * i + I ] * Fp[ dim * J + I ];
+
+                        }
+
+                        temp[ dim * i + J ] = value;
+
+                    }
+
+                }
+
+                // result_{r,aA} = Fm_{ia} temp_{iA}
+                for ( unsigned int a = 0; a < dim; a++ ){
+
+                    for ( unsigned int J = 0; J < dim; J++ ){
+
+                        floatType value = 0;
+
+                        for ( unsigned int i = 0; i < dim; i++ ){
+
+                            value += Fm[ dim * i + a ] * temp[ dim * i + J ];
+
+                        }
+
+                        result[ r ][ sot_dim * index + dim * a + J ] = value;
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    floatMatrix subConfigurationGradient::toDense( ) const{
+        /*!
+         * Form the dense gradient of size ( dim**2, numConfigurations * dim**2 )
+         */
+
+        const unsigned int dim = _dimension;
+
+        const unsigned int sot_dim = dim * dim;
+
+        floatMatrix gradient( sot_dim, floatVector( sot_dim * _numConfigurations, 0 ) );
+
+        for ( unsigned int index = _lowerIndex; index < _upperIndex; index++ ){
+
+            const floatVector &Fm = getPrecedingFactor( index );
+
+            const floatVector &Fp = getFollowingFactor( index );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int I = 0; I < dim; I++ ){
+
+                    for ( unsigned int a = 0; a < dim; a++ ){
+
+                        for ( unsigned int A = 0; A < dim; A++ ){
+
+                            gradient[ dim * i + I ][ sot_dim * index + dim * a + A ] = Fm[ dim * i + a ] * Fp[ dim * A + I ];
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+
+        return gradient;
+
+    }
+
+    void computeFirstConfigurationGradients( const floatVector &deformationGradient, const subConfigurationGradient &dFscdFs,
+                                             floatMatrix &dF1dF, floatMatrix &dF1dFn ){
+        /*!
+         * Compute the gradients of the first configuration \f$ \bf{F}^1 = \bf{F} \left( \bf{F}^{sc} \right)^{-1} \f$
+         * where \f$ \bf{F}^{sc} = \bf{F}^2 \bf{F}^3 \cdots \bf{F}^n \f$. Because the gradient of the
+         * sub-configuration is a Kronecker product for each configuration the gradients are
+         *
+         * \f$ \frac{\partial F^1_{iI}}{\partial F_{aA}} = \delta_{ia} \left( F^{sc} \right)^{-1}_{AI} \f$
+         *
+         * \f$ \frac{\partial F^1_{iI}}{\partial F^k_{aA}} = -\left( F^1 F^{-} \right)_{ia} \left( F^{+} \left( F^{sc} \right)^{-1} \right)_{AI} \f$
+         *
+         * where \f$ \bf{F}^{-} \f$ and \f$ \bf{F}^{+} \f$ are the factors of the gradient of the sub-configuration.
+         *
+         * \param &deformationGradient: The deformation gradient
+         * \param &dFscdFs: The gradient of the sub-configuration following the first configuration
+         * \param &dF1dF: The gradient of the first configuration w.r.t. the deformation gradient
+         * \param &dF1dFn: The gradient of the first configuration w.r.t. the remaining configurations
+         */
+
+        const unsigned int dim = *dFscdFs.getDimension( );
+
+        const unsigned int sot_dim = dim * dim;
+
+        const unsigned int numConfigurations = *dFscdFs.getNumConfigurations( );
+
+        dF1dF = floatMatrix( sot_dim, floatVector( sot_dim, 0 ) );
+
+        dF1dFn = floatMatrix( sot_dim, floatVector( sot_dim * ( numConfigurations - 1 ), 0 ) );
+
+        floatVector invFsc = tardigradeVectorTools::inverse( dFscdFs.getPrecedingFactor( *dFscdFs.getUpperIndex( ) ), dim, dim );
+
+        floatVector F1 = tardigradeVectorTools::matrixMultiply( deformationGradient, invFsc, dim, dim, dim, dim );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                for ( unsigned int A = 0; A < dim; A++ ){
+
+                    dF1dF[ dim * i + I ][ dim * i + A ] = invFsc[ dim * A + I ];
+
+                }
+
+            }
+
+        }
+
+        for ( unsigned int index = 1; index < numConfigurations; index++ ){
+
+            floatVector left = tardigradeVectorTools::matrixMultiply( F1, dFscdFs.getPrecedingFactor( index ), dim, dim, dim, dim );
+
+            floatVector right = tardigradeVectorTools::matrixMultiply( dFscdFs.getFollowingFactor( index ), invFsc, dim, dim, dim, dim );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int I = 0; I < dim; I++ ){
+
+                    for ( unsigned int a = 0; a < dim; a++ ){
+
+                        for ( unsigned int A = 0; A < dim; A++ ){
+
+                            dF1dFn[ dim * i + I ][ sot_dim * ( index - 1 ) + dim * a + A ] = -left[ dim * i + a ] * right[ dim * A + I ];
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+    unsigned int histogram::getBin( const unsigned long long &value ){
+        /*!
+         * Get the bin of the histogram which contains the value
+         *
+         * \param &value: The value
+         */
+
+        unsigned int bin = 0;
+
+        for ( unsigned long long v = value; v > 0; v >>= 1 ){
+
+            bin++;
+
+        }
+
+        return bin;
+
+    }
+
+    void histogram::addValue( const unsigned long long &value ){
+        /*!
+         * Add a value to the histogram
+         *
+         * \param &value: The value to add
+         */
+
+        const unsigned int bin = getBin( value );
+
+        if ( bin >= _bins.size( ) ){
+
+            _bins.resize( bin + 1, 0 );
+
+        }
+
+        _bins[ bin ]++;
+
+        _count++;
+
+        _sum += value;
+
+        _minimum = std::min( _minimum, value );
+
+        _maximum = std::max( _maximum, value );
+
+    }
+
+    void histogram::merge( const histogram &other ){
+        /*!
+         * Add the values of another histogram to this histogram
+         *
+         * \param &other: The histogram to merge
+         */
+
+        if ( other._bins.size( ) > _bins.size( ) ){
+
+            _bins.resize( other._bins.size( ), 0 );
+
+        }
+
+        for ( unsigned int i = 0; i < other._bins.size( ); i++ ){
+
+            _bins[ i ] += other._bins[ i ];
+
+        }
+
+        _count += other._count;
+
+        _sum += other._sum;
+
+        _minimum = std::min( _minimum, other._minimum );
+
+        _maximum = std::max( _maximum, other._maximum );
+
+    }
+
+    void histogram::write( std::ostream &stream ) const{
+        /*!
+         * Write the histogram to a stream as a single line of the form
+         *
+         * count <count> sum <sum> min <minimum> max <maximum> bins <bin 0> <bin 1> ...
+         *
+         * \param &stream: The stream to write to
+         */
+
+        stream << "count " << _count << " sum " << _sum << " min " << ( _count > 0 ? _minimum : 0 ) << " max " << _maximum << " bins";
+
+        for ( auto b = _bins.begin( ); b != _bins.end( ); b++ ){
+
+            stream << " " << *b;
+
+        }
+
+    }
+
+    //! The number of allocations made by the current thread as reported by solveStatistics::countAllocation
+    static thread_local unsigned long long solveStatisticsAllocationCount = 0;
+
+    void solveStatistics::countAllocation( ){
+        /*!
+         * Increment the allocation count of the current thread. Intended to be called from a replacement of
+         * malloc (or of the global operator new) in the host program.
+         */
+
+        solveStatisticsAllocationCount++;
+
+    }
+
+    unsigned long long solveStatistics::getAllocationCount( ){
+        /*!
+         * Get the number of allocations counted on the current thread
+         */
+
+        return solveStatisticsAllocationCount;
+
+    }
+
+    void solveStatistics::addSolve( const bool &converged, const unsigned int &iterations, const unsigned int &lineSearchIterations,
+                                    const unsigned long long &allocations ){
+        /*!
+         * Record a non-linear solve
+         *
+         * \param &converged: Flag for whether the solve converged
+         * \param &iterations: The number of Newton iterations
+         * \param &lineSearchIterations: The number of line search iterations
+         * \param &allocations: The number of allocations
+         */
+
+        _numSolves++;
+
+        if ( !converged ){
+
+            _numFailedSolves++;
+
+        }
+
+        _iterations.addValue( iterations );
+
+        _lineSearchIterations.addValue( lineSearchIterations );
+
+        _allocations.addValue( allocations );
+
+    }
+
+    void solveStatistics::setResidualName( const unsigned int &residualIndex, const char *residualName ){
+        /*!
+         * Register a timed residual class. The name is only copied if it differs from the registered name so
+         * registering the same residual classes again (e.g., for each material point) does not allocate.
+         *
+         * \param &residualIndex: The index of the residual class in hydraBase's residual classes
+         * \param *residualName: The name of the residual class
+         */
+
+        if ( residualIndex >= _residualTimes.size( ) ){
+
+            _residualNames.resize( residualIndex + 1 );
+
+            _residualTimes.resize( residualIndex + 1, std::vector< histogram >( residualStage::numStages ) );
+
+        }
+
+        if ( _residualNames[ residualIndex ] != residualName ){
+
+            _residualNames[ residualIndex ] = residualName;
+
+        }
+
+    }
+
+    void solveStatistics::addResidualTime( const unsigned int &residualIndex, const unsigned int &stage, const unsigned long long &nanoseconds ){
+        /*!
+         * Record the time spent in a stage of the evaluation of a residual class. The residual class must have been
+         * registered with setResidualName.
+         *
+         * \param &residualIndex: The index of the residual class in hydraBase's residual classes
+         * \param &stage: The stage of the evaluation (see tardigradeHydra::residualStage)
+         * \param &nanoseconds: The time spent in nanoseconds
+         */
+
+        if ( stage >= residualStage::numStages ){
+
+            std::string message = "The residual stage is not recognized\n";
+            message            += "  stage: " + std::to_string( stage ) + "\n";
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+        }
+
+        if ( residualIndex >= _residualTimes.size( ) ){
+
+            std::string message = "The residual class has not been registered\n";
+            message            += "  residual index: " + std::to_string( residualIndex ) + "\n";
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+        }
+
+        _residualTimes[ residualIndex ][ stage ].addValue( nanoseconds );
+
+    }
+
+    void solveStatistics::merge( const solveStatistics &other ){
+        /*!
+         * Add the statistics of another instance (e.g., from another thread) to these statistics
+         *
+         * \param &other: The statistics to merge
+         */
+
+        _numSolves += other._numSolves;
+
+        _numFailedSolves += other._numFailedSolves;
+
+        _iterations.merge( other._iterations );
+
+        _lineSearchIterations.merge( other._lineSearchIterations );
+
+        _allocations.merge( other._allocations );
+
+        if ( other._residualTimes.size( ) > _residualTimes.size( ) ){
+
+            _residualNames.resize( other._residualTimes.size( ) );
+
+            _residualTimes.resize( other._residualTimes.size( ), std::vector< histogram >( residualStage::numStages ) );
+
+        }
+
+        for ( unsigned int i = 0; i < other._residualTimes.size( ); i++ ){
+
+            if ( _residualNames[ i ].empty( ) ){
+
+                _residualNames[ i ] = other._residualNames[ i ];
+
+            }
+
+            for ( unsigned int j = 0; j < residualStage::numStages; j++ ){
+
+                _residualTimes[ i ][ j ].merge( other._residualTimes[ i ][ j ] );
+
+            }
+
+        }
+
+    }
+
+    void solveStatistics::write( std::ostream &stream ) const{
+        /*!
+         * Write the statistics to a stream with one histogram per line
+         *
+         * \param &stream: The stream to write to
+         */
+
+        const std::vector< std::string > stageNames = { "residual", "jacobian", "derivatives" };
+
+        stream << "solves " << _numSolves << "\n";
+
+        stream << "failed solves " << _numFailedSolves << "\n";
+
+        stream << "iterations ";
+        _iterations.write( stream );
+        stream << "\n";
+
+        stream << "line search iterations ";
+        _lineSearchIterations.write( stream );
+        stream << "\n";
+
+        stream << "allocations ";
+        _allocations.write( stream );
+        stream << "\n";
+
+        for ( unsigned int i = 0; i < _residualTimes.size( ); i++ ){
+
+            for ( unsigned int j = 0; j < residualStage::numStages; j++ ){
+
+                stream << "residual " << i << " " << _residualNames[ i ] << " " << stageNames[ j ] << " time (ns) ";
+                _residualTimes[ i ][ j ].write( stream );
+                stream << "\n";
+
+            }
+
+        }
+
+    }
+
+    void workspaceArena::addBlock( const unsigned long long &size ){
+        /*!
+         * Allocate a new block of workspace
+         *
+         * \param &size: The number of values in the block
+         */
+
+        _blocks.push_back( floatVector( size ) );
+
+        _numBlockAllocations++;
+
+    }
+
+    floatType* workspaceArena::allocate( const unsigned int &size ){
+        /*!
+         * Hand out workspace which remains valid until the next reset. The workspace is not initialized.
+         *
+         * \param &size: The number of values required
+         */
+
+        while ( ( _block < _blocks.size( ) ) && ( _offset + size > _blocks[ _block ].size( ) ) ){
+
+            _block++;
+
+            _offset = 0;
+
+        }
+
+        if ( _block == _blocks.size( ) ){
+
+            // Grow geometrically so that the number of blocks in a cycle stays small
+            addBlock( std::max( ( unsigned long long )size, std::max( _highWaterMark, _size ) + 64 ) );
+
+            _offset = 0;
+
+        }
+
+        floatType *workspace = _blocks[ _block ].data( ) + _offset;
+
+        _offset += size;
+
+        _size += size;
+
+        return workspace;
+
+    }
+
+    void workspaceArena::reset( ){
+        /*!
+         * Release all of the workspace handed out since the last reset. If the cycle used more than one block the
+         * blocks are replaced by a single block which can hold the whole cycle.
+         */
+
+        _highWaterMark = std::max( _highWaterMark, _size );
+
+        if ( _blocks.size( ) > 1 ){
+
+            unsigned long long capacity = 0;
+
+            for ( auto block = _blocks.begin( ); block != _blocks.end( ); block++ ){
+
+                capacity += block->size( );
+
+            }
+
+            _blocks.clear( );
+
+            addBlock( std::max( capacity, _highWaterMark ) );
+
+        }
+
+        _block = 0;
+
+        _offset = 0;
+
+        _size = 0;
+
+    }
+
+    const jacobianFactorization* hydraBase::getJacobianFactorization( ){
+        /*!
+         * Get the partial-pivoting LU factorization of the jacobian of the non-linear problem. The factorization
+         * may be re-used to solve the linear system with additional right hand sides (e.g., when computing the
+         * consistent tangent) without re-factoring the jacobian.
+         */
+
+        if ( !_jacobianFactorization.first ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( setJacobianFactorization( ) );
+
+        }
+
+        return &_jacobianFactorization.second;
+
+    }
+
+    void hydraBase::setNonLinearSolver( const unsigned int &solver ){
+        /*!
+         * Set the strategy used to solve the non-linear problem
+         *
+         * \param &solver: The strategy (see tardigradeHydra::nonLinearSolver)
+         */
+
+        if ( ( solver != nonLinearSolver::newton ) && ( solver != nonLinearSolver::modifiedNewton ) && ( solver != nonLinearSolver::broyden ) ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "The non-linear solver " + std::to_string( solver ) + " is not recognized" ) );
+
+        }
+
+        _nonLinearSolver = solver;
+
+    }
+
+    void hydraBase::setMaxJacobianAge( const unsigned int &maxJacobianAge ){
+        /*!
+         * Set the maximum number of iterations that a factored jacobian is re-used for by the modified Newton and
+         * Broyden solvers before it is re-formed
+         *
+         * \param &maxJacobianAge: The maximum age of the factored jacobian. Must be at least one.
+         */
+
+        if ( maxJacobianAge == 0 ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "The maximum jacobian age must be at least one" ) );
+
+        }
+
+        _maxJacobianAge = maxJacobianAge;
+
+    }
+
+    void hydraBase::setRetainedJacobianFactorization( ){
+        /*!
+         * Factor the jacobian at the current unknown vector and retain the factorization so that it can be
+         * re-used by the modified Newton and Broyden solvers in subsequent iterations
+         */
+
+        const jacobianFactorization *factorization;
+        TARDIGRADE_ERROR_TOOLS_CATCH( factorization = getJacobianFactorization( ) );
+
+        _retainedFactorization = *factorization;
+
+        _hasRetainedFactorization = true;
+
+        _jacobianAge = 0;
+
+        _numBroydenUpdates = 0;
+
+    }
+
+    void hydraBase::solveJacobianSystem( const floatType *rhs, floatType *solution ){
+        /*!
+         * Solve the linear system defined by the jacobian (or its approximation) for the given right hand side.
+         *
+         * If the solver is Newton's method the factorization of the current jacobian is used. Otherwise, the retained
+         * factorization is used and, for Broyden's method, the inverse is corrected with the rank-one updates
+         *
+         * \f$ H_{k+1} = \left( I + a_k s_k^T \right) H_k \f$
+         *
+         * which are applied in the order they were computed.
+         *
+         * \param *rhs: The right hand side of the linear system which has the size of the unknown vector
+         * \param *solution: The solution of the linear system which has the size of the unknown vector
+         */
+
+        const unsigned int numUnknowns = getUnknownVector( )->size( );
+
+        Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > b( rhs, numUnknowns );
+
+        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > x( solution, numUnknowns );
+
+        if ( _nonLinearSolver == nonLinearSolver::newton ){
+
+            const jacobianFactorization *factorization;
+            TARDIGRADE_ERROR_TOOLS_CATCH( factorization = getJacobianFactorization( ) );
+
+            factorization->solve( b, x );
+
+            return;
+
+        }
+
+        if ( !_hasRetainedFactorization ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( setRetainedJacobianFactorization( ) );
+
+        }
+
+        _retainedFactorization.solve( b, x );
+
+        for ( unsigned int i = 0; i < _numBroydenUpdates; i++ ){
+
+            x += Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( _broydenStepUpdates + numUnknowns * i, numUnknowns )
+               * Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( _broydenSteps + numUnknowns * i, numUnknowns ).dot( x );
+
+        }
+
+    }
+
+    void hydraBase::updateBroydenApproximation( const floatType *deltaX, const floatType *deltaResidual ){
+        /*!
+         * Add a rank-one ( "good" Broyden ) update to the approximation of the inverse of the jacobian
+         *
+         * \f$ H_{k+1} = H_k + \frac{ \left( s_k - H_k y_k \right) s_k^T H_k }{ s_k^T H_k y_k } \f$
+         *
+         * where \f$ s_k \f$ is the change in the unknown vector and \f$ y_k \f$ is the change in the residual. If the
+         * update is ill-defined the retained factorization is discarded so that the jacobian is re-formed.
+         *
+         * The update is written into the history which is drawn from the solve workspace when the solve starts.
+         *
+         * \param *deltaX: The change in the unknown vector over the iteration
+         * \param *deltaResidual: The change in the residual over the iteration
+         */
+
+        const unsigned int numUnknowns = getUnknownVector( )->size( );
+
+        Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > s( deltaX, numUnknowns );
+
+        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > Hy( _iterationArena.allocate( numUnknowns ), numUnknowns );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( solveJacobianSystem( deltaResidual, Hy.data( ) ) );
+
+        const floatType sHy = s.dot( Hy );
+
+        if ( !( std::fabs( sHy ) > std::numeric_limits< floatType >::epsilon( ) * s.norm( ) * Hy.norm( ) ) ){
+
+            _hasRetainedFactorization = false;
+
+            return;
+
+        }
+
+        if ( _numBroydenUpdates >= _maxBroydenUpdates ){
+
+            // The history is full so the jacobian is re-formed rather than discarding one of the updates
+            _hasRetainedFactorization = false;
+
+            return;
+
+        }
+
+        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( _broydenStepUpdates + numUnknowns * _numBroydenUpdates, numUnknowns ) = ( s - Hy ) / sHy;
+
+        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( _broydenSteps + numUnknowns * _numBroydenUpdates, numUnknowns ) = s;
+
+        _numBroydenUpdates++;
+
+    }
+
+    void hydraBase::solveNonLinearProblem( ){
+        /*!
+         * Solve the non-linear problem
+         *
+         * Only the jacobian is requested from the residual classes during the iterations. The
+         * requested derivatives are restored once the iterations terminate so that the remaining
+         * derivatives are only computed (if required) at the converged solution.
+         *
+         * The vectors of the iterations are drawn from the solve workspace so that they survive the updates of the
+         * unknown vector in the line search and are not re-allocated between iterations.
+         */
+
+        // Form the initial unknown vector
+        TARDIGRADE_ERROR_TOOLS_CATCH( initializeUnknownVector( ) );
+
+        const unsigned int numUnknowns = getUnknownVector( )->size( );
+
+        _solveArena.reset( );
+
+        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > X0( _solveArena.allocate( numUnknowns ), numUnknowns );
+
+        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > R0( _solveArena.allocate( numUnknowns ), numUnknowns );
+
+        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > deltaX( _solveArena.allocate( numUnknowns ), numUnknowns );
+
+        floatVector trialX( numUnknowns );
+
+        // The history of the Broyden updates can hold the updates of the oldest retained jacobian
+        _numBroydenUpdates = 0;
+
+        _maxBroydenUpdates = ( _nonLinearSolver == nonLinearSolver::broyden ) ? _maxJacobianAge : 0;
+
+        _broydenStepUpdates = ( _maxBroydenUpdates > 0 ) ? _solveArena.allocate( _maxBroydenUpdates * numUnknowns ) : nullptr;
+
+        _broydenSteps = ( _maxBroydenUpdates > 0 ) ? _solveArena.allocate( _maxBroydenUpdates * numUnknowns ) : nullptr;
+
+        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > trial( trialX.data( ), numUnknowns );
+
+        const unsigned int requestedDerivatives = *getDerivativeRequest( );
+
+        setDerivativeRequest( derivativeRequest::jacobian );
+
+        _numJacobianFactorizations = 0;
+
+        _numTangentFactorizations = 0;
+
+        _hasRetainedFactorization = false;
+
+        _numLSIterations = 0;
+
+        _isIterating = true;
+
+        try{
+
+            resetLSIteration( );
+
+            while( !checkConvergence( ) && checkIteration( ) ){
+
+                X0 = Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( getUnknownVector( )->data( ), numUnknowns );
+
+                R0 = Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( getResidual( )->data( ), numUnknowns );
+
+                // Re-form the jacobian if the retained factorization is too old
+                bool isFreshJacobian = ( _nonLinearSolver == nonLinearSolver::newton );
+
+                if ( !isFreshJacobian && ( !_hasRetainedFactorization || ( _jacobianAge >= _maxJacobianAge ) ) ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( setRetainedJacobianFactorization( ) );
+
+                    isFreshJacobian = true;
+
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( solveJacobianSystem( R0.data( ), deltaX.data( ) ) );
+
+                deltaX = -deltaX;
+
+                trial = X0 + *getLambda( ) * deltaX;
+
+                updateUnknownVector( trialX );
+
+                while ( !checkLSConvergence( ) && checkLSIteration( ) ){
+
+                    updateLambda( );
+
+                    incrementLSIteration( );
+
+                    trial = X0 + *getLambda( ) * deltaX;
+
+                    updateUnknownVector( trialX );
+
+                }
+
+                if ( !checkLSConvergence( ) ){
+
+                    if ( !isFreshJacobian ){
+
+                        // The retained jacobian is no longer a good approximation. Restart the iteration with a fresh jacobian.
+                        _hasRetainedFactorization = false;
+
+                        trial = X0;
+
+                        updateUnknownVector( trialX );
+
+                        resetLSIteration( );
+
+                        continue;
+
+                    }
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( throw convergence_error( "Failure in line search" ) );
+
+                }
+
+                if ( _nonLinearSolver != nonLinearSolver::newton ){
+
+                    _jacobianAge++;
+
+                    if ( _LSIteration > 0 ){
+
+                        // The full step was not accepted so the solution is stagnating and the jacobian should be re-formed
+                        _hasRetainedFactorization = false;
+
+                    }
+                    else if ( _nonLinearSolver == nonLinearSolver::broyden ){
+
+                        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > deltaXk( _iterationArena.allocate( numUnknowns ), numUnknowns );
+
+                        Eigen::Map< Eigen::Matrix< floatType, Eigen::Dynamic, 1 > > deltaRk( _iterationArena.allocate( numUnknowns ), numUnknowns );
+
+                        deltaXk = Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( getUnknownVector( )->data( ), numUnknowns ) - X0;
+
+                        deltaRk = Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( getResidual( )->data( ), numUnknowns ) - R0;
+
+                        TARDIGRADE_ERROR_TOOLS_CATCH( updateBroydenApproximation( deltaXk.data( ), deltaRk.data( ) ) );
+
+                    }
+
+                }
+
+                resetLSIteration( );
+
+                // Increment the iteration count
+                incrementIteration( );
+
+            }
+
+        }
+        catch( ... ){
+
+            _isIterating = false;
+
+            setDerivativeRequest( requestedDerivatives );
+
+            throw;
+
+        }
+
+        _isIterating = false;
+
+        setDerivativeRequest( requestedDerivatives );
+
+        if ( !checkConvergence( ) ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw convergence_error( "Failure to converge main loop" ) );
+
+        }
+
+        // Set the tolerance
+        TARDIGRADE_ERROR_TOOLS_CATCH( setTolerance( ) );
+
+    }
+
+    void hydraBase::evaluate( ){
+        /*!
+         * Solve the non-linear problem and update the variables
+         *
+         * If the library is compiled with TARDIGRADE_HYDRA_SOLVE_STATISTICS defined and solve statistics have been
+         * set, the number of iterations, line search iterations, and allocations of the solve are recorded.
+         */
+
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+        const unsigned long long initialAllocationCount = solveStatistics::getAllocationCount( );
+
+        try{
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( solveNonLinearProblem( ) );
+
+        }
+        catch( ... ){
+
+            if ( _solveStatistics ){
+
+                _solveStatistics->addSolve( false, _iteration, _numLSIterations, solveStatistics::getAllocationCount( ) - initialAllocationCount );
+
+            }
+
+            throw;
+
+        }
+
+        if ( _solveStatistics ){
+
+            _solveStatistics->addSolve( true, _iteration, _numLSIterations, solveStatistics::getAllocationCount( ) - initialAllocationCount );
+
+        }
+#else
+        TARDIGRADE_ERROR_TOOLS_CATCH( solveNonLinearProblem( ) );
+#endif
+
+    }
+
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+    void hydraBase::recordResidualTime( const unsigned int &residualIndex, const unsigned int &stage,
+                                        const std::chrono::steady_clock::time_point &start ){
+        /*!
+         * Record the time spent in a stage of the evaluation of a residual class. Because the residual classes cache
+         * their intermediate quantities, the time of shared quantities is attributed to the first stage which
+         * requests them.
+         *
+         * \param &residualIndex: The index of the residual class
+         * \param &stage: The stage of the evaluation (see tardigradeHydra::residualStage)
+         * \param &start: The time the evaluation started
+         */
+
+        if ( !_solveStatistics ){
+
+            return;
+
+        }
+
+        const unsigned long long nanoseconds = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now( ) - start ).count( );
+
+        _solveStatistics->addResidualTime( residualIndex, stage, nanoseconds );
+
+    }
+
+    void hydraBase::setSolveStatistics( solveStatistics *statistics ){
+        /*!
+         * Set the statistics which the non-linear solves will be recorded in. The statistics are not owned by hydraBase.
+         *
+         * \param *statistics: The statistics
+         */
+
+        _solveStatistics = statistics;
+
+        setSolveStatisticsResidualNames( );
+
+    }
+
+    void hydraBase::setSolveStatisticsResidualNames( ){
+        /*!
+         * Register the names of the residual classes with the solve statistics so that recording the time of a stage
+         * does not look up or copy the name
+         */
+
+        if ( !_solveStatistics || !_residualClasses.first ){
+
+            return;
+
+        }
+
+        for ( auto c = _residualClasses.second.begin( ); c != _residualClasses.second.end( ); c++ ){
+
+            _solveStatistics->setResidualName( c - _residualClasses.second.begin( ), typeid( **c ).name( ) );
+
+        }
+
+    }
+#endif
+
+    void hydraBase::setTotalDerivatives( ){
+        /*!
+         * Set the total derivatives of the unknown vector w.r.t. the deformation gradient and the temperature.
+         *
+         * At the converged solution \f$R\left( X, F, T \right) = 0\f$ so by the implicit function theorem
+         *
+         * \f$ \frac{dX}{dF} = -\left( \frac{\partial R}{\partial X} \right)^{-1} \frac{\partial R}{\partial F} \f$
+         *
+         * \f$ \frac{dX}{dT} = -\left( \frac{\partial R}{\partial X} \right)^{-1} \frac{\partial R}{\partial T} \f$
+         *
+         * Both are computed with a single factorization of the Jacobian and one solve with \f$dim^2 + 1\f$ right hand sides.
+         * This is the algorithmic consistent tangent and should only be requested after the non-linear problem has
+         * converged.
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        const unsigned int sot_dim = ( *dim ) * ( *dim );
+
+        const floatVector *residual;
+        TARDIGRADE_ERROR_TOOLS_CATCH( residual = getResidual( ) );
+
+        const unsigned int numUnknowns = residual->size( );
+
+        const floatVector *flatdRdF;
+        TARDIGRADE_ERROR_TOOLS_CATCH( flatdRdF = getFlatdRdF( ) );
+
+        const floatVector *dRdT;
+        TARDIGRADE_ERROR_TOOLS_CATCH( dRdT = getdRdT( ) );
+
+        // Assemble all of the right hand sides into a single block
+        floatRowMajorMatrix rhs( numUnknowns, sot_dim + 1 );
+
+        rhs.leftCols( sot_dim ) = -Eigen::Map< const floatRowMajorMatrix >( flatdRdF->data( ), numUnknowns, sot_dim );
+
+        rhs.col( sot_dim ) = -Eigen::Map< const Eigen::Matrix< floatType, Eigen::Dynamic, 1 > >( dRdT->data( ), numUnknowns );
+
+        // Re-use the factorization of the Jacobian if it is available
+        const jacobianFactorization *factorization;
+        TARDIGRADE_ERROR_TOOLS_CATCH( factorization = getJacobianFactorization( ) );
+
+        floatRowMajorMatrix dXdFdT = factorization->solve( rhs );
+
+        // Extract the solution
+
+        _flatdXdF.second = floatVector( numUnknowns * sot_dim, 0 );
+
+        _dXdT.second = floatVector( numUnknowns, 0 );
+
+        for ( unsigned int row = 0; row < numUnknowns; row++ ){
+
+            for ( unsigned int col = 0; col < sot_dim; col++ ){
+
+                _flatdXdF.second[ sot_dim * row + col ] = dXdFdT( row, col );
+
+            }
+
+            _dXdT.second[ row ] = dXdFdT( row, sot_dim );
+
+        }
+
+        // The Cauchy stress is the leading block of the unknown vector
+
+        _dCauchyStressdF.second = floatMatrix( sot_dim, floatVector( sot_dim, 0 ) );
+
+        _dCauchyStressdT.second = floatVector( _dXdT.second.begin( ), _dXdT.second.begin( ) + sot_dim );
+
+        for ( unsigned int row = 0; row < sot_dim; row++ ){
+
+            _dCauchyStressdF.second[ row ] = floatVector( _flatdXdF.second.begin( ) + sot_dim * row, _flatdXdF.second.begin( ) + sot_dim * ( row + 1 ) );
+
+        }
+
+        _flatdXdF.first = true;
+
+        _dXdT.first = true;
+
+        _dCauchyStressdF.first = true;
+
+        _dCauchyStressdT.first = true;
+
+        addIterationData( &_flatdXdF );
+
+        addIterationData( &_dXdT );
+
+        addIterationData( &_dCauchyStressdF );
+
+        addIterationData( &_dCauchyStressdT );
+
+    }
+
+    const floatVector* hydraBase::getFlatdXdF( ){
+        /*!
+         * Get the flattened row-major total derivative of the unknown vector w.r.t. the deformation gradient
+         */
+
+        if ( !_flatdXdF.first ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( setTotalDerivatives( ) );
+
+        }
+
+        return &_flatdXdF.second;
+
+    }
+
+    floatMatrix hydraBase::getdXdF( ){
+        /*!
+         * Get the total derivative of the unknown vector w.r.t. the deformation gradient
+         */
+
+        return tardigradeVectorTools::inflate( *getFlatdXdF( ), getResidual( )->size( ), ( *getDimension( ) ) * ( *getDimension( ) ) );
+
+    }
+
+    const floatVector* hydraBase::getdXdT( ){
+        /*!
+         * Get the total derivative of the unknown vector w.r.t. the temperature
+         */
+
+        if ( !_dXdT.first ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( setTotalDerivatives( ) );
+
+        }
+
+        return &_dXdT.second;
+
+    }
+
+    const floatMatrix* hydraBase::getdCauchyStressdF( ){
+        /*!
+         * Get the total derivative of the Cauchy stress w.r.t. the deformation gradient i.e., the consistent tangent
+         */
+
+        if ( !_dCauchyStressdF.first ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( setTotalDerivatives( ) );
+
+        }
+
+        return &_dCauchyStressdF.second;
+
+    }
+
+    const floatVector* hydraBase::getdCauchyStressdT( ){
+        /*!
+         * Get the total derivative of the Cauchy stress w.r.t. the temperature
+         */
+
+        if ( !_dCauchyStressdT.first ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( setTotalDerivatives( ) );
+
+        }
+
+        return &_dCauchyStressdT.second;
+
+    }
+
+    void hydraBase::setUpdatedStateVariables( ){
+        /*!
+         * Set the updated state variables from the solution of the non-linear problem. The state variables have
+         * the same form as the previous state variables (see hydraBase::decomposeStateVariableVector). The current
+         * additional state variables of each of the residual classes are written in order at the beginning of the
+         * additional state variables and any remaining additional state variables are carried over from the previous
+         * values.
+         */
+
+        const unsigned int *dim = getDimension( );
+
+        const unsigned int sot_dim = ( *dim ) * ( *dim );
+
+        const unsigned int *nConfig = getNumConfigurations( );
+
+        const unsigned int *nNLISV = getNumNonLinearSolveStateVariables( );
+
+        const floatVector *unknownVector = getUnknownVector( );
+
+        _updatedStateVariables.second = *getPreviousStateVariables( );
+
+        // The configurations are stored as F - I
+        for ( unsigned int i = 1; i < *nConfig; i++ ){
+
+            for ( unsigned int j = 0; j < sot_dim; j++ ){
+
+                _updatedStateVariables.second[ sot_dim * ( i - 1 ) + j ] = ( *unknownVector )[ sot_dim * i + j ] - ( ( j % ( ( *dim ) + 1 ) ) == 0 ? 1 : 0 );
+
+            }
+
+        }
+
+        std::copy( unknownVector->begin( ) + sot_dim * ( *nConfig ), unknownVector->begin( ) + sot_dim * ( *nConfig ) + *nNLISV,
+                   _updatedStateVariables.second.begin( ) + sot_dim * ( ( *nConfig ) - 1 ) );
+
+        unsigned int offset = sot_dim * ( ( *nConfig ) - 1 ) + *nNLISV;
+
+        for ( auto residual = getResidualClasses( )->begin( ); residual != getResidualClasses( )->end( ); residual++ ){
+
+            const floatVector *currentAdditionalStateVariables;
+            TARDIGRADE_ERROR_TOOLS_CATCH( currentAdditionalStateVariables = ( *residual )->getCurrentAdditionalStateVariables( ) );
+
+            if ( offset + currentAdditionalStateVariables->size( ) > _updatedStateVariables.second.size( ) ){
+
+                std::string message = "The residual classes define more additional state variables than are available\n";
+                message            += "  number of state variables: " + std::to_string( _updatedStateVariables.second.size( ) ) + "\n";
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
+
+            std::copy( currentAdditionalStateVariables->begin( ), currentAdditionalStateVariables->end( ), _updatedStateVariables.second.begin( ) + offset );
+
+            offset += currentAdditionalStateVariables->size( );
+
+        }
+
+        _updatedStateVariables.first = true;
+
+        addIterationData( &_updatedStateVariables );
+
+    }
+
+    const floatVector* hydraBase::getUpdatedStateVariables( ){
+        /*!
+         * Get the updated state variables
+         */
+
+        if ( !_updatedStateVariables.first ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( setUpdatedStateVariables( ) );
+
+        }
+
+        return &_updatedStateVariables.second;
+
+    }
+
+    void hydraBase::setMaterialPoint( const floatType &time, const floatType &deltaTime,
+                                      const floatType &temperature, const floatType &previousTemperature,
+                                      const floatType *deformationGradient, const floatType *previousDeformationGradient,
+                                      const floatType *previousStateVariables ){
+        /*!
+         * Move the hydra object to a new material point. The parameters, residual classes, and number of state
+         * variables are retained and all of the data computed for the previous point is invalidated. The storage of
+         * the inputs is re-used so their sizes are unchanged.
+         *
+         * \param &time: The current time
+         * \param &deltaTime: The change in time
+         * \param &temperature: The current temperature
+         * \param &previousTemperature: The previous temperature
+         * \param *deformationGradient: The current deformation gradient
+         * \param *previousDeformationGradient The previous deformation gradient
+         * \param *previousStateVariables: The previous state variables
+         */
+
+        _time = time;
+
+        _deltaTime = deltaTime;
+
+        _temperature = temperature;
+
+        _previousTemperature = previousTemperature;
+
+        std::copy( deformationGradient, deformationGradient + _deformationGradient.size( ), _deformationGradient.begin( ) );
+
+        std::copy( previousDeformationGradient, previousDeformationGradient + _previousDeformationGradient.size( ), _previousDeformationGradient.begin( ) );
+
+        std::copy( previousStateVariables, previousStateVariables + _previousStateVariables.size( ), _previousStateVariables.begin( ) );
+
+        // Invalidate all of the data of the previous point
+        _pointEpoch++;
+
+        _iterationEpoch++;
+
+        _iterationArena.reset( );
+
+        _iteration = 0;
+
+        _LSIteration = 0;
+
+        _numLSIterations = 0;
+
+        _lambda = 1.0;
+
+        _hasRetainedFactorization = false;
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( decomposeStateVariableVector( ) );
+
+    }
+
+    void materialPointBatch::evaluate( const unsigned int &numPoints, const floatType &time, const floatType &deltaTime,
+                                       const floatType *temperature, const floatType *previousTemperature,
+                                       const floatType *deformationGradient, const floatType *previousDeformationGradient,
+                                       const floatType *previousStateVariables,
+                                       floatType *cauchyStress, floatType *stateVariables,
+                                       floatType *dCauchyStressdF, floatType *dCauchyStressdT ){
+        /*!
+         * Evaluate the hydra object at each of the points. If the evaluation of a point fails the exception is
+         * re-thrown and getNumEvaluatedPoints gives the index of the failed point.
+         *
+         * \param &numPoints: The number of points
+         * \param &time: The current time
+         * \param &deltaTime: The change in time
+         * \param *temperature: The current temperatures (N)
+         * \param *previousTemperature: The previous temperatures (N)
+         * \param *deformationGradient: The current deformation gradients (dim**2 x N)
+         * \param *previousDeformationGradient: The previous deformation gradients (dim**2 x N)
+         * \param *previousStateVariables: The previous state variables (number of state variables x N)
+         * \param *cauchyStress: The Cauchy stresses (dim**2 x N)
+         * \param *stateVariables: The updated state variables (number of state variables x N)
+         * \param *dCauchyStressdF: The total derivatives of the Cauchy stresses w.r.t. the deformation gradients
+         *     (dim**4 x N). Not computed if NULL.
+         * \param *dCauchyStressdT: The total derivatives of the Cauchy stresses w.r.t. the temperatures (dim**2 x N).
+         *     Not computed if NULL.
+         */
+
+        materialPointBuffers buffers = { numPoints, time, deltaTime, temperature, previousTemperature,
+                                         deformationGradient, previousDeformationGradient, previousStateVariables,
+                                         cauchyStress, stateVariables, dCauchyStressdF, dCauchyStressdT };
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( evaluate( buffers ) );
+
+    }
+
+    void materialPointBatch::evaluate( const materialPointBuffers &buffers ){
+        /*!
+         * Evaluate the hydra object at each of the points. If the evaluation of a point fails the exception is
+         * re-thrown and getNumEvaluatedPoints gives the index of the failed point.
+         *
+         * \param &buffers: The buffers of the points
+         */
+
+        _numEvaluatedPoints = 0;
+
+        for ( unsigned int p = 0; p < buffers.numPoints; p++ ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( evaluatePoint( buffers, p ) );
+
+            _numEvaluatedPoints++;
+
+        }
+
+    }
+
+    void materialPointBatch::evaluatePoint( const materialPointBuffers &buffers, const unsigned int &point ){
+        /*!
+         * Evaluate the hydra object at one of the points
+         *
+         * \param &buffers: The buffers of the points
+         * \param &point: The index of the point to evaluate
+         */
+
+        const unsigned int numPoints = buffers.numPoints;
+
+        const unsigned int sot_dim = ( *_hydra->getDimension( ) ) * ( *_hydra->getDimension( ) );
+
+        const unsigned int numStateVariables = _hydra->getPreviousStateVariables( )->size( );
+
+        _deformationGradient.resize( sot_dim );
+
+        _previousDeformationGradient.resize( sot_dim );
+
+        _previousStateVariables.resize( numStateVariables );
+
+        // Gather the inputs of the point
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+            _deformationGradient[ i ] = buffers.deformationGradient[ numPoints * i + point ];
+
+            _previousDeformationGradient[ i ] = buffers.previousDeformationGradient[ numPoints * i + point ];
+
+        }
+
+        for ( unsigned int i = 0; i < numStateVariables; i++ ){
+
+            _previousStateVariables[ i ] = buffers.previousStateVariables[ numPoints * i + point ];
+
+        }
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( _hydra->setMaterialPoint( buffers.time, buffers.deltaTime, buffers.temperature[ point ], buffers.previousTemperature[ point ],
+                                                                _deformationGradient.data( ), _previousDeformationGradient.data( ),
+                                                                _previousStateVariables.data( ) ) );
+
+        TARDIGRADE_ERROR_TOOLS_CATCH( _hydra->evaluate( ) );
+
+        // Scatter the outputs of the point
+        const floatVector *unknownVector = _hydra->getUnknownVector( );
+
+        for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+            buffers.cauchyStress[ numPoints * i + point ] = ( *unknownVector )[ i ];
+
+        }
+
+        const floatVector *updatedStateVariables;
+        TARDIGRADE_ERROR_TOOLS_CATCH( updatedStateVariables = _hydra->getUpdatedStateVariables( ) );
+
+        for ( unsigned int i = 0; i < numStateVariables; i++ ){
+
+            buffers.stateVariables[ numPoints * i + point ] = ( *updatedStateVariables )[ i ];
+
+        }
+
+        if ( buffers.dCauchyStressdF ){
+
+            const floatVector *flatdXdF;
+            TARDIGRADE_ERROR_TOOLS_CATCH( flatdXdF = _hydra->getFlatdXdF( ) );
+
+            // The Cauchy stress is the leading block of the unknown vector
+            for ( unsigned int i = 0; i < sot_dim * sot_dim; i++ ){
+
+                buffers.dCauchyStressdF[ numPoints * i + point ] = ( *flatdXdF )[ i ];
+
+            }
+
+        }
+
+        if ( buffers.dCauchyStressdT ){
+
+            const floatVector *dXdT;
+            TARDIGRADE_ERROR_TOOLS_CATCH( dXdT = _hydra->getdXdT( ) );
+
+            for ( unsigned int i = 0; i < sot_dim; i++ ){
+
+                buffers.dCauchyStressdT[ numPoints * i + point ] = ( *dXdT )[ i ];
+
+            }
+
+        }
+
+    }
+
+    parallelMaterialPointBatch::parallelMaterialPointBatch( const std::vector< hydraBase* > &hydras ){
+        /*!
+         * Construct the parallel batch evaluator
+         *
+         * \param &hydras: The hydra objects used by each of the threads. The objects must be distinct and have the
+         *     same parameters and number of state variables.
+         */
+
+        if ( hydras.size( ) == 0 ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "At least one hydra object is required" ) );
+
+        }
+
+        _batches.reserve( hydras.size( ) );
+
+        for ( auto h = hydras.begin( ); h != hydras.end( ); h++ ){
+
+            _batches.push_back( materialPointBatch( *h ) );
+
+        }
+
+        // The calling thread is the first worker so only the remaining workers are started
+        _workers.reserve( hydras.size( ) - 1 );
+
+        try{
+
+            for ( unsigned int t = 1; t < hydras.size( ); t++ ){
+
+                _workers.push_back( std::thread( &parallelMaterialPointBatch::runWorker, this, t ) );
+
+            }
+
+        }
+        catch( ... ){
+
+            shutDownWorkers( );
+
+            throw;
+
+        }
+
+    }
+
+    parallelMaterialPointBatch::~parallelMaterialPointBatch( ){
+        /*!
+         * Stop the worker threads
+         */
+
+        shutDownWorkers( );
+
+    }
+
+    void parallelMaterialPointBatch::shutDownWorkers( ){
+        /*!
+         * Signal the worker threads to exit and wait for them to do so
+         */
+
+        {
+
+            std::lock_guard< std::mutex > lock( _poolMutex );
+
+            _isShuttingDown = true;
+
+        }
+
+        _workAvailable.notify_all( );
+
+        for ( auto t = _workers.begin( ); t != _workers.end( ); t++ ){
+
+            t->join( );
+
+        }
+
+        _workers.clear( );
+
+    }
+
+    void parallelMaterialPointBatch::runWorker( const unsigned int thread ){
+        /*!
+         * The loop of a worker thread. The worker waits until a batch is handed out, performs its part of the batch,
+         * and reports back to the calling thread until the pool shuts down.
+         *
+         * \param thread: The index of the thread which selects the hydra object and queue of the worker
+         */
+
+        unsigned long long generation = 0;
+
+        while ( true ){
+
+            const std::function< void( const unsigned int ) > *task;
+
+            {
+
+                std::unique_lock< std::mutex > lock( _poolMutex );
+
+                _workAvailable.wait( lock, [ & ]{ return _isShuttingDown || ( _generation != generation ); } );
+
+                if ( _isShuttingDown ){
+
+                    return;
+
+                }
+
+                generation = _generation;
+
+                task = _task;
+
+            }
+
+            ( *task )( thread );
+
+            {
+
+                std::lock_guard< std::mutex > lock( _poolMutex );
+
+                _numActiveWorkers--;
+
+            }
+
+            _workDone.notify_one( );
+
+        }
+
+    }
+
+    void parallelMaterialPointBatch::setGrainSize( const unsigned int &grainSize ){
+        /*!
+         * Set the number of points in each chunk of work
+         *
+         * \param &grainSize: The number of points in each chunk. Must be greater than zero.
+         */
+
+        if ( grainSize == 0 ){
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "The grain size must be greater than zero" ) );
+
+        }
+
+        _grainSize = grainSize;
+
+    }
+
+    namespace{
+
+        /*!
+         * A queue of chunks of points which may be stolen from by other threads
+         */
+        struct chunkQueue{
+
+            std::mutex mutex; //!< The mutex protecting the queue
+
+            std::deque< std::pair< unsigned int, unsigned int > > chunks; //!< The first and last (not included) points of each chunk
+
+        };
+
+    }
+
+    void parallelMaterialPointBatch::evaluate( const materialPointBuffers &buffers ){
+        /*!
+         * Evaluate the points using one thread for each hydra object. If the evaluation of any point fails the
+         * remaining chunks are abandoned, getFailedPoint gives the lowest index of the points which failed, and the
+         * exception of that point is re-thrown.
+         *
+         * \param &buffers: The buffers of the points
+         */
+
+        const unsigned int numThreads = _batches.size( );
+
+        std::vector< chunkQueue > queues( numThreads );
+
+        // Distribute contiguous blocks of chunks across the threads
+        const unsigned int numChunks = ( buffers.numPoints + _grainSize - 1 ) / _grainSize;
+
+        for ( unsigned int c = 0; c < numChunks; c++ ){
+
+            queues[ ( ( unsigned long long )c * numThreads ) / numChunks ].chunks.push_back( std::make_pair( c * _grainSize, std::min( ( c + 1 ) * _grainSize, buffers.numPoints ) ) );
+
+        }
+
+        std::atomic< bool > hasFailed( false );
+
+        std::vector< unsigned int > failedPoints( numThreads, buffers.numPoints );
+
+        std::vector< std::exception_ptr > errors( numThreads );
+
+        const std::function< void( const unsigned int ) > worker = [ & ]( const unsigned int thread ){
+
+            while ( !hasFailed ){
+
+                std::pair< unsigned int, unsigned int > chunk;
+
+                bool hasChunk = false;
+
+                {
+
+                    std::lock_guard< std::mutex > lock( queues[ thread ].mutex );
+
+                    if ( !queues[ thread ].chunks.empty( ) ){
+
+                        chunk = queues[ thread ].chunks.front( );
+
+                        queues[ thread ].chunks.pop_front( );
+
+                        hasChunk = true;
+
+                    }
+
+                }
+
+                // Steal from the back of the other queues
+                for ( unsigned int offset = 1; !hasChunk && ( offset < numThreads ); offset++ ){
+
+                    chunkQueue &victim = queues[ ( thread + offset ) % numThreads ];
+
+                    std::lock_guard< std::mutex > lock( victim.mutex );
+
+                    if ( !victim.chunks.empty( ) ){
+
+                        chunk = victim.chunks.back( );
+
+                        victim.chunks.pop_back( );
+
+                        hasChunk = true;
+
+                    }
+
+                }
+
+                if ( !hasChunk ){
+
+                    return;
+
+                }
+
+                for ( unsigned int p = chunk.first; p < chunk.second; p++ ){
+
+                    try{
+
+                        _batches[ thread ].evaluatePoint( buffers, p );
+
+                    }
+                    catch( ... ){
+
+                        failedPoints[ thread ] = p;
+
+                        errors[ thread ] = std::current_exception( );
+
+                        hasFailed = true;
+
+                        return;
+
+                    }
+
+                }
+
+            }
+
+        };
+
+        // Hand the batch to the waiting workers and take part in it from the calling thread
+        {
+
+            std::lock_guard< std::mutex > lock( _poolMutex );
+
+            _task = &worker;
+
+            _numActiveWorkers = _workers.size( );
+
+            _generation++;
+
+        }
+
+        _workAvailable.notify_all( );
+
+        worker( 0 );
+
+        {
+
+            std::unique_lock< std::mutex > lock( _poolMutex );
+
+            _workDone.wait( lock, [ & ]{ return _numActiveWorkers == 0; } );
+
+            _task = NULL;
+
+        }
+
+        auto failedThread = std::min_element( failedPoints.begin( ), failedPoints.end( ) );
+
+        _failedPoint = *failedThread;
+
+        if ( _failedPoint < buffers.numPoints ){
+
+            std::rethrow_exception( errors[ failedThread - failedPoints.begin( ) ] );
+
+        }
+
+    }
+
+    errorOut dummyMaterialModel( floatVector &stress,             floatVector &statev,        floatMatrix &ddsdde,       floatType &SSE,            floatType &SPD,
+                                 floatType &SCD,                  floatType &RPL,             floatVector &ddsddt,       floatVector &drplde,       floatType &DRPLDT,
+                                 const floatVector &strain,       const floatVector &dstrain, const floatVector &time,   const floatType &DTIME,    const floatType &TEMP,
+                                 const floatType &DTEMP,          const floatVector &predef,  const floatVector &dpred,  const std::string &cmname, const int &NDI,
+                                 const int &NSHR,                 const int &NTENS,           const int &NSTATV,         const floatVector &props,  const int &NPROPS,
+                                 const floatVector &coords,       const floatMatrix &drot,    floatType &PNEWDT,         const floatType &CELENT,   const floatMatrix &dfgrd0,
+                                 const floatMatrix &dfgrd1,       const int &NOEL,            const int &NPT,            const int &LAYER,          const int &KSPT,
+                                 const std::vector< int > &jstep, const int &KINC ){
+        /*!
+         * A template Abaqus c++ UMAT using c++ STL types. Variables in all caps reference ABAQUS FORTRAN
+         * memory directly. Variables in lower case are native c++ type conversions stored separately from the original
+         * ABAQUS FORTRAN memory.
+         */
+
+        //Call functions of constitutive model to do things
+        errorOut error = sayHello( "Abaqus" );
+
+        //Error handling
+        if ( error ){
+            errorOut result = new errorNode( __func__, "Error when calling sayHello" );
+            result->addNext( error );
+            return result;
+        }
+
+        return NULL;
+    }
+
+    //! The hydra model built for an Abaqus material on the current thread
+    struct abaqusMaterialInstance{
+
+        std::string name; //!< The name of the material
+
+        std::unique_ptr< hydraBase > model; //!< The configured hydra model
+
+    };
+
+    //! The hydra models built on the current thread. Models are never shared between threads.
+    static thread_local std::vector< abaqusMaterialInstance > abaqusMaterialInstances;
+
+    //! The mutex guarding the registry of Abaqus materials
+    static std::mutex abaqusMaterialRegistryMutex;
+
+    static std::map< std::string, abaqusMaterialFactory > &getAbaqusMaterialRegistry( ){
+        /*!
+         * Get the registry of the Abaqus materials which are evaluated by hydra models
+         */
+
+        static std::map< std::string, abaqusMaterialFactory > registry;
+
+        return registry;
+
+    }
+
+    //! The Voigt ordering of the stress components used by Abaqus
+    static const int abaqusVoigtIndices[ 6 ][ 2 ] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 0, 1 }, { 0, 2 }, { 1, 2 } };
+
+    static int getAbaqusVoigtIndex( const int &NDI, const int &component ){
+        /*!
+         * Get the row of abaqusVoigtIndices of a component of an Abaqus stress vector
+         *
+         * \param &NDI: The number of direct stress components
+         * \param &component: The index of the component in the Abaqus stress vector
+         */
+
+        return ( component < NDI ) ? component : spatialDimensions + component - NDI;
+
+    }
+
+    static unsigned int getAbaqusNameLength( const char *CMNAME ){
+        /*!
+         * Get the length of an Abaqus material name without the Fortran padding
+         *
+         * \param *CMNAME: The material name which is at most 80 characters long and may be padded with spaces
+         */
+
+        unsigned int length = 0;
+
+        while ( ( length < 80 ) && ( CMNAME[ length ] != '\0' ) ){ length++; }
+
+        while ( ( length > 0 ) && ( CMNAME[ length - 1 ] == ' ' ) ){ length--; }
+
+        return length;
+
+    }
+
+    void registerAbaqusMaterial( const std::string &name, const abaqusMaterialFactory &factory ){
+        /*!
+         * Register a hydra model for an Abaqus material. Calls of abaqusInterface for the material will be evaluated by
+         * the model rather than the template material model. A material which is already registered is replaced for
+         * the threads which have not yet built it.
+         *
+         * \param &name: The name of the material as given in the Abaqus input file
+         * \param &factory: The function which builds the configured hydra model
+         */
+
+        std::lock_guard< std::mutex > lock( abaqusMaterialRegistryMutex );
+
+        getAbaqusMaterialRegistry( )[ name ] = factory;
+
+    }
+
+    void computeAbaqusTangent( const floatVector &cauchyStress, const floatMatrix &dCauchyStressdF,
+                               const floatType *deformationGradient, const int &NDI, const int &NSHR, double *DDSDDE ){
+        /*!
+         * Compute the Abaqus material Jacobian from the total derivative of the Cauchy stress w.r.t. the deformation
+         * gradient. Abaqus expects the tangent of the Jaumann rate of the Kirchhoff stress divided by the Jacobian of
+         * deformation i.e.
+         *
+         * \f$ C_{ijkl} = \frac{1}{2} \left( \frac{\partial \sigma_{ij}}{\partial F_{kM}} F_{lM} + \frac{\partial \sigma_{ij}}{\partial F_{lM}} F_{kM} \right) + \sigma_{ij} \delta_{kl} \f$
+         *
+         * \param &cauchyStress: The Cauchy stress
+         * \param &dCauchyStressdF: The derivative of the Cauchy stress w.r.t. the deformation gradient
+         * \param *deformationGradient: The row-major deformation gradient
+         * \param &NDI: The number of direct stress components
+         * \param &NSHR: The number of shear stress components
+         * \param *DDSDDE: The column-major Abaqus material Jacobian
+         */
+
+        const int NTENS = NDI + NSHR;
+
+        for ( int p = 0; p < NTENS; p++ ){
+
+            const int *ij = abaqusVoigtIndices[ getAbaqusVoigtIndex( NDI, p ) ];
+
+            const floatVector &dSigmadF = dCauchyStressdF[ spatialDimensions * ij[ 0 ] + ij[ 1 ] ];
+
+            for ( int q = 0; q < NTENS; q++ ){
+
+                const int *kl = abaqusVoigtIndices[ getAbaqusVoigtIndex( NDI, q ) ];
+
+                floatType value = 0;
+
+                for ( int M = 0; M < spatialDimensions; M++ ){
+
+                    value += 0.5 * ( dSigmadF[ spatialDimensions * kl[ 0 ] + M ] * deformationGradient[ spatialDimensions * kl[ 1 ] + M ]
+                                   + dSigmadF[ spatialDimensions * kl[ 1 ] + M ] * deformationGradient[ spatialDimensions * kl[ 0 ] + M ] );
+
+                }
+
+                if ( kl[ 0 ] == kl[ 1 ] ){
+
+                    value += cauchyStress[ spatialDimensions * ij[ 0 ] + ij[ 1 ] ];
+
+                }
+
+                DDSDDE[ p + NTENS * q ] = value;
+
+            }
+
+        }
+
+    }
+
+    bool abaqusHydraInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double *DDSDDT,       const double *TIME,
+                               const double &DTIME,  const double &TEMP,   const double &DTEMP,  const char *CMNAME,   const int &NDI,
+                               const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                               double &PNEWDT,       const double *DFGRD0, const double *DFGRD1 ){
+        /*!
+         * Evaluate an Abaqus material point with the hydra model registered for the material. The model is built the
+         * first time the material is evaluated on a thread and is moved to the new material point afterwards rather than
+         * rebuilt. The deformation gradients (transposed from Abaqus' column-major storage) and the state variables are
+         * copied into the model by hydraBase::setMaterialPoint, and the stress, its derivatives, and the updated state
+         * variables are copied back out to the Abaqus arrays. If the solve fails a smaller increment is requested
+         * through PNEWDT. The stress is returned in the global basis so local orientations are not supported.
+         *
+         * Returns false without modifying any of the outputs if no model is registered for the material.
+         *
+         * \param *STRESS: The stress at the end of the increment
+         * \param *STATEV: The state variables which are updated to the end of the increment
+         * \param *DDSDDE: The material Jacobian
+         * \param *DDSDDT: The derivative of the stress w.r.t. the temperature
+         * \param *TIME: The step and total time at the beginning of the increment
+         * \param &DTIME: The time increment
+         * \param &TEMP: The temperature at the beginning of the increment
+         * \param &DTEMP: The temperature increment
+         * \param *CMNAME: The name of the material
+         * \param &NDI: The number of direct stress components
+         * \param &NSHR: The number of shear stress components
+         * \param &NTENS: The number of stress components
+         * \param &NSTATV: The number of state variables
+         * \param *PROPS: The material properties
+         * \param &NPROPS: The number of material properties
+         * \param &PNEWDT: The ratio of the suggested to the current time increment
+         * \param *DFGRD0: The deformation gradient at the beginning of the increment
+         * \param *DFGRD1: The deformation gradient at the end of the increment
+         */
+
+        const unsigned int nameLength = getAbaqusNameLength( CMNAME );
+
+        hydraBase *model = NULL;
+
+        for ( auto instance = abaqusMaterialInstances.begin( ); instance != abaqusMaterialInstances.end( ); instance++ ){
+
+            if ( ( instance->name.size( ) == nameLength ) && ( instance->name.compare( 0, nameLength, CMNAME, nameLength ) == 0 ) ){
+
+                model = instance->model.get( );
+
+                break;
+
+            }
+
+        }
+
+        abaqusMaterialFactory factory;
+
+        if ( !model ){
+
+            std::lock_guard< std::mutex > lock( abaqusMaterialRegistryMutex );
+
+            auto entry = getAbaqusMaterialRegistry( ).find( std::string( CMNAME, nameLength ) );
+
+            if ( entry == getAbaqusMaterialRegistry( ).end( ) ){
+
+                return false;
+
+            }
+
+            factory = entry->second;
+
+        }
+
+        if ( ( NDI != spatialDimensions ) || ( NSHR > spatialDimensions ) || ( NTENS != NDI + NSHR ) ){
+
+            std::string message = "The hydra Abaqus interface requires " + std::to_string( spatialDimensions ) + " direct stress components. Found ";
+            message            += std::to_string( NDI ) + " direct and " + std::to_string( NSHR ) + " shear components";
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+        }
+
+        // Abaqus stores the deformation gradients column-major
+        floatType deformationGradient[ spatialDimensions * spatialDimensions ];
+
+        floatType previousDeformationGradient[ spatialDimensions * spatialDimensions ];
+
+        for ( int i = 0; i < spatialDimensions; i++ ){
+
+            for ( int j = 0; j < spatialDimensions; j++ ){
+
+                deformationGradient[ spatialDimensions * i + j ] = DFGRD1[ i + spatialDimensions * j ];
+
+                previousDeformationGradient[ spatialDimensions * i + j ] = DFGRD0[ i + spatialDimensions * j ];
+
+            }
+
+        }
+
+        const floatType time = TIME[ 1 ] + DTIME;
+
+        const floatType temperature = TEMP + DTEMP;
+
+        if ( !model ){
+
+            abaqusMaterialInstance instance;
+
+            instance.name = std::string( CMNAME, nameLength );
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( instance.model = factory( time, DTIME, temperature, TEMP,
+                                                                    floatVector( deformationGradient, deformationGradient + spatialDimensions * spatialDimensions ),
+                                                                    floatVector( previousDeformationGradient, previousDeformationGradient + spatialDimensions * spatialDimensions ),
+                                                                    floatVector( STATEV, STATEV + NSTATV ), floatVector( PROPS, PROPS + NPROPS ) ) );
+
+            if ( !instance.model ){
+
+                std::string message = "The factory of the material " + instance.name + " did not build a model";
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
+
+            abaqusMaterialInstances.push_back( std::move( instance ) );
+
+            model = abaqusMaterialInstances.back( ).model.get( );
+
+        }
+
+        if ( model->getPreviousStateVariables( )->size( ) != ( unsigned int )NSTATV ){
+
+            std::string message = "The hydra model of the material " + std::string( CMNAME, nameLength ) + " requires ";
+            message            += std::to_string( model->getPreviousStateVariables( )->size( ) ) + " state variables. Found " + std::to_string( NSTATV );
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+        }
+
+        model->setMaterialPoint( time, DTIME, temperature, TEMP, deformationGradient, previousDeformationGradient, STATEV );
+
+        try{
+
+            model->evaluate( );
+
+        }
+        catch( std::exception &e ){
+
+            tardigradeErrorTools::printNestedExceptions( e );
+
+            PNEWDT = std::min( PNEWDT, 0.5 );
+
+            return true;
+
+        }
+
+        const floatVector *cauchyStress = model->getCauchyStress( );
+
+        const floatVector *dCauchyStressdT = model->getdCauchyStressdT( );
+
+        for ( int p = 0; p < NTENS; p++ ){
+
+            const int *ij = abaqusVoigtIndices[ getAbaqusVoigtIndex( NDI, p ) ];
+
+            STRESS[ p ] = ( *cauchyStress )[ spatialDimensions * ij[ 0 ] + ij[ 1 ] ];
+
+            DDSDDT[ p ] = ( *dCauchyStressdT )[ spatialDimensions * ij[ 0 ] + ij[ 1 ] ];
+
+        }
+
+        computeAbaqusTangent( *cauchyStress, *model->getdCauchyStressdF( ), deformationGradient, NDI, NSHR, DDSDDE );
+
+        const floatVector *updatedStateVariables = model->getUpdatedStateVariables( );
+
+        std::copy( updatedStateVariables->begin( ), updatedStateVariables->end( ), STATEV );
+
+        return true;
+
+    }
+
+    void abaqusInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                          double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                          const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                          const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                          const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                          const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                          const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                          const int *JSTEP,     const int &KINC ){
+        /*!
+         * A template Abaqus UMAT c++ interface that performs Fortran to C++ type conversions, calculates the material
+         * model's expected input, handles tensor shape changes, and calls a c++ material model.
+         *
+         * Materials with a registered hydra model are evaluated by abaqusHydraInterface without the conversions to
+         * vectors and matrices of the template interface.
+         */
+
+        if ( abaqusHydraInterface( STRESS, STATEV, DDSDDE, DDSDDT, TIME, DTIME, TEMP, DTEMP, CMNAME, NDI, NSHR, NTENS, NSTATV,
+                                   PROPS, NPROPS, PNEWDT, DFGRD0, DFGRD1 ) ){
+
+            return;
+
+        }
+
         //Initialize error return codes
         errorOut error = NULL;
 
@@ -11,11 +11,26 @@
 
 #include<sstream>
 #include<functional>
+#include<numeric>
+#include<algorithm>
+#include<limits>
+#include<ostream>
+#include<chrono>
+#include<typeinfo>
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<atomic>
+#include<deque>
+#include<exception>
+#include<memory>
+#include<map>
 
 #include<tardigrade_error_tools.h>
 #define USE_EIGEN
 #include<tardigrade_vector_tools.h>
 #include<tardigrade_abaqus_tools.h>
+#include<Eigen/Dense>
 
 namespace tardigradeHydra{
 
@@ -64,607 +79,2235 @@ namespace tardigradeHydra{
     typedef double floatType; //!< Define the float values type.
     typedef std::vector< floatType > floatVector; //!< Define a vector of floats
     typedef std::vector< std::vector< floatType > > floatMatrix; //!< Define a matrix of floats
+    typedef Eigen::Matrix< floatType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > floatRowMajorMatrix; //!< Define a dynamically sized row-major matrix of floats
 
     typedef void ( hydraBase::*hydraBaseFxn )( ); //!< Typedef for passing pointers to hydraBase functions
 
     /*!
-     * Base class for data objects which defines the clear command
+     * Fixed-size types for quantities whose size is determined by the spatial dimension.
+     *
+     * These are used by the kernels of hydraBase which operate on the configurations so that
+     * the intermediate quantities live on the stack and the loops can be unrolled when the
+     * dimension is known at compile time.
      */
-    class dataBase{
-
-        public:
+    template< unsigned int dim >
+    struct fixedSizeTypes{
 
-            virtual void clear( ){
-                /*!
-                 * The function to erase the current values stored
-                 */
+        typedef Eigen::Matrix< floatType, dim, dim, Eigen::RowMajor > secondOrderTensor; //!< A row-major second order tensor
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "clear not implemented!" ) );
+        typedef Eigen::Map< secondOrderTensor > secondOrderTensorMap; //!< A map of a row-major second order tensor
 
-            }
+        typedef Eigen::Map< const secondOrderTensor > constSecondOrderTensorMap; //!< A map of a constant row-major second order tensor
 
     };
 
     /*!
-     * Custom data storage object that allows for smart storage of objects
+     * Flags which define the derivatives of the residual which are requested from the residual classes.
+     *
+     * Residual classes may skip the computation of any derivative that has not been requested. The flags
+     * may be combined with a bitwise or.
      */
-    template < typename T >
-    class dataStorage : public dataBase{
+    namespace derivativeRequest{
+
+        constexpr unsigned int jacobian              = 1 << 0; //!< The jacobian of the residual w.r.t. the unknown vector
+
+        constexpr unsigned int dRdF                  = 1 << 1; //!< The derivative of the residual w.r.t. the deformation gradient
+
+        constexpr unsigned int dRdT                  = 1 << 2; //!< The derivative of the residual w.r.t. the temperature
+
+        constexpr unsigned int additionalDerivatives = 1 << 3; //!< The additional derivatives of the residual
+
+        constexpr unsigned int all                   = jacobian | dRdF | dRdT | additionalDerivatives; //!< All of the derivatives
+
+    }
+
+    /*!
+     * The partial-pivoting LU factorization of the jacobian of the non-linear problem.
+     *
+     * Unknowns which are defined explicitly by a residual (i.e., the residual equations are of the form
+     * \f$ R_i = g_i - X_{u_i} \f$ where \f$ g_i \f$ does not depend on the unknown vector) are statically
+     * condensed out of the system so that only the jacobian of the implicit unknowns is factored.
+     *
+     * If the block sparsity of the jacobian is provided the implicit system is factored by block elimination
+     * (i.e., a sequence of Schur complements) which skips the blocks that are identically zero.
+     *
+     * If the Cauchy stress is symmetric the nine stress unknowns (the first nine unknowns) may be reduced to their six
+     * independent components and the symmetric pairs of the stress equations averaged before the system is factored.
+     * The reduction is only used if each symmetric pair of stress equations is the same equation on the symmetric
+     * stresses (see hasSymmetricStressEquations). Otherwise the full jacobian is factored.
+     */
+    class jacobianFactorization{
 
         public:
 
-            bool first = false; //!< The flag for whether the data has been stored
+            void compute( const floatVector &jacobian, const unsigned int &numUnknowns,
+                          const std::vector< unsigned int > &explicitEquations, const std::vector< unsigned int > &explicitUnknowns,
+                          const std::vector< unsigned int > &blockSizes = { }, const std::vector< bool > &blockSparsity = { },
+                          const bool symmetricStress = false );
 
-            T second; //!< The stored data
+            floatType rcond( ) const;
 
-            dataStorage( ){ };
+            //! Get the number of unknowns which were condensed out of the factored jacobian
+            unsigned int getNumCondensedUnknowns( ) const { return _explicitUnknowns.size( ); }
 
-            /*!
-             * Constructor for a data-storage object setting first and second
-             * 
-             * \param &_first: The flag for whether the data storage has been set
-             * \param &_second: The data contained by the object
-             */
-            dataStorage( const bool &_first, const T &_second ) : first( _first ), second( _second ) { }
+            //! Check if the implicit system was factored using block elimination
+            bool usesBlockElimination( ) const { return _useBlockElimination; }
 
-            virtual void clear( ){
+            //! Check if the stress unknowns were reduced to their symmetric components
+            bool usesSymmetricStress( ) const { return _useSymmetricStress; }
+
+            template< class rhsType >
+            Eigen::Matrix< floatType, Eigen::Dynamic, rhsType::ColsAtCompileTime > solve( const Eigen::MatrixBase< rhsType > &rhs ) const{
                 /*!
-                 * The function to erase the current values stored by setting first to false and clearing second
+                 * Solve the linear system defined by the jacobian for the right hand side
+                 *
+                 * \param &rhs: The right hand side which may have multiple columns
                  */
 
-                first = false;
+                Eigen::Matrix< floatType, Eigen::Dynamic, rhsType::ColsAtCompileTime > x( rhs.rows( ), rhs.cols( ) );
 
-                second.clear( );
+                solve( rhs, x );
 
-            }
+                return x;
 
-    };
+            }
 
-    template <>
-    inline void dataStorage< int >::clear( ){
+            template< class rhsType, class solutionType >
+            void solve( const Eigen::MatrixBase< rhsType > &rhs, Eigen::MatrixBase< solutionType > &x ) const{
                 /*!
-                 * The function to erase the current values stored by setting first to false and second to zero
+                 * Solve the linear system defined by the jacobian for the right hand side into the provided solution.
+                 * The intermediate quantities are stored in workspace owned by the factorization so no memory is
+                 * allocated once the sizes of the system and of the right hand side stop changing.
+                 *
+                 * If the stress unknowns were reduced the symmetric pairs of the stress rows of the right hand side are
+                 * averaged and the stress components of the solution are expanded from the reduced solution.
+                 *
+                 * \param &rhs: The right hand side which may have multiple columns
+                 * \param &x: The solution. Must be the same size as the right hand side and must not alias it.
                  */
 
-        first = false;
+                if ( !_useSymmetricStress ){
 
-        second = 0;
+                    solveCondensed( rhs, x );
 
-    }
+                    return;
 
-    template <>
-    inline void dataStorage< unsigned int >::clear( ){
-                /*!
-                 * The function to erase the current values stored by setting first to false and second to zero
-                 */
+                }
 
-        first = false;
+                const unsigned int numRows = rhs.rows( );
 
-        second = 0;
+                _symmetricRHS.resize( numRows - 3, rhs.cols( ) );
 
-    }
+                _symmetricSolution.resize( numRows - 3, rhs.cols( ) );
 
-    template <>
-    inline void dataStorage< floatType >::clear( ){
-                /*!
-                 * The function to erase the current values stored by setting first to false and second to zero
-                 */
+                for ( unsigned int v = 0; v < 6; v++ ){
 
-        first = false;
+                    _symmetricRHS.row( v ) = 0.5 * ( rhs.row( getSymmetricStressIndex( v ) ) + rhs.row( getSymmetricStressMirrorIndex( v ) ) );
 
-        second = 0;
+                }
 
-    }
+                _symmetricRHS.bottomRows( numRows - 9 ) = rhs.bottomRows( numRows - 9 );
 
-    /*!
-     * A custom error for use with failures in convergence of the solver.
-     */
-    class convergence_error : public std::exception{
+                solveCondensed( _symmetricRHS, _symmetricSolution );
+
+                for ( unsigned int v = 0; v < 6; v++ ){
+
+                    x.row( getSymmetricStressIndex( v ) ) = _symmetricSolution.row( v );
+
+                    x.row( getSymmetricStressMirrorIndex( v ) ) = _symmetricSolution.row( v );
+
+                }
+
+                x.bottomRows( numRows - 9 ) = _symmetricSolution.bottomRows( numRows - 9 );
+
+            }
 
         private:
-            std::string message_; //!< The output message
 
-        public:
+            /*!
+             * Get the row-major index of the stress component of a reduced stress unknown. The reduced unknowns are
+             * ordered as \f$ 11, 22, 33, 23, 13, 12 \f$.
+             *
+             * \param &v: The index of the reduced stress unknown
+             */
+            static unsigned int getSymmetricStressIndex( const unsigned int &v ){
 
-            //! Constructor
-            explicit convergence_error( const std::string& message ) : message_( message ) { }
+                constexpr unsigned int indices[ 6 ] = { 0, 4, 8, 5, 2, 1 };
 
-            const char *what( ) const noexcept override {
+                return indices[ v ];
+
+            }
+
+            /*!
+             * Get the row-major index of the transpose of the stress component of a reduced stress unknown
+             *
+             * \param &v: The index of the reduced stress unknown
+             */
+            static unsigned int getSymmetricStressMirrorIndex( const unsigned int &v ){
+
+                constexpr unsigned int indices[ 6 ] = { 0, 4, 8, 7, 6, 3 };
+
+                return indices[ v ];
+
+            }
+
+            bool hasSymmetricStressEquations( const floatVector &jacobian, const unsigned int &numUnknowns ) const;
+
+            void computeSymmetricStress( const floatVector &jacobian, const unsigned int &numUnknowns,
+                                         const std::vector< unsigned int > &explicitEquations, const std::vector< unsigned int > &explicitUnknowns,
+                                         const std::vector< unsigned int > &blockSizes, const std::vector< bool > &blockSparsity );
+
+            template< class rhsType, class solutionType >
+            void solveCondensed( const Eigen::MatrixBase< rhsType > &rhs, Eigen::MatrixBase< solutionType > &x ) const{
                 /*!
-                 * Output the message
+                 * Solve the linear system defined by the jacobian for the right hand side
+                 *
+                 * The explicit unknowns are solved for directly and their contribution is removed from the right hand
+                 * side of the implicit equations before solving with the factored jacobian of the implicit unknowns.
+                 *
+                 * \param &rhs: The right hand side which may have multiple columns
+                 * \param &x: The solution. Must be the same size as the right hand side and must not alias it.
                  */
 
-                return message_.c_str( );
+                if ( ( _explicitUnknowns.size( ) == 0 ) && !_useBlockElimination ){
+
+                    x.derived( ) = _lu.solve( rhs );
+
+                    return;
+
+                }
+
+                _reducedRHS.resize( _implicitEquations.size( ), rhs.cols( ) );
+
+                for ( unsigned int i = 0; i < _explicitUnknowns.size( ); i++ ){
+
+                    x.row( _explicitUnknowns[ i ] ) = -rhs.row( _explicitEquations[ i ] );
+
+                }
+
+                for ( unsigned int i = 0; i < _implicitEquations.size( ); i++ ){
+
+                    _reducedRHS.row( i ) = rhs.row( _implicitEquations[ i ] );
+
+                }
+
+                for ( unsigned int i = 0; i < _explicitUnknowns.size( ); i++ ){
+
+                    _reducedRHS.noalias( ) -= _implicitExplicitBlock.col( i ) * x.row( _explicitUnknowns[ i ] );
+
+                }
+
+                solveImplicitSystem( _reducedRHS );
+
+                for ( unsigned int i = 0; i < _implicitUnknowns.size( ); i++ ){
+
+                    x.row( _implicitUnknowns[ i ] ) = _reducedRHS.row( i );
+
+                }
 
             }
 
+            void factorImplicitSystem( const Eigen::Ref< const floatRowMajorMatrix > &jacobian, const std::vector< unsigned int > &blockSizes, const std::vector< bool > &blockSparsity );
+
+            void factorDenseSystem( const Eigen::Ref< const floatRowMajorMatrix > &jacobian );
+
+            void solveImplicitSystem( floatRowMajorMatrix &rhs ) const;
+
+            floatType estimateReciprocalConditionNumber( const Eigen::PartialPivLU< floatRowMajorMatrix > &lu, const floatType &norm ) const;
+
+            Eigen::PartialPivLU< floatRowMajorMatrix > _lu; //!< The factorization of the jacobian of the implicit unknowns
+
+            floatType _norm = 0; //!< The 1-norm of the jacobian of the implicit unknowns
+
+            std::vector< unsigned int > _explicitEquations; //!< The equations which define the explicit unknowns
+
+            std::vector< unsigned int > _explicitUnknowns; //!< The explicit unknowns
+
+            std::vector< unsigned int > _implicitEquations; //!< The equations which define the implicit unknowns
+
+            std::vector< unsigned int > _implicitUnknowns; //!< The implicit unknowns
+
+            std::vector< bool > _isExplicitEquation; //!< Workspace for the flags of the equations which define explicit unknowns
+
+            std::vector< bool > _isExplicitUnknown; //!< Workspace for the flags of the explicit unknowns
+
+            floatRowMajorMatrix _implicitExplicitBlock; //!< The derivatives of the implicit equations w.r.t. the explicit unknowns
+
+            bool _useBlockElimination = false; //!< Flag for whether the implicit system is factored using block elimination
+
+            bool _useSymmetricStress = false; //!< Flag for whether the stress unknowns were reduced to their symmetric components
+
+            floatVector _symmetricJacobian; //!< The jacobian with the stress unknowns reduced to their symmetric components
+
+            std::vector< unsigned int > _symmetricExplicitEquations; //!< The explicit equations of the system with the reduced stress unknowns
+
+            std::vector< unsigned int > _symmetricExplicitUnknowns; //!< The explicit unknowns of the system with the reduced stress unknowns
+
+            std::vector< unsigned int > _symmetricBlockSizes; //!< The block sizes of the system with the reduced stress unknowns
+
+            floatRowMajorMatrix _reducedJacobian; //!< The jacobian of the implicit unknowns if explicit unknowns were condensed out
+
+            std::vector< unsigned int > _blockIndex; //!< Workspace for the block of each unknown
+
+            std::vector< unsigned int > _reducedBlockIndices; //!< Workspace for the blocks which contain implicit unknowns
+
+            std::vector< unsigned int > _reducedBlockSizes; //!< Workspace for the sizes of the blocks of the implicit unknowns
+
+            std::vector< bool > _reducedBlockSparsity; //!< Workspace for the sparsity of the blocks of the implicit unknowns
+
+            std::vector< bool > _isNonZeroBlock; //!< Workspace for the flags of the blocks which are non-zero during the elimination
+
+            std::vector< bool > _isEliminatedBlock; //!< Workspace for the flags of the blocks which have been eliminated
+
+            std::vector< floatRowMajorMatrix > _blocks; //!< Workspace for the blocks of the jacobian during the elimination
+
+            std::vector< unsigned int > _blockOffsets; //!< The offsets of the blocks of the implicit system
+
+            std::vector< unsigned int > _blockSizes; //!< The sizes of the blocks of the implicit system
+
+            std::vector< unsigned int > _eliminationOrder; //!< The order in which the blocks are eliminated
+
+            std::vector< Eigen::PartialPivLU< floatRowMajorMatrix > > _blockLU; //!< The factorizations of the Schur complemented diagonal blocks
+
+            floatVector _blockNorms; //!< The 1-norms of the Schur complemented diagonal blocks
+
+            std::vector< std::vector< std::pair< unsigned int, floatRowMajorMatrix > > > _blockLower; //!< The non-zero blocks below the pivot of each eliminated block
+
+            std::vector< std::vector< std::pair< unsigned int, floatRowMajorMatrix > > > _blockUpper; //!< The non-zero blocks right of the pivot of each eliminated block multiplied by the inverse of the pivot
+
+            // The workspace of the solves. This doesn't change the factorization so it may be modified by the const solves.
+
+            mutable floatRowMajorMatrix _symmetricRHS; //!< The right hand side with the symmetric pairs of the stress rows averaged
+
+            mutable floatRowMajorMatrix _symmetricSolution; //!< The solution of the system with the reduced stress unknowns
+
+            mutable floatRowMajorMatrix _reducedRHS; //!< The right hand side of the implicit equations
+
+            mutable floatRowMajorMatrix _implicitSolution; //!< The solution of a factored diagonal block or of the dense implicit system
+
+            mutable Eigen::Matrix< floatType, Eigen::Dynamic, 1 > _conditionRHS; //!< The right hand side of the solves of the condition number estimate
+
+            mutable Eigen::Matrix< floatType, Eigen::Dynamic, 1 > _conditionSolution; //!< The solution of the solves of the condition number estimate
+
+            mutable Eigen::Matrix< floatType, Eigen::Dynamic, 1 > _conditionSign; //!< The signs of the solution of the condition number estimate
+
+            mutable Eigen::Matrix< floatType, Eigen::Dynamic, 1 > _previousConditionSign; //!< The signs of the previous solution of the condition number estimate
+
     };
 
     /*!
-     * A class to contain the residual computations associated with some part of a non-linear solve
+     * The gradient of a sub-configuration \f$ \bf{F}^{sc} = \bf{F}^{l} \bf{F}^{l+1} \cdots \bf{F}^{u-1} \f$ with respect
+     * to all of the configurations stored in factored form.
+     *
+     * The gradient w.r.t. configuration \f$ k \f$ is the Kronecker product
+     *
+     * \f$ \frac{\partial F^{sc}_{iI}}{\partial F^k_{aA}} = F^{-}_{ia} F^{+}_{AI} \f$
+     *
+     * where \f$ \bf{F}^{-} \f$ is the product of the configurations from \f$ l \f$ up to \f$ k \f$ and
+     * \f$ \bf{F}^{+} \f$ is the product of the configurations following \f$ k \f$ up to \f$ u \f$. Applying the
+     * gradient to another operator then requires two products of second order tensors per configuration rather than
+     * a product with the dense ( dim**2, numConfigurations * dim**2 ) matrix.
+     *
+     * The factors are read from a table of sub-configurations (see hydraBase::getSubConfigurationGradientFactors) and
+     * the object is only valid as long as the table is.
      */
-    class residualBase{
+    class subConfigurationGradient{
 
         public:
 
             /*!
-             * Default residual
+             * Construct the gradient
+             *
+             * \param *subConfigurations: The sub-configurations between every pair of indices where the product from
+             *     lowerIndex up to but not including upperIndex is stored at ( numConfigurations + 1 ) * lowerIndex + upperIndex
+             * \param &dimension: The spatial dimension
+             * \param &numConfigurations: The number of configurations
+             * \param &lowerIndex: The index of the lower configuration
+             * \param &upperIndex: The index of the upper configuration (not included in the product)
              */
-            residualBase( ) : hydra( NULL ), _numEquations( 0 ){ };
+            subConfigurationGradient( const floatMatrix *subConfigurations, const unsigned int &dimension, const unsigned int &numConfigurations,
+                                      const unsigned int &lowerIndex, const unsigned int &upperIndex )
+                : _subConfigurations( subConfigurations ), _dimension( dimension ), _numConfigurations( numConfigurations ),
+                  _lowerIndex( lowerIndex ), _upperIndex( upperIndex ){ }
+
+            //! Get the spatial dimension
+            const unsigned int* getDimension( ) const { return &_dimension; }
+
+            //! Get the number of configurations
+            const unsigned int* getNumConfigurations( ) const { return &_numConfigurations; }
+
+            //! Get the index of the lower configuration
+            const unsigned int* getLowerIndex( ) const { return &_lowerIndex; }
+
+            //! Get the index of the upper configuration
+            const unsigned int* getUpperIndex( ) const { return &_upperIndex; }
 
             /*!
-             * Main utilization constructor
-             * 
-             * \param *_hydra: A pointer to a hydraBase object
-             * \param &_numEquations: The number of equations defined by the residual
+             * Get the product of the configurations from the lower index up to but not including the index. The
+             * upper index gives the sub-configuration itself.
+             *
+             * \param &index: The index of the configuration. Must be in [ lowerIndex, upperIndex ]
              */
-            residualBase( hydraBase *_hydra, const unsigned int &_numEquations ) : hydra( _hydra ), _numEquations( _numEquations ){ }
+            const floatVector& getPrecedingFactor( const unsigned int &index ) const{ return ( *_subConfigurations )[ ( _numConfigurations + 1 ) * _lowerIndex + index ]; }
 
             /*!
-             * Copy constructor
-             * 
-             * \param &r: The residual to be copied
+             * Get the product of the configurations following the index up to but not including the upper index
+             *
+             * \param &index: The index of the configuration. Must be in [ lowerIndex, upperIndex )
              */
-            residualBase( residualBase &r ) : hydra( r.hydra ), _numEquations( *r.getNumEquations( ) ){ }
+            const floatVector& getFollowingFactor( const unsigned int &index ) const{ return ( *_subConfigurations )[ ( _numConfigurations + 1 ) * ( index + 1 ) + _upperIndex ]; }
 
-            hydraBase* hydra; //!< The hydra class which owns the residualBase object
+            void leftMultiply( const floatMatrix &A, floatMatrix &result ) const;
 
-            // User defined setter functions
+            floatMatrix toDense( ) const;
 
-            virtual void setResidual( ){
-                /*!
-                 * The user-defined residual equation. Must have a size of numEquations
-                 */
+        private:
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The residual is not implemented" ) );
+            const floatMatrix *_subConfigurations; //!< The sub-configurations between every pair of indices
 
-            }
+            unsigned int _dimension; //!< The spatial dimension
 
-            virtual void setJacobian( ){
-                /*!
-                 * The user-defined jacobian equation. Must have a size of numEquations x numUnknowns
-                 * 
-                 * The order of the unknowns are the cauchy stress, the configurations in order (minus the first one),
-                 * and the state variables solved for in the non-linear solve.
-                 */
+            unsigned int _numConfigurations; //!< The number of configurations
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The jacobian is not implemented" ) );
+            unsigned int _lowerIndex; //!< The index of the lower configuration
+
+            unsigned int _upperIndex; //!< The index of the upper configuration
+
+    };
+
+    void computeFirstConfigurationGradients( const floatVector &deformationGradient, const subConfigurationGradient &dFscdFs,
+                                             floatMatrix &dF1dF, floatMatrix &dF1dFn );
+
+    /*!
+     * Compute the gradients of the first configuration for a spatial dimension known at compile time (see
+     * computeFirstConfigurationGradients). The loops over the components are unrolled by the compiler and each
+     * \f$ dim \times dim \f$ block of the gradients is written as a contiguous outer product.
+     *
+     * \param *deformationGradient: The deformation gradient (dim**2)
+     * \param &dFscdFs: The gradient of the sub-configuration following the first configuration
+     * \param *dF1dF: The row-major gradient of the first configuration w.r.t. the deformation gradient (dim**2 x dim**2)
+     * \param *dF1dFn: The row-major gradient of the first configuration w.r.t. the remaining configurations
+     *     (dim**2 x ( numConfigurations - 1 ) dim**2)
+     */
+    template< unsigned int dim >
+    void computeFixedSizeFirstConfigurationGradients( const floatType *deformationGradient, const subConfigurationGradient &dFscdFs,
+                                                      floatType *dF1dF, floatType *dF1dFn ){
+
+        typedef typename fixedSizeTypes< dim >::secondOrderTensor secondOrderTensor;
+
+        typedef typename fixedSizeTypes< dim >::secondOrderTensorMap secondOrderTensorMap;
+
+        typedef typename fixedSizeTypes< dim >::constSecondOrderTensorMap constSecondOrderTensorMap;
+
+        constexpr unsigned int sot_dim = dim * dim;
+
+        const unsigned int numConfigurations = *dFscdFs.getNumConfigurations( );
+
+        const unsigned int numColumns = sot_dim * ( numConfigurations - 1 );
+
+        const secondOrderTensor invFsc = constSecondOrderTensorMap( dFscdFs.getPrecedingFactor( *dFscdFs.getUpperIndex( ) ).data( ) ).inverse( );
+
+        const secondOrderTensor F1 = constSecondOrderTensorMap( deformationGradient ) * invFsc;
+
+        // dF1_iI / dF_aA = delta_ia invFsc_AI
+        std::fill( dF1dF, dF1dF + sot_dim * sot_dim, 0 );
+
+        for ( unsigned int i = 0; i < dim; i++ ){
+
+            for ( unsigned int I = 0; I < dim; I++ ){
+
+                Eigen::Map< Eigen::Matrix< floatType, 1, dim > >( dF1dF + sot_dim * ( dim * i + I ) + dim * i ) = invFsc.col( I ).transpose( );
 
             }
 
-            virtual void setdRdF( ){
-                /*!
-                 * The user-defined derivative of the residual w.r.t. the deformation gradient.
-                 */
+        }
+
+        // dF1_iI / dFk_aA = -( F1 Fm )_ia ( Fp invFsc )_AI
+        for ( unsigned int index = 1; index < numConfigurations; index++ ){
+
+            const secondOrderTensor left = F1 * constSecondOrderTensorMap( dFscdFs.getPrecedingFactor( index ).data( ) );
+
+            const secondOrderTensor right = constSecondOrderTensorMap( dFscdFs.getFollowingFactor( index ).data( ) ) * invFsc;
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int I = 0; I < dim; I++ ){
+
+                    secondOrderTensorMap( dF1dFn + numColumns * ( dim * i + I ) + sot_dim * ( index - 1 ) ).noalias( )
+                        = -left.row( i ).transpose( ) * right.col( I ).transpose( );
+
+                }
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The derivative of the residual w.r.t. the deformation gradient is not implemented" ) );
- 
             }
 
-            virtual void setdRdT( ){
-                /*!
-                 * The user-defined derivative of the residual w.r.t. the temperature
-                 */
+        }
+
+    }
+
+    /*!
+     * The strategies which may be used to solve the non-linear problem
+     */
+    namespace nonLinearSolver{
+
+        constexpr unsigned int newton         = 0; //!< Newton's method where the jacobian is formed and factored at every iteration
+
+        constexpr unsigned int modifiedNewton = 1; //!< Modified Newton where a factored jacobian is re-used for multiple iterations
+
+        constexpr unsigned int broyden        = 2; //!< Broyden's method where a factored jacobian is corrected with rank-one updates
+
+    }
+
+    /*!
+     * The stages of the evaluation of a residual class which are timed by the solve statistics
+     */
+    namespace residualStage{
+
+        constexpr unsigned int residual    = 0; //!< The evaluation of the residual
+
+        constexpr unsigned int jacobian    = 1; //!< The evaluation of the jacobian
+
+        constexpr unsigned int derivatives = 2; //!< The evaluation of the derivatives w.r.t. the deformation gradient, temperature, and additional quantities
+
+        constexpr unsigned int numStages   = 3; //!< The number of timed stages
+
+    }
+
+    /*!
+     * A histogram of non-negative integer values with logarithmic bins. Bin 0 contains zero and bin \f$ k > 0 \f$
+     * contains the values in \f$ \left[ 2^{k-1}, 2^k \right) \f$. The count, sum, minimum, and maximum are stored
+     * exactly.
+     */
+    class histogram{
+
+        public:
+
+            void addValue( const unsigned long long &value );
+
+            void merge( const histogram &other );
+
+            static unsigned int getBin( const unsigned long long &value );
+
+            //! Get the number of values which have been added
+            const unsigned long long* getCount( ) const { return &_count; }
+
+            //! Get the sum of the values which have been added
+            const unsigned long long* getSum( ) const { return &_sum; }
+
+            //! Get the smallest value which has been added
+            const unsigned long long* getMinimum( ) const { return &_minimum; }
+
+            //! Get the largest value which has been added
+            const unsigned long long* getMaximum( ) const { return &_maximum; }
+
+            //! Get the number of values in each bin
+            const std::vector< unsigned long long >* getBins( ) const { return &_bins; }
+
+            void write( std::ostream &stream ) const;
+
+        private:
+
+            unsigned long long _count = 0; //!< The number of values
+
+            unsigned long long _sum = 0; //!< The sum of the values
+
+            unsigned long long _minimum = std::numeric_limits< unsigned long long >::max( ); //!< The smallest value
+
+            unsigned long long _maximum = 0; //!< The largest value
+
+            std::vector< unsigned long long > _bins; //!< The number of values in each bin
+
+    };
+
+    /*!
+     * Statistics of the non-linear solves aggregated over many calls to hydraBase::evaluate.
+     *
+     * The statistics are only recorded if the library is compiled with TARDIGRADE_HYDRA_SOLVE_STATISTICS defined
+     * and an instance is attached to a hydraBase object with hydraBase::setSolveStatistics. An instance is not
+     * thread safe so each thread should aggregate into its own instance and the instances merged at the end of the
+     * job.
+     *
+     * Allocations are counted using a thread-local counter which is incremented by solveStatistics::countAllocation.
+     * The library does not replace the global allocation functions itself so the counter is only incremented if the
+     * host program calls solveStatistics::countAllocation from its replacement of malloc (or of operator new if Eigen's
+     * allocations, which call malloc directly, are not of interest).
+     */
+    class solveStatistics{
+
+        public:
+
+            void addSolve( const bool &converged, const unsigned int &iterations, const unsigned int &lineSearchIterations,
+                           const unsigned long long &allocations );
+
+            void setResidualName( const unsigned int &residualIndex, const char *residualName );
+
+            void addResidualTime( const unsigned int &residualIndex, const unsigned int &stage, const unsigned long long &nanoseconds );
+
+            void merge( const solveStatistics &other );
+
+            void write( std::ostream &stream ) const;
+
+            static void countAllocation( );
+
+            static unsigned long long getAllocationCount( );
+
+            //! Get the number of solves which have been recorded
+            const unsigned long long* getNumSolves( ) const { return &_numSolves; }
+
+            //! Get the number of solves which failed
+            const unsigned long long* getNumFailedSolves( ) const { return &_numFailedSolves; }
+
+            //! Get the histogram of the number of Newton iterations per solve
+            const histogram* getIterations( ) const { return &_iterations; }
+
+            //! Get the histogram of the number of line search iterations per solve
+            const histogram* getLineSearchIterations( ) const { return &_lineSearchIterations; }
+
+            //! Get the histogram of the number of allocations per solve
+            const histogram* getAllocations( ) const { return &_allocations; }
+
+            //! Get the names of the timed residual classes
+            const std::vector< std::string >* getResidualNames( ) const { return &_residualNames; }
+
+            //! Get the histograms of the time in nanoseconds spent in each stage (see tardigradeHydra::residualStage) of each residual class
+            const std::vector< std::vector< histogram > >* getResidualTimes( ) const { return &_residualTimes; }
+
+        private:
+
+            unsigned long long _numSolves = 0; //!< The number of solves
+
+            unsigned long long _numFailedSolves = 0; //!< The number of solves which failed
+
+            histogram _iterations; //!< The number of Newton iterations per solve
+
+            histogram _lineSearchIterations; //!< The number of line search iterations per solve
+
+            histogram _allocations; //!< The number of allocations per solve
+
+            std::vector< std::string > _residualNames; //!< The names of the timed residual classes
+
+            std::vector< std::vector< histogram > > _residualTimes; //!< The time in nanoseconds spent in each stage of each residual class
+
+    };
+
+    /*!
+     * The flag for whether a data storage object has been set.
+     *
+     * The flag behaves as a bool. If it is bound to an iteration epoch counter (see hydraBase::addIterationData) it
+     * records the epoch it was set in and is only true while the counter is unchanged. Incrementing the counter
+     * invalidates all of the bound flags at once without visiting the data.
+     */
+    class iterationFlag{
+
+        public:
+
+            /*!
+             * Construct the flag
+             *
+             * \param &value: The initial value of the flag
+             */
+            iterationFlag( const bool &value = false ) : _value( value ){ }
+
+            /*!
+             * Set the value of the flag. If the flag is bound to an epoch counter the current epoch is recorded.
+             *
+             * \param &value: The new value of the flag
+             */
+            iterationFlag& operator=( const bool &value ){
+
+                _value = value;
+
+                if ( _epoch ){
+
+                    _setEpoch = *_epoch;
+
+                }
+
+                return *this;
+
+            }
+
+            //! Check if the flag is set in the current epoch
+            operator bool( ) const { return _value && ( !_epoch || ( _setEpoch == *_epoch ) ); }
+
+            /*!
+             * Bind the flag to an epoch counter. The flag is considered to have been set in the current epoch.
+             *
+             * \param *epoch: The epoch counter
+             */
+            void bind( const unsigned long long *epoch ){
+
+                _epoch = epoch;
+
+                _setEpoch = *epoch;
+
+            }
+
+        private:
+
+            bool _value; //!< The value of the flag
+
+            const unsigned long long *_epoch = NULL; //!< The epoch counter the flag is bound to
+
+            unsigned long long _setEpoch = 0; //!< The epoch in which the flag was set
+
+    };
+
+    /*!
+     * Base class for data objects which defines the clear command
+     */
+    class dataBase{
+
+        public:
+
+            virtual void clear( ){
+                /*!
+                 * The function to erase the current values stored
+                 */
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "clear not implemented!" ) );
+
+            }
+
+            virtual void bindToEpoch( const unsigned long long *epoch ){
+                /*!
+                 * Bind the data to an iteration epoch counter so that it is invalidated when the counter is incremented
+                 *
+                 * \param *epoch: The epoch counter
+                 */
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "bindToEpoch not implemented!" ) );
+
+            }
+
+    };
+
+    /*!
+     * Custom data storage object that allows for smart storage of objects
+     */
+    template < typename T >
+    class dataStorage : public dataBase{
+
+        public:
+
+            iterationFlag first = false; //!< The flag for whether the data has been stored
+
+            T second; //!< The stored data
+
+            dataStorage( ){ };
+
+            /*!
+             * Constructor for a data-storage object setting first and second
+             * 
+             * \param &_first: The flag for whether the data storage has been set
+             * \param &_second: The data contained by the object
+             */
+            dataStorage( const bool &_first, const T &_second ) : first( _first ), second( _second ) { }
+
+            virtual void clear( ){
+                /*!
+                 * The function to erase the current values stored by setting first to false and clearing second
+                 */
+
+                first = false;
+
+                second.clear( );
+
+            }
+
+            virtual void bindToEpoch( const unsigned long long *epoch ){
+                /*!
+                 * Bind the data to an iteration epoch counter so that it is invalidated when the counter is
+                 * incremented. The stored values are retained so their storage may be re-used.
+                 *
+                 * \param *epoch: The epoch counter
+                 */
+
+                first.bind( epoch );
+
+            }
+
+    };
+
+    template <>
+    inline void dataStorage< int >::clear( ){
+                /*!
+                 * The function to erase the current values stored by setting first to false and second to zero
+                 */
+
+        first = false;
+
+        second = 0;
+
+    }
+
+    template <>
+    inline void dataStorage< jacobianFactorization >::clear( ){
+                /*!
+                 * The function to erase the current values stored by setting first to false. The factorization
+                 * is retained so that its storage may be re-used by the next factorization.
+                 */
+
+        first = false;
+
+    }
+
+    template <>
+    inline void dataStorage< unsigned int >::clear( ){
+                /*!
+                 * The function to erase the current values stored by setting first to false and second to zero
+                 */
+
+        first = false;
+
+        second = 0;
+
+    }
+
+    template <>
+    inline void dataStorage< floatType >::clear( ){
+                /*!
+                 * The function to erase the current values stored by setting first to false and second to zero
+                 */
+
+        first = false;
+
+        second = 0;
+
+    }
+
+    /*!
+     * A monotonic arena of floating point workspace.
+     *
+     * Workspace is handed out by bumping an offset into the current block and is released all at once by reset.
+     * The blocks are retained between resets and, if the demand of a cycle spilled over more than one block, they
+     * are replaced by a single block large enough for the whole cycle. A cycle with the same demand as a previous
+     * one therefore does not allocate. The number of blocks allocated from the heap is recorded so that this may be
+     * checked.
+     */
+    class workspaceArena{
+
+        public:
+
+            floatType* allocate( const unsigned int &size );
+
+            void reset( );
+
+            //! Get the number of values which have been handed out since the last reset
+            const unsigned long long* getSize( ) const { return &_size; }
+
+            //! Get the largest number of values handed out in a single cycle
+            const unsigned long long* getHighWaterMark( ) const { return &_highWaterMark; }
+
+            //! Get the number of blocks which have been allocated from the heap
+            const unsigned long long* getNumBlockAllocations( ) const { return &_numBlockAllocations; }
+
+        private:
+
+            std::vector< std::vector< floatType > > _blocks; //!< The blocks of workspace
+
+            unsigned int _block = 0; //!< The index of the block workspace is currently handed out from
+
+            unsigned long long _offset = 0; //!< The offset of the next free value in the current block
+
+            unsigned long long _size = 0; //!< The number of values handed out since the last reset
+
+            unsigned long long _highWaterMark = 0; //!< The largest number of values handed out in a single cycle
+
+            unsigned long long _numBlockAllocations = 0; //!< The number of blocks which have been allocated
+
+            void addBlock( const unsigned long long &size );
+
+    };
+
+    /*!
+     * A custom error for use with failures in convergence of the solver.
+     */
+    class convergence_error : public std::exception{
+
+        private:
+            std::string message_; //!< The output message
+
+        public:
+
+            //! Constructor
+            explicit convergence_error( const std::string& message ) : message_( message ) { }
+
+            const char *what( ) const noexcept override {
+                /*!
+                 * Output the message
+                 */
+
+                return message_.c_str( );
+
+            }
+
+    };
+
+    /*!
+     * A class to contain the residual computations associated with some part of a non-linear solve
+     */
+    class residualBase{
+
+        public:
+
+            /*!
+             * Default residual
+             */
+            residualBase( ) : hydra( NULL ), _numEquations( 0 ){ };
+
+            /*!
+             * Main utilization constructor
+             * 
+             * \param *_hydra: A pointer to a hydraBase object
+             * \param &_numEquations: The number of equations defined by the residual
+             */
+            residualBase( hydraBase *_hydra, const unsigned int &_numEquations ) : hydra( _hydra ), _numEquations( _numEquations ){ }
+
+            /*!
+             * Copy constructor
+             * 
+             * \param &r: The residual to be copied
+             */
+            residualBase( residualBase &r ) : hydra( r.hydra ), _numEquations( *r.getNumEquations( ) ), _explicitUnknownIndices( *r.getExplicitUnknownIndices( ) ), _unknownBlockDependencies( *r.getUnknownBlockDependencies( ) ){ }
+
+            hydraBase* hydra; //!< The hydra class which owns the residualBase object
+
+            // User defined setter functions
+
+            virtual void setResidual( ){
+                /*!
+                 * The user-defined residual equation. Must have a size of numEquations
+                 */
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The residual is not implemented" ) );
+
+            }
+
+            virtual void setJacobian( ){
+                /*!
+                 * The user-defined jacobian equation. Must have a size of numEquations x numUnknowns
+                 * 
+                 * The order of the unknowns are the cauchy stress, the configurations in order (minus the first one),
+                 * and the state variables solved for in the non-linear solve.
+                 * 
+                 * Setting the jacobian in row-major form using setFlatJacobian avoids forming a matrix
+                 */
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The jacobian is not implemented" ) );
+
+            }
+
+            virtual void setdRdF( ){
+                /*!
+                 * The user-defined derivative of the residual w.r.t. the deformation gradient.
+                 */
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The derivative of the residual w.r.t. the deformation gradient is not implemented" ) );
+ 
+            }
+
+            virtual void setdRdT( ){
+                /*!
+                 * The user-defined derivative of the residual w.r.t. the temperature
+                 */
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The derivative of the residual w.r.t. the temperature is not implemented" ) );
+ 
+            }
+
+            virtual void setAdditionalDerivatives( ){
+                /*!
+                 * The user-defined derivative of the residual w.r.t. additional values
+                 */
+
+            }
+
+            virtual void setCauchyStress( ){
+                /*!
+                 * Compute the current Cauchy stress
+                 * 
+                 * Only needs to be defined for the first residual
+                 */
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The calculation of the Cauchy stress is not implemented" ) );
+
+            }
+
+            virtual void setPreviousCauchyStress( ){
+                /*!
+                 * Compute the previous Cauchy stress
+                 * 
+                 * Only needs to be defined for the first residual
+                 */
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The calculation of the previous Cauchy stress is not implemented" ) );
+
+            }
+
+            virtual void setCurrentAdditionalStateVariables( ){
+                /*!
+                 * Set the current additional state variables
+                 * 
+                 * Doesn't need to be defined
+                 */
+
+                setCurrentAdditionalStateVariables( floatVector( 0, 0 ) );
+
+                return;
+
+            }
+
+            // Setters
+
+            void setResidual( const floatVector &residual );
+
+            void setJacobian( const floatMatrix &jacobian );
+
+            void setFlatJacobian( const floatVector &jacobian );
+
+            void setdRdF( const floatMatrix &dRdF );
+
+            void setFlatdRdF( const floatVector &dRdF );
+
+            void setdRdT( const floatVector &dRdT );
+
+            void setAdditionalDerivatives( const floatMatrix &additionalDerivatives );
+
+            void setFlatAdditionalDerivatives( const floatVector &additionalDerivatives );
+
+            void setCauchyStress( const floatVector &cauchyStress );
+
+            void setPreviousCauchyStress( const floatVector &previousCauchyStress );
+
+            void setCurrentAdditionalStateVariables( const floatVector &currentAdditionalStateVariables );
+
+            void setExplicitUnknownIndices( const std::vector< unsigned int > &explicitUnknownIndices );
+
+            void setUnknownBlockDependencies( const std::vector< unsigned int > &unknownBlockDependencies );
+
+            // Getter functions
+
+            //! Get the number of equations the residual defined
+            const unsigned int* getNumEquations( ){ return &_numEquations; }
+
+            //! Get the indices of the unknowns which are defined explicitly by the residual. Empty if the residual is not explicit.
+            const std::vector< unsigned int >* getExplicitUnknownIndices( ){ return &_explicitUnknownIndices; }
+
+            //! Get the blocks of the unknown vector the residual depends on. Empty if the residual may depend on all of them.
+            const std::vector< unsigned int >* getUnknownBlockDependencies( ){ return &_unknownBlockDependencies; }
+
+            const floatVector* getResidual( );
+
+            const floatVector* getFlatJacobian( );
+
+            const floatMatrix* getJacobian( );
+
+            const floatVector* getFlatdRdF( );
+
+            const floatMatrix* getdRdF( );
+
+            const floatVector* getdRdT( );
+
+            const floatVector* getFlatAdditionalDerivatives( );
+
+            const floatMatrix* getAdditionalDerivatives( );
+
+            const floatVector* getCauchyStress( );
+
+            const floatVector* getPreviousCauchyStress( );
+
+            const floatVector* getCurrentAdditionalStateVariables( );
+
+            void addIterationData( dataBase *data );
+
+            void addPointData( dataBase *data );
+
+        private:
+
+            unsigned int _numEquations; //!< The number of residual equations
+
+            std::vector< unsigned int > _explicitUnknownIndices; //!< The indices of the unknowns which are defined explicitly by the residual equations
+
+            std::vector< unsigned int > _unknownBlockDependencies; //!< The blocks of the unknown vector the residual equations depend on
+
+            dataStorage< floatVector > _residual; //!< The residual equations
+
+            dataStorage< floatVector > _jacobian; //!< The jacobian in row-major form
+
+            dataStorage< floatMatrix > _jacobianMatrix; //!< The jacobian in matrix form. Only formed if requested.
+
+            dataStorage< floatVector > _dRdF; //!< The derivative of the residual w.r.t. the deformation gradient in row-major form
+
+            dataStorage< floatMatrix > _dRdFMatrix; //!< The derivative of the residual w.r.t. the deformation gradient in matrix form. Only formed if requested.
+
+            dataStorage< floatVector > _dRdT; //!< The derivative of the residual w.r.t. the temperature
+
+            dataStorage< floatVector > _additionalDerivatives; //!< Additional derivatives of the residual in row-major form
+
+            dataStorage< floatMatrix > _additionalDerivativesMatrix; //!< Additional derivatives of the residual in matrix form. Only formed if requested.
+
+            dataStorage< floatVector > _cauchyStress; //!< The previous Cauchy stress. Only needs to be defined for the first residual
+
+            dataStorage< floatVector > _previousCauchyStress; //!< The previous Cauchy stress. Only needs to be defined for the first residual
+
+            dataStorage< floatVector > _currentAdditionalStateVariables; //!< The current additional state variables.
+
+    };
+
+    /*!
+     * hydraBase: A base class which can be used to construct finite deformation material models.
+     * 
+     * The hydra class seeks to provide utilities for the construction of finite deformation constitutive models
+     * more rapidly than would be possible previously. The user can define as many different configurations as desired
+     * and provide a calculation of the Cauchy stress.
+     * 
+     * A non-linear problem which is of the size ( dimension**2 * num_configurations + num_ISVs ) will be solved.
+     */
+    class hydraBase{
+
+        public:
+
+            // Constructors
+            //! Default constructor for hydraBase
+            hydraBase( ){ }
+
+            //! Main constructor for objects of type hydraBase. Sets all quantities required for most solves.
+            hydraBase( const floatType &time, const floatType &deltaTime,
+                       const floatType &temperature, const floatType &previousTemperature,
+                       const floatVector &deformationGradient, const floatVector &previousDeformationGradient,
+                       const floatVector &previousStateVariables, const floatVector &parameters,
+                       const unsigned int numConfigurations, const unsigned int numNonLinearSolveStateVariables,
+                       const unsigned int dimension=3, const floatType tolr=1e-9, const floatType tola=1e-9, const unsigned int maxIterations=20, const unsigned int maxLSIterations=5, const floatType lsAlpha=1e-4 );
+
+            // User defined functions
+
+            // Setter functions
+
+            //! Set the derivatives which are requested from the residual classes (see tardigradeHydra::derivativeRequest)
+            void setDerivativeRequest( const unsigned int &request ){ _derivativeRequest = request; }
+
+            void setNonLinearSolver( const unsigned int &solver );
+
+            void setMaxJacobianAge( const unsigned int &maxJacobianAge );
+
+            /*!
+             * Set whether the Cauchy stress is solved for using its six independent components. Only valid if the
+             * stress computed by every residual class is symmetric. If the rows of the jacobian of a symmetric pair of
+             * stress equations differ the full jacobian is factored instead.
+             *
+             * \param &symmetricCauchyStress: The flag for whether the symmetric formulation is used
+             */
+            void setSymmetricCauchyStress( const bool &symmetricCauchyStress ){ _symmetricCauchyStress = symmetricCauchyStress; }
+
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            void setSolveStatistics( solveStatistics *statistics );
+#endif
+
+            // Getter functions
+            //! Get a reference to the current time
+            const floatType* getTime( ){ return &_time; }
+
+            //! Get a reference to the change in time
+            const floatType* getDeltaTime( ){ return &_deltaTime; }
+
+            //! Get a reference to the current temperature
+            const floatType* getTemperature( ){ return &_temperature; };
+
+            //! Get a reference to the previous temperature
+            const floatType* getPreviousTemperature( ){ return &_previousTemperature; };
+
+            //! Get a reference to the deformation gradient
+            const floatVector* getDeformationGradient( ){ return &_deformationGradient; }
+
+            //! Get a reference to the previous deformation gradient
+            const floatVector* getPreviousDeformationGradient( ){ return &_previousDeformationGradient; }
+
+            //! Get a reference to the previous values of the state variables
+            const floatVector* getPreviousStateVariables( ){ return &_previousStateVariables; }
+
+            //! Get a reference to the model parameters
+            const floatVector* getParameters( ){ return &_parameters; }
+
+            //! Get a reference to the number of configurations
+            const unsigned int* getNumConfigurations( ){ return &_numConfigurations; }
+
+            //! Get a reference to the number of state variables involved in the non-linear solve
+            const unsigned int* getNumNonLinearSolveStateVariables( ){ return &_numNonLinearSolveStateVariables; }
+
+            //! Get a reference to the dimension
+            const unsigned int* getDimension( ){ return &_dimension; }
+
+            //! Get a reference to the relative tolerance
+            const floatType* getRelativeTolerance( ){ return &_tolr; }
+
+            //! Get a reference to the absolute tolerance
+            const floatType* getAbsoluteTolerance( ){ return &_tola; }
+
+            //! Get a reference to the line-learch alpha
+            const floatType* getLSAlpha( ){ return &_lsAlpha; }
+
+            //! Get a reference to the derivatives which are requested from the residual classes
+            const unsigned int* getDerivativeRequest( ){ return &_derivativeRequest; }
+
+            //! Check if the derivatives defined by the flag are requested from the residual classes
+            bool isDerivativeRequested( const unsigned int &flag ){ return ( _derivativeRequest & flag ) == flag; }
+
+            //! Get a reference to the strategy used to solve the non-linear problem (see tardigradeHydra::nonLinearSolver)
+            const unsigned int* getNonLinearSolver( ){ return &_nonLinearSolver; }
+
+            //! Get a reference to the maximum number of iterations a factored jacobian may be re-used for before it is re-formed
+            const unsigned int* getMaxJacobianAge( ){ return &_maxJacobianAge; }
+
+            //! Get a reference to the flag for whether the Cauchy stress is solved for using its six independent components
+            const bool* getSymmetricCauchyStress( ){ return &_symmetricCauchyStress; }
+
+            //! Get a reference to the number of times the jacobian was factored by the iterations of the last non-linear solve
+            const unsigned int* getNumJacobianFactorizations( ){ return &_numJacobianFactorizations; }
+
+            //! Get a reference to the number of times the jacobian was factored after the iterations of the last non-linear solve e.g., for the consistent tangent
+            const unsigned int* getNumTangentFactorizations( ){ return &_numTangentFactorizations; }
+
+            //! Get a reference to the number of Newton iterations of the non-linear solve
+            const unsigned int* getNumIterations( ){ return &_iteration; }
+
+            //! Get a reference to the total number of line search iterations of the non-linear solve
+            const unsigned int* getNumLSIterations( ){ return &_numLSIterations; }
+
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            //! Get the statistics which the non-linear solves are recorded in
+            solveStatistics* getSolveStatistics( ){ return _solveStatistics; }
+#endif
+
+            //! Get a reference to the configurations
+            const floatMatrix* getConfigurations( ){ return &_configurations.second; }
+
+            //! Get a reference to the previous configurations
+            const floatMatrix* getPreviousConfigurations( ){ return &_previousConfigurations.second; }
+
+            //! Get a reference to the inverse configurations
+            const floatMatrix* getInverseConfigurations( ){ return &_inverseConfigurations.second; }
+
+            //! Get a reference to the previous inverse configurations
+            const floatMatrix* getPreviousInverseConfigurations( ){ return &_previousInverseConfigurations.second; }
+
+            //! Get a reference to the state variables used in the unknown vector of the non-linear solve
+            const floatVector* getNonLinearSolveStateVariables( ){ return &_nonLinearSolveStateVariables.second; }
+
+            //! Get a reference to the previous values of the state variables used in the unknown vector of the non-linear solve
+            const floatVector* getPreviousNonLinearSolveStateVariables( ){ return &_previousNonLinearSolveStateVariables.second; }
+
+            //! Get a reference to the state variables not used in the unknown vector for the non-linear solve
+            const floatVector* getAdditionalStateVariables( ){ return &_additionalStateVariables.second; }
+
+            //! Get a reference to the previous values of the state variables not used in the unknown vector for the non-linear solve
+            const floatVector* getPreviousAdditionalStateVariables( ){ return &_previousAdditionalStateVariables.second; }
+
+            floatVector getSubConfiguration( const floatMatrix &configurations, const unsigned int &lowerIndex, const unsigned int &upperIndex );
+
+            floatMatrix getSubConfigurationGradient( const floatMatrix &configurations, const unsigned int &lowerIndex, const unsigned int &upperIndex );
+
+            const floatVector& getSubConfiguration( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+
+            const floatVector& getPrecedingConfiguration( const unsigned int &index );
+
+            const floatVector& getFollowingConfiguration( const unsigned int &index );
+
+            const floatVector& getConfiguration( const unsigned int &index );
+
+            const floatVector& getPreviousSubConfiguration( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+
+            const floatVector& getPreviousPrecedingConfiguration( const unsigned int &index );
+
+            const floatVector& getPreviousFollowingConfiguration( const unsigned int &index );
+
+            const floatVector& getPreviousConfiguration( const unsigned int &index );
+
+            const floatMatrix& getSubConfigurationGradient( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+
+            const floatMatrix& getPrecedingConfigurationGradient( const unsigned int &index );
+
+            const floatMatrix& getFollowingConfigurationGradient( const unsigned int &index );
+
+            const floatMatrix& getPreviousSubConfigurationGradient( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+
+            const floatMatrix& getPreviousPrecedingConfigurationGradient( const unsigned int &index );
+
+            const floatMatrix& getPreviousFollowingConfigurationGradient( const unsigned int &index );
+
+            subConfigurationGradient getSubConfigurationGradientFactors( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+
+            subConfigurationGradient getPrecedingConfigurationGradientFactors( const unsigned int &index );
+
+            subConfigurationGradient getFollowingConfigurationGradientFactors( const unsigned int &index );
+
+            subConfigurationGradient getPreviousSubConfigurationGradientFactors( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+
+            subConfigurationGradient getPreviousPrecedingConfigurationGradientFactors( const unsigned int &index );
+
+            subConfigurationGradient getPreviousFollowingConfigurationGradientFactors( const unsigned int &index );
+
+            const floatType* getLSResidualNorm( );
+
+            const floatMatrix* getdF1dF( );
+
+            const floatMatrix* getdF1dFn( );
+
+            const floatMatrix* getPreviousdF1dF( );
+
+            const floatMatrix* getPreviousdF1dFn( );
+
+            virtual void setResidualClasses( );
+
+            void setResidualClasses( std::vector< residualBase* > &residualClasses );
+
+            std::vector< residualBase* >* getResidualClasses( );
+
+            const floatVector* getResidual( );
+
+            const floatVector* getFlatJacobian( );
+
+            floatMatrix getJacobian( );
+
+            const floatVector* getFlatdRdF( );
+
+            floatMatrix getdRdF( );
+
+            const floatVector* getdRdT( );
+
+            const floatVector* getFlatAdditionalDerivatives( );
+
+            floatMatrix getAdditionalDerivatives( );
+
+            const jacobianFactorization* getJacobianFactorization( );
+
+            const floatVector* getUnknownVector( );
+
+            const floatVector* getTolerance( );
+
+            virtual bool checkConvergence( );
+
+            virtual bool checkLSConvergence( );
+
+            const floatVector* getCauchyStress( );
+
+            const floatVector* getPreviousCauchyStress( );
+
+            const floatVector* getFlatdXdF( );
+
+            floatMatrix getdXdF( );
+
+            const floatVector* getdXdT( );
+
+            const floatMatrix* getdCauchyStressdF( );
+
+            const floatVector* getdCauchyStressdT( );
+
+            const floatVector* getUpdatedStateVariables( );
+
+            virtual void evaluate( );
+
+            void setMaterialPoint( const floatType &time, const floatType &deltaTime,
+                                   const floatType &temperature, const floatType &previousTemperature,
+                                   const floatType *deformationGradient, const floatType *previousDeformationGradient,
+                                   const floatType *previousStateVariables );
+
+            //! Bind data to the iteration epoch so that it is invalidated by resetIterationData
+            void addIterationData( dataBase *data ){ data->bindToEpoch( &_iterationEpoch ); }
+
+            //! Bind data to the material point epoch so that it is invalidated by setMaterialPoint
+            void addPointData( dataBase *data ){ data->bindToEpoch( &_pointEpoch ); }
+
+            //! Get the workspace which is released when the unknown vector is updated
+            workspaceArena* getIterationArena( ){ return &_iterationArena; }
+
+            //! Get the workspace which is released at the start of each solve
+            workspaceArena* getSolveArena( ){ return &_solveArena; }
+
+        private:
+
+            // Friend classes
+            friend class unit_test::hydraBaseTester; //!< Friend class which allows modification of private variables. ONLY TO BE USED FOR TESTING!
+
+            floatType _time; //!< The current time
+
+            floatType _deltaTime; //!< The change in time
+
+            floatType _temperature; //!< The current temperature
+
+            floatType _previousTemperature; //!< The previous temperature
+
+            floatVector _deformationGradient; //!< The current deformation gradient
+
+            floatVector _previousDeformationGradient; //!< The previous deformation gradient
+
+            floatVector _previousStateVariables; //!< The previous state variables
+
+            floatVector _parameters; //!< The model parameters
+
+            unsigned int _numConfigurations; //!< The number of configurations
+
+            unsigned int _numNonLinearSolveStateVariables; //!< The number of state variables which will be solved in the Newton-Raphson loop
+            unsigned int _dimension; //!< The spatial dimension of the problem
+
+            floatType _tolr; //!< The relative tolerance
+
+            floatType _tola; //!< The absolute tolerance
+
+            unsigned int _maxIterations; //!< The maximum number of allowable iterations
+
+            unsigned int _maxLSIterations; //!< The maximum number of line-search iterations
+
+            floatType _lsAlpha; //!< The line-search alpha value i.e., the term by which it is judged that the line-search is converging
+
+            unsigned int _derivativeRequest = derivativeRequest::all; //!< The derivatives which are requested from the residual classes
+
+            unsigned int _nonLinearSolver = nonLinearSolver::newton; //!< The strategy used to solve the non-linear problem
+
+            unsigned int _maxJacobianAge = 5; //!< The maximum number of iterations a factored jacobian is re-used for by the modified Newton and Broyden solvers
+
+            bool _symmetricCauchyStress = false; //!< Flag for whether the Cauchy stress is solved for using its six independent components
+
+            unsigned int _jacobianAge = 0; //!< The number of iterations the retained factored jacobian has been used for
+
+            unsigned int _numJacobianFactorizations = 0; //!< The number of times the jacobian has been factored by the iterations of the current non-linear solve
+
+            unsigned int _numTangentFactorizations = 0; //!< The number of times the jacobian has been factored after the iterations of the current non-linear solve
+
+            bool _isIterating = false; //!< Flag for whether the iterations of the non-linear solve are in progress
+
+            std::vector< unsigned int > _explicitEquations; //!< The equations of the non-linear problem which define explicit unknowns
+
+            std::vector< unsigned int > _explicitUnknowns; //!< The unknowns of the non-linear problem which are defined explicitly
+
+            std::vector< unsigned int > _blockSizes; //!< The sizes of the blocks of the unknown vector
+
+            std::vector< bool > _blockSparsity; //!< The row-major flags for whether each block of the jacobian may be non-zero
+
+            bool _hasRetainedFactorization = false; //!< Flag for whether the retained factorization may be used
+
+            jacobianFactorization _retainedFactorization; //!< The factored jacobian which is re-used by the modified Newton and Broyden solvers
+
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+            solveStatistics *_solveStatistics = NULL; //!< The statistics which the non-linear solves are recorded in
+
+            void setSolveStatisticsResidualNames( );
+
+            void recordResidualTime( const unsigned int &residualIndex, const unsigned int &stage,
+                                     const std::chrono::steady_clock::time_point &start );
+#endif
+
+            floatType *_broydenStepUpdates = nullptr; //!< The scaled correction vectors of the Broyden updates of the inverse jacobian (drawn from the solve workspace)
+
+            floatType *_broydenSteps = nullptr; //!< The steps of the Broyden updates of the inverse jacobian (drawn from the solve workspace)
+
+            unsigned int _numBroydenUpdates = 0; //!< The number of Broyden updates of the retained factorization
+
+            unsigned int _maxBroydenUpdates = 0; //!< The number of Broyden updates the history can hold
+
+            dataStorage< floatMatrix > _configurations; //!< The current values of the configurations
+
+            dataStorage< floatMatrix > _previousConfigurations; //!< The previous values of the configurations
+
+            dataStorage< floatMatrix > _inverseConfigurations; //!< The inverses of the configurations
+
+            dataStorage< floatMatrix > _previousInverseConfigurations; //!< The inverses of the previous configurations
+
+            dataStorage< floatMatrix > _subConfigurations; //!< The products of the current configurations between every pair of indices
+
+            dataStorage< floatMatrix > _previousSubConfigurations; //!< The products of the previous configurations between every pair of indices
+
+            dataStorage< std::vector< floatMatrix > > _subConfigurationGradients; //!< The gradients of the current sub-configurations which have been requested
+
+            dataStorage< std::vector< floatMatrix > > _previousSubConfigurationGradients; //!< The gradients of the previous sub-configurations which have been requested
+
+            dataStorage< floatVector > _nonLinearSolveStateVariables; //!< The current values of the state variables involved in the non-linear solve
+            dataStorage< floatVector > _previousNonLinearSolveStateVariables; //!< The previous values of the state variables involved in the non-linear solve
+
+            dataStorage< floatVector > _additionalStateVariables; //!< The current values of the additional state variables
+
+            dataStorage< floatVector > _previousAdditionalStateVariables; //!< The previous values of the additional state variables
+
+            dataStorage< floatMatrix > _dF1dF; //!< The partial derivative of the first configuration w.r.t. the deformation gradient
+
+            dataStorage< floatMatrix > _dF1dFn; //!< The partial derivative of the first configuration w.r.t. all the other configurations
+
+            dataStorage< floatMatrix > _previousdF1dF; //!< The partial derivative of the previous first configuration w.r.t. the deformation gradient
+
+            dataStorage< floatMatrix > _previousdF1dFn; //!< The partial derivative of the previous first configuration w.r.t. all the other configurations
+
+            floatVector _flatdF1dFn; //!< Workspace for the row-major gradient of the first configuration w.r.t. the other configurations
+
+            unsigned long long _iterationEpoch = 0; //!< The iteration epoch. Data bound to the epoch is invalidated when it is incremented.
+
+            unsigned long long _pointEpoch = 0; //!< The material point epoch. Data bound to the epoch is invalidated when it is incremented.
+
+            workspaceArena _iterationArena; //!< The workspace which is released when the iteration epoch is incremented
+
+            workspaceArena _solveArena; //!< The workspace which is released at the start of each solve
+
+            dataStorage< std::vector< residualBase* > > _residualClasses; //!< A vector of classes which compute the terms in the residual equation
+
+            dataStorage< floatVector > _residual; //!< The residual vector for the global solve
+
+            dataStorage< floatVector > _jacobian; //!< The jacobian matrix in row-major form for the global solve
+
+            dataStorage< floatVector > _dRdF; //!< The gradient of the residual w.r.t. the deformation gradient in row-major form for the global solve
+
+            dataStorage< floatVector > _dRdT; //!< The gradient of the residual w.r.t. the temperature for the global solve
+
+            dataStorage< floatVector > _additionalDerivatives; //!< Additional derivatives of the residual
+
+            dataStorage< jacobianFactorization > _jacobianFactorization; //!< The LU factorization of the jacobian of the non-linear problem
+
+            dataStorage< floatVector > _X; //!< The unknown vector { cauchyStress, F1, ..., Fn, xi1, ..., xim }
+
+            dataStorage< floatVector > _tolerance; //!< The tolerance vector for the non-linear solve
+
+            dataStorage< floatType > _lsResidualNorm; //!< The reference residual norm for the line-search convergence criteria
+
+            dataStorage< floatVector > _cauchyStress; //!< The Cauchy stress as determined from the current state
+
+            dataStorage< floatVector > _previousCauchyStress; //!< The previous value of the Cauchy stress as determined from the current state
+
+            dataStorage< floatVector > _flatdXdF; //!< The total derivative of the unknown vector w.r.t. the deformation gradient in row-major form
+
+            dataStorage< floatVector > _dXdT; //!< The total derivative of the unknown vector w.r.t. the temperature
+
+            dataStorage< floatMatrix > _dCauchyStressdF; //!< The total derivative of the Cauchy stress w.r.t. the deformation gradient
+
+            dataStorage< floatVector > _dCauchyStressdT; //!< The total derivative of the Cauchy stress w.r.t. the temperature
+
+            dataStorage< floatVector > _updatedStateVariables; //!< The updated state variables
+
+            unsigned int _iteration = 0; //!< The current iteration of the non-linear problem
+
+            unsigned int _LSIteration = 0; //!< The current line search iteration of the non-linear problem
+
+            unsigned int _numLSIterations = 0; //!< The total number of line search iterations of the non-linear problem
+
+            floatType _lambda = 1;
+
+            virtual void decomposeUnknownVector( );
+
+            virtual void decomposeStateVariableVector( );
+
+            void computeConfigurations( const floatType *deformationGradient, const floatType *subConfigurations, const bool addIdentity,
+                                        floatMatrix &configurations, floatMatrix &inverseConfigurations );
+
+            template< unsigned int dim >
+            void computeFixedSizeConfigurations( const floatType *deformationGradient, const floatType *subConfigurations, const bool addIdentity,
+                                                 floatMatrix &configurations, floatMatrix &inverseConfigurations );
+
+            template< unsigned int dim >
+            void computeFixedSizeSubConfiguration( const floatMatrix &configurations, const unsigned int &lowerIndex,
+                                                   const unsigned int &upperIndex, floatVector &subConfiguration );
+
+            template< unsigned int dim >
+            void computeFixedSizeSubConfigurations( const floatMatrix &configurations, floatMatrix &subConfigurations );
+
+            void computeSubConfigurations( const floatMatrix &configurations, floatMatrix &subConfigurations );
+
+            void computeSubConfigurationGradient( const floatMatrix &subConfigurations, const unsigned int &numConfigurations,
+                                                  const unsigned int &lowerIndex, const unsigned int &upperIndex,
+                                                  floatMatrix &gradient );
+
+            void checkSubConfigurationIndices( const unsigned int &numConfigurations, const unsigned int &lowerIndex,
+                                               const unsigned int &upperIndex );
+
+            const floatMatrix* getSubConfigurations( );
+
+            const floatMatrix* getPreviousSubConfigurations( );
+
+            void formFirstConfigurationGradients( const floatVector &deformationGradient, const subConfigurationGradient &dFscdFs,
+                                                  floatMatrix &dF1dF, floatMatrix &dF1dFn );
+
+            void setFirstConfigurationGradients( );
+
+            void setPreviousFirstConfigurationGradients( );
+
+            virtual void formNonLinearResidual( );
+
+            virtual void formNonLinearJacobian( );
+
+            virtual void formNonLinearDerivatives( );
+
+            virtual void formNonLinearProblem( );
+
+            void setJacobianFactorization( );
+
+            void setRetainedJacobianFactorization( );
+
+            void solveJacobianSystem( const floatType *rhs, floatType *solution );
+
+            void updateBroydenApproximation( const floatType *deltaX, const floatType *deltaResidual );
+
+            void solveNonLinearProblem( );
+
+            virtual void initializeUnknownVector( );
+
+            virtual void setTolerance( );
+
+            void setTolerance( const floatVector &tolerance );
+
+            virtual void setTotalDerivatives( );
+
+            virtual void setUpdatedStateVariables( );
+
+            void incrementIteration( ){ _iteration++; }
+
+            virtual void updateLambda( ){ _lambda *= 0.5; }
+
+            void incrementLSIteration( ){ _LSIteration++; _numLSIterations++; }
+
+            void resetLSIteration( ){ _LSIteration = 0; _lambda = 1.0;
+                                      _lsResidualNorm.second = tardigradeVectorTools::l2norm( *getResidual( ) );
+                                      _lsResidualNorm.first = true; }
+
+            const floatType* getLambda( ){ return &_lambda; }
+
+            bool checkIteration( ){ return _iteration < _maxIterations; }
+
+            bool checkLSIteration( ){ return _LSIteration < _maxLSIterations; }
+
+            virtual void updateUnknownVector( const floatVector &newUnknownVector );
+
+            void resetIterationData( );
+
+    };
+
+    /*!
+     * The caller-owned buffers of a batch of material points.
+     *
+     * The buffers are stored as structures of arrays i.e., component \f$ c \f$ of a quantity at point \f$ p \f$ is
+     * stored at index \f$ c N + p \f$ where \f$ N \f$ is the number of points.
+     */
+    struct materialPointBuffers{
+
+        unsigned int numPoints; //!< The number of points
+
+        floatType time; //!< The current time
+
+        floatType deltaTime; //!< The change in time
+
+        const floatType *temperature; //!< The current temperatures (N)
+
+        const floatType *previousTemperature; //!< The previous temperatures (N)
+
+        const floatType *deformationGradient; //!< The current deformation gradients (dim**2 x N)
+
+        const floatType *previousDeformationGradient; //!< The previous deformation gradients (dim**2 x N)
+
+        const floatType *previousStateVariables; //!< The previous state variables (number of state variables x N)
+
+        floatType *cauchyStress; //!< The Cauchy stresses (dim**2 x N)
+
+        floatType *stateVariables; //!< The updated state variables (number of state variables x N)
+
+        floatType *dCauchyStressdF; //!< The total derivatives of the Cauchy stresses w.r.t. the deformation gradients (dim**4 x N). Not computed if NULL.
+
+        floatType *dCauchyStressdT; //!< The total derivatives of the Cauchy stresses w.r.t. the temperatures (dim**2 x N). Not computed if NULL.
+
+    };
+
+    /*!
+     * Evaluates a hydra model at a batch of material points which share the same parameters.
+     *
+     * The inputs and outputs are stored as structures of arrays (see tardigradeHydra::materialPointBuffers). The
+     * same hydra object and workspaces are re-used for every point in the batch.
+     */
+    class materialPointBatch{
+
+        public:
+
+            /*!
+             * Construct the batch evaluator
+             *
+             * \param *hydra: The hydra object which will be evaluated at each of the points. The object's parameters
+             *     and number of state variables define those of the batch.
+             */
+            materialPointBatch( hydraBase *hydra ) : _hydra( hydra ){ }
+
+            void evaluate( const unsigned int &numPoints, const floatType &time, const floatType &deltaTime,
+                           const floatType *temperature, const floatType *previousTemperature,
+                           const floatType *deformationGradient, const floatType *previousDeformationGradient,
+                           const floatType *previousStateVariables,
+                           floatType *cauchyStress, floatType *stateVariables,
+                           floatType *dCauchyStressdF = NULL, floatType *dCauchyStressdT = NULL );
+
+            void evaluate( const materialPointBuffers &buffers );
+
+            void evaluatePoint( const materialPointBuffers &buffers, const unsigned int &point );
+
+            //! Get the number of points which were successfully evaluated by the last call to evaluate
+            const unsigned int* getNumEvaluatedPoints( ){ return &_numEvaluatedPoints; }
+
+        private:
+
+            hydraBase *_hydra; //!< The hydra object which is evaluated at each point
+
+            unsigned int _numEvaluatedPoints = 0; //!< The number of points successfully evaluated
+
+            floatVector _deformationGradient; //!< The deformation gradient of the current point
+
+            floatVector _previousDeformationGradient; //!< The previous deformation gradient of the current point
+
+            floatVector _previousStateVariables; //!< The previous state variables of the current point
+
+    };
+
+    /*!
+     * Evaluates a hydra model at a batch of material points using multiple threads.
+     *
+     * Each thread evaluates the points with its own hydra object and workspaces. The points are divided into chunks
+     * which are initially distributed evenly across the threads. A thread which runs out of chunks steals chunks
+     * from the back of the other threads' queues so that the threads stay busy when the cost of the points varies.
+     * The outputs of each point are written to the point's location in the buffers so the results don't depend on
+     * which thread evaluated the point.
+     *
+     * The worker threads are started when the evaluator is constructed and wait between calls to evaluate so that
+     * threads aren't created for every batch. The calling thread acts as the first worker. Calls to evaluate must not
+     * be made concurrently.
+     */
+    class parallelMaterialPointBatch{
+
+        public:
+
+            parallelMaterialPointBatch( const std::vector< hydraBase* > &hydras );
+
+            ~parallelMaterialPointBatch( );
+
+            parallelMaterialPointBatch( const parallelMaterialPointBatch & ) = delete;
+
+            parallelMaterialPointBatch &operator=( const parallelMaterialPointBatch & ) = delete;
+
+            void evaluate( const materialPointBuffers &buffers );
+
+            void setGrainSize( const unsigned int &grainSize );
+
+            //! Get the number of threads i.e., the number of hydra objects
+            unsigned int getNumThreads( ) const { return _batches.size( ); }
+
+            //! Get the number of points in each chunk of work
+            const unsigned int* getGrainSize( ){ return &_grainSize; }
+
+            //! Get the lowest index of the points which failed in the last call to evaluate. Equal to the number of points if none failed.
+            const unsigned int* getFailedPoint( ){ return &_failedPoint; }
+
+        private:
+
+            std::vector< materialPointBatch > _batches; //!< The evaluators of each thread
+
+            unsigned int _grainSize = 4; //!< The number of points in each chunk of work
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The derivative of the residual w.r.t. the temperature is not implemented" ) );
- 
-            }
+            unsigned int _failedPoint = 0; //!< The lowest index of the points which failed
 
-            virtual void setAdditionalDerivatives( ){
-                /*!
-                 * The user-defined derivative of the residual w.r.t. additional values
-                 */
+            std::vector< std::thread > _workers; //!< The persistent worker threads i.e., all of the threads but the calling one
 
-            }
+            std::mutex _poolMutex; //!< The mutex protecting the state of the pool
 
-            virtual void setCauchyStress( ){
-                /*!
-                 * Compute the current Cauchy stress
-                 * 
-                 * Only needs to be defined for the first residual
-                 */
+            std::condition_variable _workAvailable; //!< Signals the workers that a batch is ready or the pool is shutting down
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The calculation of the Cauchy stress is not implemented" ) );
+            std::condition_variable _workDone; //!< Signals the calling thread that a worker has finished its part of a batch
 
-            }
+            const std::function< void( const unsigned int ) > *_task = NULL; //!< The work of the current batch which is called with the index of the thread
 
-            virtual void setPreviousCauchyStress( ){
-                /*!
-                 * Compute the previous Cauchy stress
-                 * 
-                 * Only needs to be defined for the first residual
-                 */
+            unsigned long long _generation = 0; //!< The number of batches which have been handed to the workers
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::logic_error( "The calculation of the previous Cauchy stress is not implemented" ) );
+            unsigned int _numActiveWorkers = 0; //!< The number of workers which haven't finished the current batch
 
-            }
+            bool _isShuttingDown = false; //!< Flag for whether the workers should exit
 
-            virtual void setCurrentAdditionalStateVariables( ){
-                /*!
-                 * Set the current additional state variables
-                 * 
-                 * Doesn't need to be defined
-                 */
+            void runWorker( const unsigned int thread );
 
-                setCurrentAdditionalStateVariables( floatVector( 0, 0 ) );
+            void shutDownWorkers( );
 
-                return;
+    };
 
-            }
+    /*!
+     * Kernels which advance \f$ W \f$ material points in lockstep.
+     *
+     * Each point occupies one lane and the quantities are stored with the lanes as the fastest index i.e., component
+     * \f$ i \f$ of a quantity at lane \f$ l \f$ is stored at index \f$ W i + l \f$. The innermost loops run over the
+     * lanes so that the compiler can map them onto the SIMD registers (e.g., \f$ W = 4 \f$ for AVX2 or \f$ W = 8 \f$
+     * for AVX-512 with double precision). Second order tensors are three dimensional and row-major.
+     */
+    namespace lockstep{
+
+        /*!
+         * Multiply second order tensors \f$ C_{ij} = A_{ik} B_{kj} \f$
+         *
+         * \param *A: The first tensor (9 x W)
+         * \param *B: The second tensor (9 x W)
+         * \param *C: The product (9 x W). Must not alias A or B.
+         */
+        template< unsigned int W >
+        inline void multiply( const floatType *A, const floatType *B, floatType *C ){
 
-            // Setters
+            for ( unsigned int i = 0; i < 3; i++ ){
 
-            void setResidual( const floatVector &residual );
+                for ( unsigned int j = 0; j < 3; j++ ){
 
-            void setJacobian( const floatMatrix &jacobian );
+                    for ( unsigned int l = 0; l < W; l++ ){
 
-            void setdRdF( const floatMatrix &dRdF );
+                        C[ W * ( 3 * i + j ) + l ] = A[ W * ( 3 * i + 0 ) + l ] * B[ W * ( 3 * 0 + j ) + l ]
+                                                   + A[ W * ( 3 * i + 1 ) + l ] * B[ W * ( 3 * 1 + j ) + l ]
+                                                   + A[ W * ( 3 * i + 2 ) + l ] * B[ W * ( 3 * 2 + j ) + l ];
 
-            void setdRdT( const floatVector &dRdT );
+                    }
 
-            void setAdditionalDerivatives( const floatMatrix &additionalDerivatives );
+                }
 
-            void setCauchyStress( const floatVector &cauchyStress );
+            }
 
-            void setPreviousCauchyStress( const floatVector &previousCauchyStress );
+        }
 
-            void setCurrentAdditionalStateVariables( const floatVector &currentAdditionalStateVariables );
+        /*!
+         * Invert second order tensors using the cofactors
+         *
+         * \param *A: The tensor (9 x W)
+         * \param *Ainv: The inverse (9 x W). Must not alias A.
+         * \param *determinant: The determinants of the tensors (W)
+         */
+        template< unsigned int W >
+        inline void invert( const floatType *A, floatType *Ainv, floatType *determinant ){
 
-            // Getter functions
+            for ( unsigned int l = 0; l < W; l++ ){
 
-            //! Get the number of equations the residual defined
-            const unsigned int* getNumEquations( ){ return &_numEquations; }
+                const floatType a00 = A[ W * 0 + l ], a01 = A[ W * 1 + l ], a02 = A[ W * 2 + l ];
+                const floatType a10 = A[ W * 3 + l ], a11 = A[ W * 4 + l ], a12 = A[ W * 5 + l ];
+                const floatType a20 = A[ W * 6 + l ], a21 = A[ W * 7 + l ], a22 = A[ W * 8 + l ];
 
-            const floatVector* getResidual( );
+                const floatType c00 = a11 * a22 - a12 * a21;
+                const floatType c01 = a12 * a20 - a10 * a22;
+                const floatType c02 = a10 * a21 - a11 * a20;
 
-            const floatMatrix* getJacobian( );
+                determinant[ l ] = a00 * c00 + a01 * c01 + a02 * c02;
 
-            const floatMatrix* getdRdF( );
+                const floatType invDet = 1 / determinant[ l ];
 
-            const floatVector* getdRdT( );
+                Ainv[ W * 0 + l ] = c00 * invDet;
+                Ainv[ W * 1 + l ] = ( a02 * a21 - a01 * a22 ) * invDet;
+                Ainv[ W * 2 + l ] = ( a01 * a12 - a02 * a11 ) * invDet;
+                Ainv[ W * 3 + l ] = c01 * invDet;
+                Ainv[ W * 4 + l ] = ( a00 * a22 - a02 * a20 ) * invDet;
+                Ainv[ W * 5 + l ] = ( a02 * a10 - a00 * a12 ) * invDet;
+                Ainv[ W * 6 + l ] = c02 * invDet;
+                Ainv[ W * 7 + l ] = ( a01 * a20 - a00 * a21 ) * invDet;
+                Ainv[ W * 8 + l ] = ( a00 * a11 - a01 * a10 ) * invDet;
 
-            const floatMatrix* getAdditionalDerivatives( );
+            }
 
-            const floatVector* getCauchyStress( );
+        }
 
-            const floatVector* getPreviousCauchyStress( );
+        /*!
+         * Set second order tensors to the identity
+         *
+         * \param *A: The tensor (9 x W)
+         */
+        template< unsigned int W >
+        inline void identity( floatType *A ){
 
-            const floatVector* getCurrentAdditionalStateVariables( );
+            for ( unsigned int i = 0; i < 9; i++ ){
 
-            void addIterationData( dataBase *data );
+                for ( unsigned int l = 0; l < W; l++ ){
 
-        private:
+                    A[ W * i + l ] = ( i % 4 == 0 ) ? 1 : 0;
 
-            unsigned int _numEquations; //!< The number of residual equations
+                }
 
-            dataStorage< floatVector > _residual; //!< The residual equations
+            }
 
-            dataStorage< floatMatrix > _jacobian; //!< The jacobian
+        }
+
+        /*!
+         * Decompose the configurations of the unknown vectors (see hydraBase::decomposeUnknownVector). The first
+         * configuration is computed as \f$ \bf{F}^1 = \bf{F} \left( \bf{F}^2 \bf{F}^3 \cdots \bf{F}^n \right)^{-1} \f$
+         * and the remaining configurations are copied from the unknown vectors.
+         *
+         * \param &numConfigurations: The number of configurations
+         * \param *deformationGradient: The deformation gradients (9 x W)
+         * \param *unknownVector: The unknown vectors. The configurations \f$ \bf{F}^2 \cdots \bf{F}^n \f$ follow the
+         *     Cauchy stress. (number of unknowns x W)
+         * \param *configurations: The configurations (number of configurations x 9 x W)
+         * \param *workspace: Scratch space for the products of the configurations (27 x W)
+         */
+        template< unsigned int W >
+        inline void decomposeUnknownVector( const unsigned int &numConfigurations, const floatType *deformationGradient,
+                                            const floatType *unknownVector, floatType *configurations, floatType *workspace ){
 
-            dataStorage< floatMatrix > _dRdF; //!< The derivative of the residual w.r.t. the deformation gradient
+            floatType *product = workspace;
 
-            dataStorage< floatVector > _dRdT; //!< The derivative of the residual w.r.t. the temperature
+            floatType *temp = workspace + 9 * W;
 
-            dataStorage< floatMatrix > _additionalDerivatives; //!< Additional derivatives of the residual
+            floatType *determinant = workspace + 18 * W;
 
-            dataStorage< floatVector > _cauchyStress; //!< The previous Cauchy stress. Only needs to be defined for the first residual
+            identity< W >( product );
 
-            dataStorage< floatVector > _previousCauchyStress; //!< The previous Cauchy stress. Only needs to be defined for the first residual
+            for ( unsigned int c = 1; c < numConfigurations; c++ ){
 
-            dataStorage< floatVector > _currentAdditionalStateVariables; //!< The current additional state variables.
+                std::copy( unknownVector + 9 * W * c, unknownVector + 9 * W * ( c + 1 ), configurations + 9 * W * c );
 
-    };
+                multiply< W >( product, configurations + 9 * W * c, temp );
 
-    /*!
-     * hydraBase: A base class which can be used to construct finite deformation material models.
-     * 
-     * The hydra class seeks to provide utilities for the construction of finite deformation constitutive models
-     * more rapidly than would be possible previously. The user can define as many different configurations as desired
-     * and provide a calculation of the Cauchy stress.
-     * 
-     * A non-linear problem which is of the size ( dimension**2 * num_configurations + num_ISVs ) will be solved.
-     */
-    class hydraBase{
+                std::copy( temp, temp + 9 * W, product );
 
-        public:
+            }
 
-            // Constructors
-            //! Default constructor for hydraBase
-            hydraBase( ){ }
+            invert< W >( product, temp, determinant );
 
-            //! Main constructor for objects of type hydraBase. Sets all quantities required for most solves.
-            hydraBase( const floatType &time, const floatType &deltaTime,
-                       const floatType &temperature, const floatType &previousTemperature,
-                       const floatVector &deformationGradient, const floatVector &previousDeformationGradient,
-                       const floatVector &previousStateVariables, const floatVector &parameters,
-                       const unsigned int numConfigurations, const unsigned int numNonLinearSolveStateVariables,
-                       const unsigned int dimension=3, const floatType tolr=1e-9, const floatType tola=1e-9, const unsigned int maxIterations=20, const unsigned int maxLSIterations=5, const floatType lsAlpha=1e-4 );
+            multiply< W >( deformationGradient, temp, configurations );
 
-            // User defined functions
+        }
 
-            // Setter functions
+        /*!
+         * Solve the linear systems \f$ A x = b \f$ of the active lanes using an LU decomposition with partial pivoting.
+         * The pivoting is done independently in each lane with selects rather than branches. Lanes whose matrices are
+         * singular i.e., which have a pivot no larger than \f$ n \epsilon \max_{ij} \left| A_{ij} \right| \f$, are
+         * deactivated. The threshold is relative so that the result doesn't depend on the scaling of the matrix.
+         *
+         * \param &numUnknowns: The number of unknowns
+         * \param *A: The row-major matrices (number of unknowns**2 x W). Overwritten by the factorization.
+         * \param *b: The right hand sides (number of unknowns x W). Overwritten by the solutions of the active lanes.
+         * \param *active: The lanes which should be solved (W). Set to false for lanes whose matrices are singular.
+         */
+        template< unsigned int W >
+        inline void solveLinearSystem( const unsigned int &numUnknowns, floatType *A, floatType *b, bool *active ){
 
-            // Getter functions
-            //! Get a reference to the current time
-            const floatType* getTime( ){ return &_time; }
+            const unsigned int n = numUnknowns;
 
-            //! Get a reference to the change in time
-            const floatType* getDeltaTime( ){ return &_deltaTime; }
+            floatType x[ W ], pivotValue[ W ], inversePivot[ W ], threshold[ W ];
 
-            //! Get a reference to the current temperature
-            const floatType* getTemperature( ){ return &_temperature; };
+            unsigned int pivot[ W ];
 
-            //! Get a reference to the previous temperature
-            const floatType* getPreviousTemperature( ){ return &_previousTemperature; };
+            // Pivots which are negligible compared to the largest entry of the matrix are treated as zero
+            for ( unsigned int l = 0; l < W; l++ ){
 
-            //! Get a reference to the deformation gradient
-            const floatVector* getDeformationGradient( ){ return &_deformationGradient; }
+                threshold[ l ] = 0;
 
-            //! Get a reference to the previous deformation gradient
-            const floatVector* getPreviousDeformationGradient( ){ return &_previousDeformationGradient; }
+            }
 
-            //! Get a reference to the previous values of the state variables
-            const floatVector* getPreviousStateVariables( ){ return &_previousStateVariables; }
+            for ( unsigned int i = 0; i < n * n; i++ ){
 
-            //! Get a reference to the model parameters
-            const floatVector* getParameters( ){ return &_parameters; }
+                for ( unsigned int l = 0; l < W; l++ ){
 
-            //! Get a reference to the number of configurations
-            const unsigned int* getNumConfigurations( ){ return &_numConfigurations; }
+                    threshold[ l ] = std::max( threshold[ l ], std::fabs( A[ W * i + l ] ) );
 
-            //! Get a reference to the number of state variables involved in the non-linear solve
-            const unsigned int* getNumNonLinearSolveStateVariables( ){ return &_numNonLinearSolveStateVariables; }
+                }
 
-            //! Get a reference to the dimension
-            const unsigned int* getDimension( ){ return &_dimension; }
+            }
 
-            //! Get a reference to the relative tolerance
-            const floatType* getRelativeTolerance( ){ return &_tolr; }
+            for ( unsigned int l = 0; l < W; l++ ){
 
-            //! Get a reference to the absolute tolerance
-            const floatType* getAbsoluteTolerance( ){ return &_tola; }
+                threshold[ l ] *= n * std::numeric_limits< floatType >::epsilon( );
 
-            //! Get a reference to the line-learch alpha
-            const floatType* getLSAlpha( ){ return &_lsAlpha; }
+            }
 
-            //! Get a reference to the configurations
-            const floatMatrix* getConfigurations( ){ return &_configurations.second; }
+            for ( unsigned int k = 0; k < n; k++ ){
 
-            //! Get a reference to the previous configurations
-            const floatMatrix* getPreviousConfigurations( ){ return &_previousConfigurations.second; }
+                // Find the pivot of each lane
+                for ( unsigned int l = 0; l < W; l++ ){
 
-            //! Get a reference to the inverse configurations
-            const floatMatrix* getInverseConfigurations( ){ return &_inverseConfigurations.second; }
+                    pivot[ l ] = k;
 
-            //! Get a reference to the previous inverse configurations
-            const floatMatrix* getPreviousInverseConfigurations( ){ return &_previousInverseConfigurations.second; }
+                    pivotValue[ l ] = std::fabs( A[ W * ( n * k + k ) + l ] );
 
-            //! Get a reference to the state variables used in the unknown vector of the non-linear solve
-            const floatVector* getNonLinearSolveStateVariables( ){ return &_nonLinearSolveStateVariables.second; }
+                }
 
-            //! Get a reference to the previous values of the state variables used in the unknown vector of the non-linear solve
-            const floatVector* getPreviousNonLinearSolveStateVariables( ){ return &_previousNonLinearSolveStateVariables.second; }
+                for ( unsigned int r = k + 1; r < n; r++ ){
 
-            //! Get a reference to the state variables not used in the unknown vector for the non-linear solve
-            const floatVector* getAdditionalStateVariables( ){ return &_additionalStateVariables.second; }
+                    for ( unsigned int l = 0; l < W; l++ ){
 
-            //! Get a reference to the previous values of the state variables not used in the unknown vector for the non-linear solve
-            const floatVector* getPreviousAdditionalStateVariables( ){ return &_previousAdditionalStateVariables.second; }
+                        const floatType value = std::fabs( A[ W * ( n * r + k ) + l ] );
 
-            floatVector getSubConfiguration( const floatMatrix &configurations, const unsigned int &lowerIndex, const unsigned int &upperIndex );
+                        const bool larger = value > pivotValue[ l ];
 
-            floatMatrix getSubConfigurationGradient( const floatMatrix &configurations, const unsigned int &lowerIndex, const unsigned int &upperIndex );
+                        pivot[ l ] = larger ? r : pivot[ l ];
 
-            floatVector getSubConfiguration( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+                        pivotValue[ l ] = larger ? value : pivotValue[ l ];
 
-            floatVector getPrecedingConfiguration( const unsigned int &index );
+                    }
 
-            floatVector getFollowingConfiguration( const unsigned int &index );
+                }
 
-            floatVector getConfiguration( const unsigned int &index );
+                // Swap the pivot rows into place
+                for ( unsigned int r = k + 1; r < n; r++ ){
 
-            floatVector getPreviousSubConfiguration( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+                    for ( unsigned int j = k; j < n; j++ ){
 
-            floatVector getPreviousPrecedingConfiguration( const unsigned int &index );
+                        for ( unsigned int l = 0; l < W; l++ ){
 
-            floatVector getPreviousFollowingConfiguration( const unsigned int &index );
+                            const bool swap = ( pivot[ l ] == r );
 
-            floatVector getPreviousConfiguration( const unsigned int &index );
+                            const floatType a = A[ W * ( n * k + j ) + l ];
 
-            floatMatrix getSubConfigurationGradient( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+                            const floatType c = A[ W * ( n * r + j ) + l ];
 
-            floatMatrix getPrecedingConfigurationGradient( const unsigned int &index );
+                            A[ W * ( n * k + j ) + l ] = swap ? c : a;
 
-            floatMatrix getFollowingConfigurationGradient( const unsigned int &index );
+                            A[ W * ( n * r + j ) + l ] = swap ? a : c;
 
-            floatMatrix getPreviousSubConfigurationGradient( const unsigned int &lowerIndex, const unsigned int &upperIndex );
+                        }
 
-            floatMatrix getPreviousPrecedingConfigurationGradient( const unsigned int &index );
+                    }
 
-            floatMatrix getPreviousFollowingConfigurationGradient( const unsigned int &index );
+                    for ( unsigned int l = 0; l < W; l++ ){
 
-            const floatType* getLSResidualNorm( );
+                        const bool swap = ( pivot[ l ] == r );
 
-            const floatMatrix* getdF1dF( );
+                        const floatType a = b[ W * k + l ];
 
-            const floatMatrix* getdF1dFn( );
+                        const floatType c = b[ W * r + l ];
 
-            const floatMatrix* getPreviousdF1dF( );
+                        b[ W * k + l ] = swap ? c : a;
 
-            const floatMatrix* getPreviousdF1dFn( );
+                        b[ W * r + l ] = swap ? a : c;
 
-            virtual void setResidualClasses( );
+                    }
 
-            void setResidualClasses( std::vector< residualBase* > &residualClasses );
+                }
 
-            std::vector< residualBase* >* getResidualClasses( );
+                for ( unsigned int l = 0; l < W; l++ ){
 
-            const floatVector* getResidual( );
+                    active[ l ] = active[ l ] && ( pivotValue[ l ] > threshold[ l ] );
 
-            const floatVector* getFlatJacobian( );
+                    inversePivot[ l ] = active[ l ] ? 1 / A[ W * ( n * k + k ) + l ] : 0;
 
-            floatMatrix getJacobian( );
+                }
 
-            const floatVector* getFlatdRdF( );
+                // Eliminate the column below the pivot
+                for ( unsigned int r = k + 1; r < n; r++ ){
 
-            floatMatrix getdRdF( );
+                    for ( unsigned int l = 0; l < W; l++ ){
 
-            const floatVector* getdRdT( );
+                        x[ l ] = A[ W * ( n * r + k ) + l ] * inversePivot[ l ];
 
-            const floatVector* getFlatAdditionalDerivatives( );
+                    }
 
-            floatMatrix getAdditionalDerivatives( );
+                    for ( unsigned int j = k + 1; j < n; j++ ){
 
-            const floatVector* getUnknownVector( );
+                        for ( unsigned int l = 0; l < W; l++ ){
 
-            const floatVector* getTolerance( );
+                            A[ W * ( n * r + j ) + l ] -= x[ l ] * A[ W * ( n * k + j ) + l ];
 
-            virtual bool checkConvergence( );
+                        }
 
-            virtual bool checkLSConvergence( );
+                    }
 
-            const floatVector* getCauchyStress( );
+                    for ( unsigned int l = 0; l < W; l++ ){
 
-            const floatVector* getPreviousCauchyStress( );
+                        b[ W * r + l ] -= x[ l ] * b[ W * k + l ];
 
-            virtual void evaluate( );
+                    }
 
-            //! Add data to the vector of values which will be cleared after each iteration
-            void addIterationData( dataBase *data ){ _iterationData.push_back( data ); }
+                }
 
-        private:
+            }
 
-            // Friend classes
-            friend class unit_test::hydraBaseTester; //!< Friend class which allows modification of private variables. ONLY TO BE USED FOR TESTING!
+            // Back substitution
+            for ( unsigned int k = n; k-- > 0; ){
 
-            floatType _time; //!< The current time
+                for ( unsigned int l = 0; l < W; l++ ){
 
-            floatType _deltaTime; //!< The change in time
+                    x[ l ] = b[ W * k + l ];
 
-            floatType _temperature; //!< The current temperature
+                }
 
-            floatType _previousTemperature; //!< The previous temperature
+                for ( unsigned int j = k + 1; j < n; j++ ){
 
-            floatVector _deformationGradient; //!< The current deformation gradient
+                    for ( unsigned int l = 0; l < W; l++ ){
 
-            floatVector _previousDeformationGradient; //!< The previous deformation gradient
+                        x[ l ] -= A[ W * ( n * k + j ) + l ] * b[ W * j + l ];
 
-            floatVector _previousStateVariables; //!< The previous state variables
+                    }
 
-            floatVector _parameters; //!< The model parameters
+                }
 
-            unsigned int _numConfigurations; //!< The number of configurations
+                for ( unsigned int l = 0; l < W; l++ ){
 
-            unsigned int _numNonLinearSolveStateVariables; //!< The number of state variables which will be solved in the Newton-Raphson loop
-            unsigned int _dimension; //!< The spatial dimension of the problem
+                    b[ W * k + l ] = active[ l ] ? x[ l ] / A[ W * ( n * k + k ) + l ] : b[ W * k + l ];
 
-            floatType _tolr; //!< The relative tolerance
+                }
 
-            floatType _tola; //!< The absolute tolerance
+            }
 
-            unsigned int _maxIterations; //!< The maximum number of allowable iterations
+        }
 
-            unsigned int _maxLSIterations; //!< The maximum number of line-search iterations
+        /*!
+         * Get the number of values of the workspace required by tardigradeHydra::lockstep::solve
+         *
+         * \param &numUnknowns: The number of unknowns
+         */
+        template< unsigned int W >
+        inline unsigned int solveWorkspaceSize( const unsigned int &numUnknowns ){
+
+            return ( numUnknowns * numUnknowns + 2 * numUnknowns ) * W;
+
+        }
+
+        /*!
+         * Solve the non-linear systems of \f$ W \f$ material points in lockstep using Newton's method.
+         *
+         * The residuals of all of the lanes are evaluated at every iteration but the unknowns of a lane are frozen
+         * once it has converged (or its jacobian is singular) while the remaining lanes keep iterating. The
+         * convergence criterion of each lane is the same as hydraBase i.e., every component of the residual must be
+         * less than \f$ tolr \left( |R_0| + |X_0| \right) + tola \f$. No line search is performed.
+         *
+         * \param &numUnknowns: The number of unknowns
+         * \param &residual: The function which computes the residuals and jacobians of all of the lanes with the
+         *     signature residual( const floatType *X, floatType *R, floatType *J ) where the unknown vectors
+         *     X and residuals R have number of unknowns x W values and the row-major jacobians J have
+         *     number of unknowns**2 x W values.
+         * \param *unknownVector: The unknown vectors (number of unknowns x W). The initial values are the initial
+         *     estimates and the final values are the solutions.
+         * \param &relativeTolerance: The relative tolerance
+         * \param &absoluteTolerance: The absolute tolerance
+         * \param &maxIterations: The maximum number of iterations
+         * \param *converged: The lanes which converged (W)
+         * \param *iterations: The number of iterations of each lane (W)
+         * \param *workspace: The workspace of the residuals, jacobians, and tolerances which must have
+         *     solveWorkspaceSize< W >( numUnknowns ) values. It may be re-used between calls so that the solve
+         *     doesn't allocate.
+         */
+        template< unsigned int W, class residualFunction >
+        void solve( const unsigned int &numUnknowns, residualFunction &residual, floatType *unknownVector,
+                    const floatType &relativeTolerance, const floatType &absoluteTolerance, const unsigned int &maxIterations,
+                    bool *converged, unsigned int *iterations, floatType *workspace ){
 
-            floatType _lsAlpha; //!< The line-search alpha value i.e., the term by which it is judged that the line-search is converging
+            const unsigned int n = numUnknowns;
 
-            dataStorage< floatMatrix > _configurations; //!< The current values of the configurations
+            floatType *R = workspace;
 
-            dataStorage< floatMatrix > _previousConfigurations; //!< The previous values of the configurations
+            floatType *J = R + n * W;
 
-            dataStorage< floatMatrix > _inverseConfigurations; //!< The inverses of the configurations
+            floatType *tolerance = J + n * n * W;
 
-            dataStorage< floatMatrix > _previousInverseConfigurations; //!< The inverses of the previous configurations
+            bool active[ W ];
 
-            dataStorage< floatVector > _nonLinearSolveStateVariables; //!< The current values of the state variables involved in the non-linear solve
-            dataStorage< floatVector > _previousNonLinearSolveStateVariables; //!< The previous values of the state variables involved in the non-linear solve
+            residual( unknownVector, R, J );
 
-            dataStorage< floatVector > _additionalStateVariables; //!< The current values of the additional state variables
+            for ( unsigned int i = 0; i < n * W; i++ ){
 
-            dataStorage< floatVector > _previousAdditionalStateVariables; //!< The previous values of the additional state variables
+                tolerance[ i ] = relativeTolerance * ( std::fabs( R[ i ] ) + std::fabs( unknownVector[ i ] ) ) + absoluteTolerance;
 
-            dataStorage< floatMatrix > _dF1dF; //!< The partial derivative of the first configuration w.r.t. the deformation gradient
+            }
 
-            dataStorage< floatMatrix > _dF1dFn; //!< The partial derivative of the first configuration w.r.t. all the other configurations
+            auto checkConvergence = [ & ]( ){
 
-            dataStorage< floatMatrix > _previousdF1dF; //!< The partial derivative of the previous first configuration w.r.t. the deformation gradient
+                bool anyActive = false;
 
-            dataStorage< floatMatrix > _previousdF1dFn; //!< The partial derivative of the previous first configuration w.r.t. all the other configurations
+                for ( unsigned int l = 0; l < W; l++ ){
 
-            std::vector< dataBase* > _iterationData; //!< A vector of pointers to data which should be cleared at each iteration
+                    bool laneConverged = true;
 
-            dataStorage< std::vector< residualBase* > > _residualClasses; //!< A vector of classes which compute the terms in the residual equation
+                    for ( unsigned int i = 0; i < n; i++ ){
 
-            dataStorage< floatVector > _residual; //!< The residual vector for the global solve
+                        laneConverged = laneConverged && ( std::fabs( R[ W * i + l ] ) <= tolerance[ W * i + l ] );
 
-            dataStorage< floatVector > _jacobian; //!< The jacobian matrix in row-major form for the global solve
+                    }
 
-            dataStorage< floatVector > _dRdF; //!< The gradient of the residual w.r.t. the deformation gradient in row-major form for the global solve
+                    converged[ l ] = converged[ l ] || ( active[ l ] && laneConverged );
 
-            dataStorage< floatVector > _dRdT; //!< The gradient of the residual w.r.t. the temperature for the global solve
+                    active[ l ] = active[ l ] && !laneConverged;
 
-            dataStorage< floatVector > _additionalDerivatives; //!< Additional derivatives of the residual
+                    anyActive = anyActive || active[ l ];
 
-            dataStorage< floatVector > _X; //!< The unknown vector { cauchyStress, F1, ..., Fn, xi1, ..., xim }
+                }
 
-            dataStorage< floatVector > _tolerance; //!< The tolerance vector for the non-linear solve
+                return anyActive;
 
-            dataStorage< floatType > _lsResidualNorm; //!< The reference residual norm for the line-search convergence criteria
+            };
 
-            dataStorage< floatVector > _cauchyStress; //!< The Cauchy stress as determined from the current state
+            for ( unsigned int l = 0; l < W; l++ ){
 
-            dataStorage< floatVector > _previousCauchyStress; //!< The previous value of the Cauchy stress as determined from the current state
+                converged[ l ] = false;
 
-            unsigned int _iteration = 0; //!< The current iteration of the non-linear problem
+                active[ l ] = true;
 
-            unsigned int _LSIteration = 0; //!< The current line search iteration of the non-linear problem
+                iterations[ l ] = 0;
 
-            floatType _lambda = 1;
+            }
 
-            virtual void decomposeUnknownVector( );
+            bool anyActive = checkConvergence( );
 
-            virtual void decomposeStateVariableVector( );
+            for ( unsigned int iteration = 0; anyActive && ( iteration < maxIterations ); iteration++ ){
 
-            void setFirstConfigurationGradients( );
+                // The Newton step is stored in the residual
+                for ( unsigned int i = 0; i < n * W; i++ ){
 
-            void setPreviousFirstConfigurationGradients( );
+                    R[ i ] *= -1;
 
-            virtual void formNonLinearProblem( );
+                }
 
-            void solveNonLinearProblem( );
+                solveLinearSystem< W >( n, J, R, active );
 
-            virtual void initializeUnknownVector( );
+                for ( unsigned int i = 0; i < n; i++ ){
 
-            virtual void setTolerance( );
+                    for ( unsigned int l = 0; l < W; l++ ){
 
-            void setTolerance( const floatVector &tolerance );
+                        unknownVector[ W * i + l ] += active[ l ] ? R[ W * i + l ] : 0;
 
-            void incrementIteration( ){ _iteration++; }
+                    }
 
-            virtual void updateLambda( ){ _lambda *= 0.5; }
+                }
 
-            void incrementLSIteration( ){ _LSIteration++; }
+                for ( unsigned int l = 0; l < W; l++ ){
 
-            void resetLSIteration( ){ _LSIteration = 0; _lambda = 1.0;
-                                      _lsResidualNorm.second = tardigradeVectorTools::l2norm( *getResidual( ) );
-                                      _lsResidualNorm.first = true; }
+                    iterations[ l ] += active[ l ];
 
-            const floatType* getLambda( ){ return &_lambda; }
+                }
 
-            bool checkIteration( ){ return _iteration < _maxIterations; }
+                residual( unknownVector, R, J );
 
-            bool checkLSIteration( ){ return _LSIteration < _maxLSIterations; }
+                anyActive = checkConvergence( );
 
-            virtual void updateUnknownVector( const floatVector &newUnknownVector );
+            }
 
-            void resetIterationData( );
+        }
 
-    };
+    }
 
     /// Say hello
     /// @param message The message to print
     errorOut sayHello(std::string message);
 
+    /*!
+     * Build a configured hydra model for an Abaqus material. The factory is called once per thread and material name
+     * using the values of the first material point the material is evaluated at. Later calls move the model to the new
+     * material point so the parameters and the number of state variables must not change between calls.
+     */
+    typedef std::function< std::unique_ptr< hydraBase >( const floatType &time, const floatType &deltaTime,
+                                                         const floatType &temperature, const floatType &previousTemperature,
+                                                         const floatVector &deformationGradient, const floatVector &previousDeformationGradient,
+                                                         const floatVector &previousStateVariables, const floatVector &parameters ) > abaqusMaterialFactory;
+
+    void registerAbaqusMaterial( const std::string &name, const abaqusMaterialFactory &factory );
+
+    /*!
+     * Register an Abaqus material when the library which defines the registrar is loaded. A static registrar in the
+     * translation unit of a model makes the material available to the UMAT without changing hydra e.g.
+     *
+     * static tardigradeHydra::abaqusMaterialRegistrar registrar( "MY-MATERIAL", myFactory );
+     */
+    struct abaqusMaterialRegistrar{
+
+        /*!
+         * Register the material
+         *
+         * \param &name: The name of the material as given in the Abaqus input file
+         * \param &factory: The function which builds the configured hydra model
+         */
+        abaqusMaterialRegistrar( const std::string &name, const abaqusMaterialFactory &factory ){ registerAbaqusMaterial( name, factory ); }
+
+    };
+
+    void computeAbaqusTangent( const floatVector &cauchyStress, const floatMatrix &dCauchyStressdF,
+                               const floatType *deformationGradient, const int &NDI, const int &NSHR, double *DDSDDE );
+
+    bool abaqusHydraInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double *DDSDDT,       const double *TIME,
+                               const double &DTIME,  const double &TEMP,   const double &DTEMP,  const char *CMNAME,   const int &NDI,
+                               const int &NSHR,      const int &NTENS,     const int &NSTATV,    const double *PROPS,  const int &NPROPS,
+                               double &PNEWDT,       const double *DFGRD0, const double *DFGRD1 );
+
     void abaqusInterface( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
                           double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
                           const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
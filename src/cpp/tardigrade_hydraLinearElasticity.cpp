@@ -38,18 +38,33 @@ namespace tardigradeHydra{
              * Set the current value of the elastic Green-Lagrange strain
              */
     
-            floatVector Fe = ( *hydra->getConfigurations( ) )[ 0 ];
-    
-            floatVector Ee;
-   
-            floatMatrix dEedFe;
+            const unsigned int dim = *hydra->getDimension( );
+
+            const floatVector &Fe = ( *hydra->getConfigurations( ) )[ 0 ];
+
+            if ( dim != 3 ){
+
+                floatVector Ee;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fe, Ee ) );
+
+                setEe( Ee );
+
+                return;
+
+            }
+
+            // Only the six independent components are computed
+            floatType voigtEe[ 6 ];
+
+            voigt::computeGreenLagrangeStrain( Fe.data( ), voigtEe );
+
+            floatVector Ee( 9 );
+
+            voigt::expand( voigtEe, Ee.data( ) );
 
-            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fe, Ee, dEedFe ) );
-    
             setEe( Ee );
     
-            setdEedFe( dEedFe );
-    
         }
     
         void residual::setEe( const floatVector &Ee ){
@@ -85,11 +100,39 @@ namespace tardigradeHydra{
         void residual::setdEedFe( ){
             /*!
              * Set the gradient of the elastic Green-Lagrange strain w.r.t. the elastic deformation gradient
-             * 
-             * Default assumption is that this happens when the Green-Lagrange strain is computed; 
              */
     
-            TARDIGRADE_ERROR_TOOLS_CATCH( getEe( ) );
+            const unsigned int dim = *hydra->getDimension( );
+
+            const floatVector &Fe = ( *hydra->getConfigurations( ) )[ 0 ];
+
+            if ( dim != 3 ){
+
+                floatVector Ee;
+
+                floatMatrix dEedFe;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fe, Ee, dEedFe ) );
+
+                setdEedFe( dEedFe );
+
+                return;
+
+            }
+
+            floatType flatdEedFe[ 81 ];
+
+            voigt::computedEedFe( Fe.data( ), flatdEedFe );
+
+            floatMatrix dEedFe( 9, floatVector( 9 ) );
+
+            for ( unsigned int i = 0; i < 9; i++ ){
+
+                std::copy( flatdEedFe + 9 * i, flatdEedFe + 9 * ( i + 1 ), dEedFe[ i ].begin( ) );
+
+            }
+
+            setdEedFe( dEedFe );
     
         }
     
@@ -126,12 +169,76 @@ namespace tardigradeHydra{
         void residual::setPK2Stress( ){
             /*!
              * Compute the Second Piola-Kirchhoff stress
+             *
+             * In three dimensions a symmetric elastic strain is stored by its six Voigt components and the stiffness
+             * is applied to them. A non-symmetric strain (e.g., from a derived class) uses all of the components.
              */
-    
-            floatVector eye( getEe( )->size( ), 0 );
-            tardigradeVectorTools::eye( eye );
-    
-            floatVector PK2Stress = ( *getLambda( ) ) * tardigradeVectorTools::trace( *getEe( ) ) * eye + 2 * ( *getMu( ) ) * ( *getEe( ) );
+
+            const unsigned int dim = *hydra->getDimension( );
+
+            const floatVector *Ee;
+            TARDIGRADE_ERROR_TOOLS_CATCH( Ee = getEe( ) );
+
+            if ( ( dim == 3 ) && ( Ee->size( ) == 9 ) ){
+
+                floatType voigtEe[ 6 ];
+
+                bool isSymmetric = true;
+
+                for ( unsigned int v = 0; isSymmetric && ( v < 6 ); v++ ){
+
+                    voigtEe[ v ] = ( *Ee )[ 3 * voigt::voigtIndices[ v ][ 0 ] + voigt::voigtIndices[ v ][ 1 ] ];
+
+                    isSymmetric = ( voigtEe[ v ] == ( *Ee )[ 3 * voigt::voigtIndices[ v ][ 1 ] + voigt::voigtIndices[ v ][ 0 ] ] );
+
+                }
+
+                if ( isSymmetric ){
+
+                    voigt::isotropicStiffness stiffness;
+
+                    stiffness.lambda = *getLambda( );
+
+                    stiffness.mu = *getMu( );
+
+                    floatType voigtPK2Stress[ 6 ];
+
+                    stiffness.apply( voigtEe, voigtPK2Stress );
+
+                    floatVector PK2Stress( 9 );
+
+                    voigt::expand( voigtPK2Stress, PK2Stress.data( ) );
+
+                    setPK2Stress( PK2Stress );
+
+                    return;
+
+                }
+
+            }
+
+            floatType traceEe = 0;
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                traceEe += ( *Ee )[ dim * i + i ];
+
+            }
+
+            // Apply the isotropic stiffness directly rather than forming the identity tensor
+            floatVector PK2Stress( Ee->size( ) );
+
+            for ( unsigned int i = 0; i < PK2Stress.size( ); i++ ){
+
+                PK2Stress[ i ] = 2 * ( *getMu( ) ) * ( *Ee )[ i ];
+
+            }
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                PK2Stress[ dim * i + i ] += ( *getLambda( ) ) * traceEe;
+
+            }
     
             setPK2Stress( PK2Stress );
     
@@ -170,22 +277,54 @@ namespace tardigradeHydra{
         void residual::setdPK2StressdEe( ){
             /*!
              * Compute the gradient of the PK2 stress w.r.t. the elastic Green-Lagrange strain
+             *
+             * In three dimensions the isotropic stiffness is stored by its structure (see setIsotropicdPK2StressdEe)
+             * and is only expanded to a matrix if getdPK2StressdEe is called.
              */
     
-            floatVector eye( getEe( )->size( ), 0 );
-            tardigradeVectorTools::eye( eye );
-    
-            floatMatrix EYE = tardigradeVectorTools::eye< floatType >( getEe( )->size( ) );
-    
-            floatMatrix dPK2StressdEe = ( *getLambda( ) ) * tardigradeVectorTools::dyadic( eye, eye ) + 2 * ( *getMu( ) ) * EYE;
-    
+            const unsigned int dim = *hydra->getDimension( );
+
+            if ( dim == 3 ){
+
+                voigt::isotropicStiffness stiffness;
+
+                stiffness.lambda = *getLambda( );
+
+                stiffness.mu = *getMu( );
+
+                setIsotropicdPK2StressdEe( stiffness );
+
+                return;
+
+            }
+
+            // Fill the isotropic stiffness directly rather than forming the identity tensors
+            floatMatrix dPK2StressdEe( dim * dim, floatVector( dim * dim, 0 ) );
+
+            for ( unsigned int i = 0; i < dim * dim; i++ ){
+
+                dPK2StressdEe[ i ][ i ] = 2 * ( *getMu( ) );
+
+            }
+
+            for ( unsigned int A = 0; A < dim; A++ ){
+
+                for ( unsigned int C = 0; C < dim; C++ ){
+
+                    dPK2StressdEe[ dim * A + A ][ dim * C + C ] += ( *getLambda( ) );
+
+                }
+
+            }
+
             setdPK2StressdEe( dPK2StressdEe );
     
         }
     
         void residual::setdPK2StressdEe( const floatMatrix &dPK2StressdEe ){
             /*!
-             * Set the gradient of the PK2 stress w.r.t. the elastic Green-Lagrange strain
+             * Set the gradient of the PK2 stress w.r.t. the elastic Green-Lagrange strain. Any isotropic stiffness set
+             * by setIsotropicdPK2StressdEe is discarded so that the derivatives are computed from this matrix.
              *
              * \param &dPK2StressdEe: The gradient of the Second Piola-Kirchhoff stress w.r.t. the elastic Green-Lagrange strain
              */
@@ -195,17 +334,60 @@ namespace tardigradeHydra{
             _dPK2StressdEe.first = true;
     
             addIterationData( &_dPK2StressdEe );
+
+            _isotropicdPK2StressdEe.clear( );
     
         }
+
+        void residual::setIsotropicdPK2StressdEe( const voigt::isotropicStiffness &stiffness ){
+            /*!
+             * Set the gradient of the PK2 stress w.r.t. the elastic Green-Lagrange strain as an isotropic stiffness
+             * which is applied through its structure
+             *
+             * \param &stiffness: The isotropic stiffness
+             */
+
+            _isotropicdPK2StressdEe.second = stiffness;
+
+            _isotropicdPK2StressdEe.first = true;
+
+            addIterationData( &_isotropicdPK2StressdEe );
+
+        }
     
         const floatMatrix* residual::getdPK2StressdEe( ){
             /*!
-             * Get the gradient of the Second Piola-Kirchhoff stress w.r.t. the elastic Green-Lagrange strain
+             * Get the gradient of the Second Piola-Kirchhoff stress w.r.t. the elastic Green-Lagrange strain. If the
+             * gradient was set as an isotropic stiffness it is expanded to a matrix.
              */
     
             if ( !_dPK2StressdEe.first ){
-    
-                TARDIGRADE_ERROR_TOOLS_CATCH( setdPK2StressdEe( ) );
+
+                if ( !_isotropicdPK2StressdEe.first ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( setdPK2StressdEe( ) );
+
+                }
+
+                if ( !_dPK2StressdEe.first && _isotropicdPK2StressdEe.first ){
+
+                    floatType flatdPK2StressdEe[ 81 ];
+
+                    _isotropicdPK2StressdEe.second.expand( flatdPK2StressdEe );
+
+                    _dPK2StressdEe.second = floatMatrix( 9, floatVector( 9 ) );
+
+                    for ( unsigned int i = 0; i < 9; i++ ){
+
+                        std::copy( flatdPK2StressdEe + 9 * i, flatdPK2StressdEe + 9 * ( i + 1 ), _dPK2StressdEe.second[ i ].begin( ) );
+
+                    }
+
+                    _dPK2StressdEe.first = true;
+
+                    addIterationData( &_dPK2StressdEe );
+
+                }
     
             }
     
@@ -213,15 +395,87 @@ namespace tardigradeHydra{
     
         }
 
+        const voigt::isotropicStiffness* residual::getIsotropicdPK2StressdEe( ){
+            /*!
+             * Get the gradient of the Second Piola-Kirchhoff stress w.r.t. the elastic Green-Lagrange strain as an
+             * isotropic stiffness. Returns NULL if the gradient was set as a matrix (e.g., by a derived class).
+             */
+
+            if ( !_isotropicdPK2StressdEe.first && !_dPK2StressdEe.first ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( setdPK2StressdEe( ) );
+
+            }
+
+            return _isotropicdPK2StressdEe.first ? &_isotropicdPK2StressdEe.second : NULL;
+
+        }
+
         void residual::setdPK2StressdFe( ){
             /*!
              * Set the derivative of the second Piola-Kirchhoff stress w.r.t. the elastic
              * deformation gradient
+             *
+             * In three dimensions, if the gradient of the PK2 stress w.r.t. the elastic strain is an isotropic
+             * stiffness and the rows of the symmetric pairs of the strain gradient are equal, the stiffness is applied
+             * to the six Voigt rows of the strain gradient. Otherwise the two gradients are multiplied as matrices.
              */
 
-             floatMatrix dPK2StressdFe = tardigradeVectorTools::dot( *getdPK2StressdEe( ), *getdEedFe( ) );
+            const floatMatrix *dEedFe;
+            TARDIGRADE_ERROR_TOOLS_CATCH( dEedFe = getdEedFe( ) );
+
+            const voigt::isotropicStiffness *stiffness = NULL;
+
+            if ( ( *hydra->getDimension( ) == 3 ) && ( dEedFe->size( ) == 9 ) ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( stiffness = getIsotropicdPK2StressdEe( ) );
+
+            }
+
+            floatType voigtdEedFe[ 54 ];
+
+            bool useVoigt = ( stiffness != NULL );
+
+            for ( unsigned int v = 0; useVoigt && ( v < 6 ); v++ ){
+
+                const floatVector &row = ( *dEedFe )[ 3 * voigt::voigtIndices[ v ][ 0 ] + voigt::voigtIndices[ v ][ 1 ] ];
+
+                useVoigt = ( row.size( ) == 9 ) && ( row == ( *dEedFe )[ 3 * voigt::voigtIndices[ v ][ 1 ] + voigt::voigtIndices[ v ][ 0 ] ] );
+
+                if ( useVoigt ){
+
+                    std::copy( row.begin( ), row.end( ), voigtdEedFe + 9 * v );
+
+                }
+
+            }
+
+            if ( useVoigt ){
+
+                floatType flatdPK2StressdFe[ 81 ];
+
+                voigt::computedPK2StressdFe( *stiffness, voigtdEedFe, flatdPK2StressdFe );
+
+                floatMatrix dPK2StressdFe( 9, floatVector( 9 ) );
+
+                for ( unsigned int i = 0; i < 9; i++ ){
 
-             setdPK2StressdFe( dPK2StressdFe );
+                    std::copy( flatdPK2StressdFe + 9 * i, flatdPK2StressdFe + 9 * ( i + 1 ), dPK2StressdFe[ i ].begin( ) );
+
+                }
+
+                setdPK2StressdFe( dPK2StressdFe );
+
+                return;
+
+            }
+
+            const floatMatrix *dPK2StressdEe;
+            TARDIGRADE_ERROR_TOOLS_CATCH( dPK2StressdEe = getdPK2StressdEe( ) );
+
+            floatMatrix dPK2StressdFe = tardigradeVectorTools::dot( *dPK2StressdEe, *dEedFe );
+
+            setdPK2StressdFe( dPK2StressdFe );
 
         }
 
@@ -260,62 +514,228 @@ namespace tardigradeHydra{
 
         void residual::setCauchyStress( ){
             /*!
-             * Set the Cauchy stress
+             * Set the Cauchy stress \f$ \sigma = \frac{1}{J^e} F^e S F^{eT} \f$. Only the value is computed so that
+             * evaluations which don't require the gradients don't form them.
              */
-    
-            floatVector Fe = ( *hydra->getConfigurations( ) )[ 0 ];
-    
-            floatMatrix dFedF = ( *hydra->getdF1dF( ) );
-    
-            floatMatrix dFedFn = ( *hydra->getdF1dFn( ) );
-    
-            // Compute the gradient of the PK2 stress w.r.t. the elastic deformation gradient
-            floatMatrix dPK2StressdFe = *getdPK2StressdFe( );
 
-            // Compute the Second Piola-Kirchhoff stress and it's gradients
-            floatMatrix dPK2StressdF = tardigradeVectorTools::dot( *getdPK2StressdFe( ), dFedF );
-    
-            floatMatrix dPK2StressdFn = tardigradeVectorTools::dot( *getdPK2StressdFe( ), dFedFn );
-    
-            // Map the PK2 stress to the current configuration
-            floatVector cauchyStress;
-            floatMatrix dCauchyStressdPK2Stress;
-            floatMatrix dCauchyStressdFe;
-    
-            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeConstitutiveTools::pushForwardPK2Stress( *getPK2Stress( ), Fe, cauchyStress, dCauchyStressdPK2Stress, dCauchyStressdFe ) );
-    
-            setCauchyStress( cauchyStress );
-    
-            floatMatrix dCauchyStressdF  = tardigradeVectorTools::dot( dCauchyStressdPK2Stress, dPK2StressdF )
-                                         + tardigradeVectorTools::dot( dCauchyStressdFe, dFedF );
-    
-            floatMatrix dCauchyStressdFn = tardigradeVectorTools::dot( dCauchyStressdPK2Stress, dPK2StressdFn )
-                                         + tardigradeVectorTools::dot( dCauchyStressdFe, dFedFn );
+            const unsigned int dim = *hydra->getDimension( );
 
-            setdCauchyStressdPK2Stress( dCauchyStressdPK2Stress );   
+            const floatVector &Fe = ( *hydra->getConfigurations( ) )[ 0 ];
+
+            const floatVector *PK2Stress;
+            TARDIGRADE_ERROR_TOOLS_CATCH( PK2Stress = getPK2Stress( ) );
+
+            floatType Je;
+            TARDIGRADE_ERROR_TOOLS_CATCH( Je = tardigradeVectorTools::determinant( Fe, dim, dim ) );
+
+            // The intermediate product is drawn from the iteration workspace so that it isn't allocated every iteration
+            floatType *FeS = hydra->getIterationArena( )->allocate( dim * dim );
+
+            std::fill( FeS, FeS + dim * dim, 0 );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int A = 0; A < dim; A++ ){
+
+                    for ( unsigned int B = 0; B < dim; B++ ){
+
+                        FeS[ dim * i + B ] += Fe[ dim * i + A ] * ( *PK2Stress )[ dim * A + B ];
+
+                    }
+
+                }
+
+            }
+
+            floatVector cauchyStress( dim * dim, 0 );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    for ( unsigned int B = 0; B < dim; B++ ){
+
+                        cauchyStress[ dim * i + j ] += FeS[ dim * i + B ] * Fe[ dim * j + B ];
+
+                    }
+
+                    cauchyStress[ dim * i + j ] /= Je;
+
+                }
+
+            }
+
+            setCauchyStress( cauchyStress );
 
-            setdCauchyStressdF( dCauchyStressdF );
-    
-            setdCauchyStressdFn( dCauchyStressdFn );
-    
         }
     
         void residual::setdCauchyStressdPK2Stress( ){
             /*!
              * Set the derivative of the computed Cauchy stress w.r.t. the second Piola-Kirchoff stress (this is a partial derivative generally)
              */
-    
-            setCauchyStress( );
+
+            const unsigned int dim = *hydra->getDimension( );
+
+            const floatVector &Fe = ( *hydra->getConfigurations( ) )[ 0 ];
+
+            floatType Je;
+            TARDIGRADE_ERROR_TOOLS_CATCH( Je = tardigradeVectorTools::determinant( Fe, dim, dim ) );
+
+            floatMatrix dCauchyStressdPK2Stress( dim * dim, floatVector( dim * dim, 0 ) );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    for ( unsigned int A = 0; A < dim; A++ ){
+
+                        for ( unsigned int B = 0; B < dim; B++ ){
+
+                            dCauchyStressdPK2Stress[ dim * i + j ][ dim * A + B ] = Fe[ dim * i + A ] * Fe[ dim * j + B ] / Je;
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            setdCauchyStressdPK2Stress( dCauchyStressdPK2Stress );
     
         }
 
+        void residual::setdCauchyStressdFe( ){
+            /*!
+             * Set the total derivative of the computed Cauchy stress w.r.t. the elastic deformation gradient including
+             * the dependence of the second Piola-Kirchhoff stress on the elastic deformation gradient
+             */
+
+            const unsigned int dim = *hydra->getDimension( );
+
+            const floatVector &Fe = ( *hydra->getConfigurations( ) )[ 0 ];
+
+            const floatVector *PK2Stress;
+            TARDIGRADE_ERROR_TOOLS_CATCH( PK2Stress = getPK2Stress( ) );
+
+            const floatVector *cauchyStress;
+            TARDIGRADE_ERROR_TOOLS_CATCH( cauchyStress = getCauchyStress( ) );
+
+            floatType Je;
+            TARDIGRADE_ERROR_TOOLS_CATCH( Je = tardigradeVectorTools::determinant( Fe, dim, dim ) );
+
+            floatVector FeInv;
+            TARDIGRADE_ERROR_TOOLS_CATCH( FeInv = tardigradeVectorTools::inverse( Fe, dim, dim ) );
+
+            // The intermediate products are drawn from the iteration workspace so that they aren't allocated every iteration
+            floatType *FeS = hydra->getIterationArena( )->allocate( dim * dim );
+
+            floatType *SFeT = hydra->getIterationArena( )->allocate( dim * dim );
+
+            std::fill( FeS, FeS + dim * dim, 0 );
+
+            std::fill( SFeT, SFeT + dim * dim, 0 );
+
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int A = 0; A < dim; A++ ){
+
+                    for ( unsigned int B = 0; B < dim; B++ ){
+
+                        FeS[ dim * i + B ] += Fe[ dim * i + A ] * ( *PK2Stress )[ dim * A + B ];
+
+                        SFeT[ dim * A + i ] += ( *PK2Stress )[ dim * A + B ] * Fe[ dim * i + B ];
+
+                    }
+
+                }
+
+            }
+
+            const floatMatrix *dPK2StressdFe;
+            TARDIGRADE_ERROR_TOOLS_CATCH( dPK2StressdFe = getdPK2StressdFe( ) );
+
+            // The dependence of the Cauchy stress on the second Piola-Kirchhoff stress is pushed forward one column at a
+            // time i.e. Fe dPK2StressdFe_kl Fe^T / J rather than forming dCauchyStressdPK2Stress and taking the product
+            floatMatrix dCauchyStressdFe( dim * dim, floatVector( dim * dim, 0 ) );
+
+            floatType *FedPK2StressdFekl = hydra->getIterationArena( )->allocate( dim * dim );
+
+            for ( unsigned int kl = 0; kl < dim * dim; kl++ ){
+
+                std::fill( FedPK2StressdFekl, FedPK2StressdFekl + dim * dim, 0 );
+
+                for ( unsigned int i = 0; i < dim; i++ ){
+
+                    for ( unsigned int A = 0; A < dim; A++ ){
+
+                        for ( unsigned int B = 0; B < dim; B++ ){
+
+                            FedPK2StressdFekl[ dim * i + B ] += Fe[ dim * i + A ] * ( *dPK2StressdFe )[ dim * A + B ][ kl ];
+
+                        }
+
+                    }
+
+                }
+
+                for ( unsigned int i = 0; i < dim; i++ ){
+
+                    for ( unsigned int j = 0; j < dim; j++ ){
+
+                        floatType value = 0;
+
+                        for ( unsigned int B = 0; B < dim; B++ ){
+
+                            value += FedPK2StressdFekl[ dim * i + B ] * Fe[ dim * j + B ];
+
+                        }
+
+                        dCauchyStressdFe[ dim * i + j ][ kl ] = value / Je;
+
+                    }
+
+                }
+
+            }
+
+            // The explicit dependence on the elastic deformation gradient
+            // d sigma_ij / d Fe_ab = ( delta_ia ( S Fe^T )_bj + ( Fe S )_ib delta_ja ) / J - sigma_ij FeInv_ba
+            for ( unsigned int i = 0; i < dim; i++ ){
+
+                for ( unsigned int j = 0; j < dim; j++ ){
+
+                    for ( unsigned int a = 0; a < dim; a++ ){
+
+                        for ( unsigned int b = 0; b < dim; b++ ){
+
+                            floatType value = -( *cauchyStress )[ dim * i + j ] * FeInv[ dim * b + a ];
+
+                            value += ( i == a ) ? SFeT[ dim * b + j ] / Je : 0;
+
+                            value += ( j == a ) ? FeS[ dim * i + b ] / Je : 0;
+
+                            dCauchyStressdFe[ dim * i + j ][ dim * a + b ] += value;
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            setdCauchyStressdFe( dCauchyStressdFe );
+
+        }
+
         void residual::setdCauchyStressdF( ){
             /*!
              * Set the derivative of the computed Cauchy stress w.r.t. F (this is a partial derivative generally)
              */
-    
-            setCauchyStress( );
-    
+
+            setdCauchyStressdF( tardigradeVectorTools::dot( *getdCauchyStressdFe( ), *hydra->getdF1dF( ) ) );
+
         }
 
         void residual::setdCauchyStressdPK2Stress( const floatMatrix &dCauchyStressdPK2Stress ){
@@ -378,13 +798,43 @@ namespace tardigradeHydra{
 
         }
 
+        void residual::setdCauchyStressdFe( const floatMatrix &dCauchyStressdFe ){
+            /*!
+             * Set the total derivative of the Cauchy stress w.r.t. the elastic deformation gradient
+             * 
+             * \param &dCauchyStressdFe: The total derivative of the Cauchy stress w.r.t. the elastic deformation gradient
+             */
+    
+            _dCauchyStressdFe.second = dCauchyStressdFe;
+    
+            _dCauchyStressdFe.first = true;
+    
+            addIterationData( &_dCauchyStressdFe );
+    
+        }
+
+        const floatMatrix* residual::getdCauchyStressdFe( ){
+            /*!
+             * Get the total derivative of the Cauchy stress w.r.t. the elastic deformation gradient
+             */
+
+            if ( !_dCauchyStressdFe.first ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( setdCauchyStressdFe( ) );
+
+            }
+
+            return &_dCauchyStressdFe.second;
+
+        }
+
         void residual::setdCauchyStressdFn( ){
             /*!
              * Set the derivative of the computed Cauchy stress w.r.t. the configurations solved for in the non-linear solve
              * (this is a partial derivative generally)
              */
     
-            setCauchyStress( );
+            setdCauchyStressdFn( tardigradeVectorTools::dot( *getdCauchyStressdFe( ), *hydra->getdF1dFn( ) ) );
     
         }
     
@@ -437,18 +887,20 @@ namespace tardigradeHydra{
     
             const unsigned int *dim = hydra->getDimension( );
     
-            // Form the Jacobian
-            floatMatrix jacobian = floatMatrix( getCauchyStress( )->size( ), floatVector( hydra->getUnknownVector( )->size( ), 0 ) );
+            const unsigned int numUnknowns = hydra->getUnknownVector( )->size( );
+
+            // Form the Jacobian in row-major form
+            floatVector jacobian( getCauchyStress( )->size( ) * numUnknowns, 0 );
     
             for ( unsigned int i = 0; i < ( *dim ); i++ ){
     
                 for ( unsigned int j = 0; j < ( *dim ); j++ ){
     
-                    jacobian[ ( *dim ) * i + j ][ ( *dim ) * i + j ] = -1;
+                    jacobian[ numUnknowns * ( ( *dim ) * i + j ) + ( *dim ) * i + j ] = -1;
     
                     for ( unsigned int I = 0; I < ( ( *hydra->getNumConfigurations( ) ) - 1 ) * ( *dim ) * ( *dim ); I++ ){
     
-                        jacobian[ ( *dim ) * i + j ][ getCauchyStress( )->size( ) + I ] = ( *getdCauchyStressdFn( ) )[ ( *dim ) * i + j ][ I ];
+                        jacobian[ numUnknowns * ( ( *dim ) * i + j ) + getCauchyStress( )->size( ) + I ] = ( *getdCauchyStressdFn( ) )[ ( *dim ) * i + j ][ I ];
     
                     }
     
@@ -456,7 +908,7 @@ namespace tardigradeHydra{
     
             }
     
-            setJacobian( jacobian );
+            setFlatJacobian( jacobian );
     
         }
     
@@ -62,6 +62,197 @@ namespace tardigradeHydra{
         typedef std::vector< floatType > floatVector; //!< Define a vector of floats
         typedef std::vector< std::vector< floatType > > floatMatrix; //!< Define a matrix of floats 
     
+        /*!
+         * Linear elasticity kernels for three dimensional problems which store the symmetric strains and stresses by
+         * their six independent components in the order \f$ 11, 22, 33, 23, 13, 12 \f$
+         */
+        namespace voigt{
+
+            //! The row and column of the second order tensor of each Voigt component
+            constexpr unsigned int voigtIndices[ 6 ][ 2 ] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 1, 2 }, { 0, 2 }, { 0, 1 } };
+
+            /*!
+             * The isotropic stiffness \f$ \mathbb{C} = \lambda \bf{I} \otimes \bf{I} + 2 \mu \mathbb{I} \f$ which is
+             * applied to the Voigt components of a symmetric tensor through its structure rather than as a 6x6 matrix
+             */
+            struct isotropicStiffness{
+
+                floatType lambda = 0; //!< The lambda Lame parameter
+
+                floatType mu = 0; //!< The mu Lame parameter
+
+                /*!
+                 * Apply the stiffness to a symmetric tensor
+                 *
+                 * \param *E: The Voigt components of the tensor (6)
+                 * \param *S: The Voigt components of the result (6)
+                 */
+                inline void apply( const floatType *E, floatType *S ) const {
+
+                    const floatType trace = E[ 0 ] + E[ 1 ] + E[ 2 ];
+
+                    for ( unsigned int i = 0; i < 3; i++ ){
+
+                        S[ i ] = lambda * trace + 2 * mu * E[ i ];
+
+                    }
+
+                    for ( unsigned int i = 3; i < 6; i++ ){
+
+                        S[ i ] = 2 * mu * E[ i ];
+
+                    }
+
+                }
+
+                /*!
+                 * Expand the stiffness to the row-major matrix which acts on the row-major components of a second
+                 * order tensor i.e., \f$ \mathbb{C}_{ABCD} = \lambda \delta_{AB} \delta_{CD} + 2 \mu \delta_{AC} \delta_{BD} \f$
+                 *
+                 * \param *C: The row-major stiffness (81)
+                 */
+                inline void expand( floatType *C ) const {
+
+                    std::fill( C, C + 81, 0 );
+
+                    for ( unsigned int i = 0; i < 9; i++ ){
+
+                        C[ 9 * i + i ] = 2 * mu;
+
+                    }
+
+                    for ( unsigned int A = 0; A < 3; A++ ){
+
+                        for ( unsigned int B = 0; B < 3; B++ ){
+
+                            C[ 9 * ( 3 * A + A ) + 3 * B + B ] += lambda;
+
+                        }
+
+                    }
+
+                }
+
+                //! Reset the Lame parameters so that the stiffness can be held in a tardigradeHydra::dataStorage
+                void clear( ){ lambda = 0; mu = 0; }
+
+            };
+
+            /*!
+             * Expand the Voigt components of a symmetric tensor to the row-major components
+             *
+             * \param *voigtTensor: The Voigt components (6)
+             * \param *tensor: The row-major components (9)
+             */
+            inline void expand( const floatType *voigtTensor, floatType *tensor ){
+
+                for ( unsigned int v = 0; v < 6; v++ ){
+
+                    tensor[ 3 * voigtIndices[ v ][ 0 ] + voigtIndices[ v ][ 1 ] ] = voigtTensor[ v ];
+
+                    tensor[ 3 * voigtIndices[ v ][ 1 ] + voigtIndices[ v ][ 0 ] ] = voigtTensor[ v ];
+
+                }
+
+            }
+
+            /*!
+             * Compute the elastic Green-Lagrange strain \f$ E^e_{AB} = \frac{1}{2} \left( F^e_{kA} F^e_{kB} - \delta_{AB} \right) \f$
+             *
+             * \param *Fe: The row-major elastic deformation gradient (9)
+             * \param *Ee: The Voigt components of the elastic Green-Lagrange strain (6)
+             */
+            inline void computeGreenLagrangeStrain( const floatType *Fe, floatType *Ee ){
+
+                for ( unsigned int v = 0; v < 6; v++ ){
+
+                    const unsigned int A = voigtIndices[ v ][ 0 ];
+
+                    const unsigned int B = voigtIndices[ v ][ 1 ];
+
+                    Ee[ v ] = 0.5 * ( Fe[ 3 * 0 + A ] * Fe[ 3 * 0 + B ] + Fe[ 3 * 1 + A ] * Fe[ 3 * 1 + B ] + Fe[ 3 * 2 + A ] * Fe[ 3 * 2 + B ] - ( ( A == B ) ? 1 : 0 ) );
+
+                }
+
+            }
+
+            /*!
+             * Compute the derivative of the elastic Green-Lagrange strain w.r.t. the elastic deformation gradient
+             * \f$ \frac{\partial E^e_{AB}}{\partial F^e_{kl}} = \frac{1}{2} \left( \delta_{lA} F^e_{kB} + F^e_{kA} \delta_{lB} \right) \f$
+             * where the row of each Voigt component is computed once and copied to its symmetric pair
+             *
+             * \param *Fe: The row-major elastic deformation gradient (9)
+             * \param *dEedFe: The row-major derivative of the elastic Green-Lagrange strain w.r.t. the elastic
+             *     deformation gradient (81)
+             */
+            inline void computedEedFe( const floatType *Fe, floatType *dEedFe ){
+
+                for ( unsigned int v = 0; v < 6; v++ ){
+
+                    const unsigned int A = voigtIndices[ v ][ 0 ];
+
+                    const unsigned int B = voigtIndices[ v ][ 1 ];
+
+                    floatType *row = dEedFe + 9 * ( 3 * A + B );
+
+                    std::fill( row, row + 9, 0 );
+
+                    for ( unsigned int k = 0; k < 3; k++ ){
+
+                        row[ 3 * k + A ] += 0.5 * Fe[ 3 * k + B ];
+
+                        row[ 3 * k + B ] += 0.5 * Fe[ 3 * k + A ];
+
+                    }
+
+                    if ( A != B ){
+
+                        std::copy( row, row + 9, dEedFe + 9 * ( 3 * B + A ) );
+
+                    }
+
+                }
+
+            }
+
+            /*!
+             * Compute the derivative of the second Piola-Kirchhoff stress w.r.t. the elastic deformation gradient by
+             * applying the stiffness to each column of the Voigt rows of the derivative of the elastic strain
+             *
+             * \param &stiffness: The isotropic stiffness
+             * \param *dEedFe: The rows of the Voigt components of the derivative of the elastic Green-Lagrange strain
+             *     w.r.t. the elastic deformation gradient (6 x 9)
+             * \param *dPK2StressdFe: The row-major derivative of the second Piola-Kirchhoff stress w.r.t. the elastic
+             *     deformation gradient (81)
+             */
+            inline void computedPK2StressdFe( const isotropicStiffness &stiffness, const floatType *dEedFe, floatType *dPK2StressdFe ){
+
+                floatType dEedFekl[ 6 ], dPK2StressdFekl[ 6 ];
+
+                for ( unsigned int kl = 0; kl < 9; kl++ ){
+
+                    for ( unsigned int v = 0; v < 6; v++ ){
+
+                        dEedFekl[ v ] = dEedFe[ 9 * v + kl ];
+
+                    }
+
+                    stiffness.apply( dEedFekl, dPK2StressdFekl );
+
+                    for ( unsigned int v = 0; v < 6; v++ ){
+
+                        dPK2StressdFe[ 9 * ( 3 * voigtIndices[ v ][ 0 ] + voigtIndices[ v ][ 1 ] ) + kl ] = dPK2StressdFekl[ v ];
+
+                        dPK2StressdFe[ 9 * ( 3 * voigtIndices[ v ][ 1 ] + voigtIndices[ v ][ 0 ] ) + kl ] = dPK2StressdFekl[ v ];
+
+                    }
+
+                }
+
+            }
+
+        }
+
         /*!
          * A residual class for a linear-elastic material model where the stress is computed
          * in the reference configuration and pushed forward to the current configuration.
@@ -80,6 +271,13 @@ namespace tardigradeHydra{
                 residual( tardigradeHydra::hydraBase* hydra, const unsigned int &numEquations, const floatVector &parameters ) : tardigradeHydra::residualBase( hydra, numEquations ){
     
                     TARDIGRADE_ERROR_TOOLS_CATCH( decomposeParameterVector( parameters ) );
+
+                    // The stress only depends on the Cauchy stress and the configurations
+                    std::vector< unsigned int > unknownBlockDependencies( *hydra->getNumConfigurations( ) );
+
+                    std::iota( unknownBlockDependencies.begin( ), unknownBlockDependencies.end( ), 0 );
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( setUnknownBlockDependencies( unknownBlockDependencies ) );
     
                 }
                 //! Get a pointer to the value of the lambda Lame parameter
@@ -96,10 +294,14 @@ namespace tardigradeHydra{
     
                 const floatMatrix* getdPK2StressdEe( );
 
+                const voigt::isotropicStiffness* getIsotropicdPK2StressdEe( );
+
                 const floatMatrix* getdPK2StressdFe( );
     
                 const floatMatrix* getdCauchyStressdPK2Stress( );
 
+                const floatMatrix* getdCauchyStressdFe( );
+
                 const floatMatrix* getdCauchyStressdF( );
     
                 const floatMatrix* getdCauchyStressdFn( );
@@ -126,10 +328,14 @@ namespace tardigradeHydra{
     
                 void setdPK2StressdEe( const floatMatrix &dPK2StressdEe );
 
+                void setIsotropicdPK2StressdEe( const voigt::isotropicStiffness &stiffness );
+
                 void setdPK2StressdFe( const floatMatrix &dPK2StressdFe );
     
                 void setdCauchyStressdPK2Stress( const floatMatrix &dCauchyStressdPK2Stress );
 
+                void setdCauchyStressdFe( const floatMatrix &dCauchyStressdFe );
+
                 void setdCauchyStressdF( const floatMatrix &dCauchyStressdF );
     
                 void setdCauchyStressdFn( const floatMatrix &dCauchyStressdFn );
@@ -165,10 +371,14 @@ namespace tardigradeHydra{
 
                 tardigradeHydra::dataStorage< floatMatrix > _dPK2StressdEe;
 
+                tardigradeHydra::dataStorage< voigt::isotropicStiffness > _isotropicdPK2StressdEe;
+
                 tardigradeHydra::dataStorage< floatMatrix > _dPK2StressdFe;
 
                 tardigradeHydra::dataStorage< floatMatrix > _dCauchyStressdPK2Stress;
 
+                tardigradeHydra::dataStorage< floatMatrix > _dCauchyStressdFe;
+
                 tardigradeHydra::dataStorage< floatMatrix > _dCauchyStressdF;
 
                 tardigradeHydra::dataStorage< floatMatrix > _dCauchyStressdFn;
@@ -187,6 +397,8 @@ namespace tardigradeHydra{
 
                 virtual void setdCauchyStressdPK2Stress( );
 
+                virtual void setdCauchyStressdFe( );
+
                 virtual void setdCauchyStressdF( );
 
                 virtual void setdCauchyStressdFn( );
@@ -203,6 +415,323 @@ namespace tardigradeHydra{
     
         };
 
+        /*!
+         * Linear elasticity kernels which advance \f$ W \f$ material points in lockstep (see tardigradeHydra::lockstep)
+         */
+        namespace lockstep{
+
+            /*!
+             * Compute the Cauchy stresses from the elastic deformation gradients where the second Piola-Kirchhoff
+             * stress is \f$ \bf{S} = \lambda \text{tr}\left( \bf{E}^e \right) \bf{I} + 2 \mu \bf{E}^e \f$ and the
+             * Cauchy stress is \f$ \bf{\sigma} = \frac{1}{J^e} \bf{F}^e \bf{S} \bf{F}^{eT} \f$
+             *
+             * \param &lambda: The lambda Lame parameter
+             * \param &mu: The mu Lame parameter
+             * \param *Fe: The elastic deformation gradients (9 x W)
+             * \param *cauchyStress: The Cauchy stresses (9 x W)
+             * \param *dCauchyStressdFe: The derivatives of the Cauchy stresses w.r.t. the elastic deformation
+             *     gradients (81 x W). Not computed if NULL.
+             */
+            template< unsigned int W >
+            inline void computeCauchyStress( const floatType &lambda, const floatType &mu, const floatType *Fe,
+                                             floatType *cauchyStress, floatType *dCauchyStressdFe = NULL ){
+
+                floatType PK2Stress[ 9 * W ], FeS[ 9 * W ], B[ 9 * W ], FeInv[ 9 * W ], J[ W ];
+
+                // The right Cauchy-Green and left Cauchy-Green deformation tensors
+                floatType C[ 9 * W ];
+
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    for ( unsigned int j = 0; j < 3; j++ ){
+
+                        for ( unsigned int l = 0; l < W; l++ ){
+
+                            C[ W * ( 3 * i + j ) + l ] = Fe[ W * ( 3 * 0 + i ) + l ] * Fe[ W * ( 3 * 0 + j ) + l ]
+                                                       + Fe[ W * ( 3 * 1 + i ) + l ] * Fe[ W * ( 3 * 1 + j ) + l ]
+                                                       + Fe[ W * ( 3 * 2 + i ) + l ] * Fe[ W * ( 3 * 2 + j ) + l ];
+
+                            B[ W * ( 3 * i + j ) + l ] = Fe[ W * ( 3 * i + 0 ) + l ] * Fe[ W * ( 3 * j + 0 ) + l ]
+                                                       + Fe[ W * ( 3 * i + 1 ) + l ] * Fe[ W * ( 3 * j + 1 ) + l ]
+                                                       + Fe[ W * ( 3 * i + 2 ) + l ] * Fe[ W * ( 3 * j + 2 ) + l ];
+
+                        }
+
+                    }
+
+                }
+
+                for ( unsigned int l = 0; l < W; l++ ){
+
+                    const floatType traceEe = 0.5 * ( C[ W * 0 + l ] + C[ W * 4 + l ] + C[ W * 8 + l ] - 3 );
+
+                    for ( unsigned int i = 0; i < 9; i++ ){
+
+                        PK2Stress[ W * i + l ] = mu * ( C[ W * i + l ] - ( ( i % 4 == 0 ) ? 1 : 0 ) ) + ( ( i % 4 == 0 ) ? lambda * traceEe : 0 );
+
+                    }
+
+                }
+
+                tardigradeHydra::lockstep::invert< W >( Fe, FeInv, J );
+
+                tardigradeHydra::lockstep::multiply< W >( Fe, PK2Stress, FeS );
+
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    for ( unsigned int j = 0; j < 3; j++ ){
+
+                        for ( unsigned int l = 0; l < W; l++ ){
+
+                            cauchyStress[ W * ( 3 * i + j ) + l ] = ( FeS[ W * ( 3 * i + 0 ) + l ] * Fe[ W * ( 3 * j + 0 ) + l ]
+                                                                    + FeS[ W * ( 3 * i + 1 ) + l ] * Fe[ W * ( 3 * j + 1 ) + l ]
+                                                                    + FeS[ W * ( 3 * i + 2 ) + l ] * Fe[ W * ( 3 * j + 2 ) + l ] ) / J[ l ];
+
+                        }
+
+                    }
+
+                }
+
+                if ( !dCauchyStressdFe ){
+
+                    return;
+
+                }
+
+                // d sigma_ij / d Fe_ab = -sigma_ij FeInv_ba
+                //                      + ( delta_ia ( S Fe^T )_bj + ( Fe S )_ib delta_ja + lambda Fe_ab B_ij + mu ( B_ia Fe_jb + Fe_ib B_aj ) ) / J
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    for ( unsigned int j = 0; j < 3; j++ ){
+
+                        for ( unsigned int a = 0; a < 3; a++ ){
+
+                            for ( unsigned int b = 0; b < 3; b++ ){
+
+                                const unsigned int index = W * ( 27 * i + 9 * j + 3 * a + b );
+
+                                for ( unsigned int l = 0; l < W; l++ ){
+
+                                    floatType value = lambda * Fe[ W * ( 3 * a + b ) + l ] * B[ W * ( 3 * i + j ) + l ]
+                                                    + mu * ( B[ W * ( 3 * i + a ) + l ] * Fe[ W * ( 3 * j + b ) + l ] + Fe[ W * ( 3 * i + b ) + l ] * B[ W * ( 3 * a + j ) + l ] );
+
+                                    // ( S Fe^T )_bj = ( Fe S )_jb because S is symmetric
+                                    value += ( i == a ) ? FeS[ W * ( 3 * j + b ) + l ] : 0;
+
+                                    value += ( j == a ) ? FeS[ W * ( 3 * i + b ) + l ] : 0;
+
+                                    dCauchyStressdFe[ index + l ] = value / J[ l ] - cauchyStress[ W * ( 3 * i + j ) + l ] * FeInv[ W * ( 3 * b + a ) + l ];
+
+                                }
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+            }
+
+            /*!
+             * The stress equations of the linear elastic residual (see tardigradeHydra::linearElasticity::residual)
+             * evaluated for \f$ W \f$ material points in lockstep. The residual is
+             * \f$ \bf{R} = \bf{\sigma} - \bf{\sigma}^e\left( \bf{F}^1 \right) \f$ where the first configuration is
+             * decomposed from the deformation gradient and the remaining configurations in the unknown vector.
+             *
+             * The function fills the first nine rows of the residuals and jacobians so that it can be used directly
+             * with tardigradeHydra::lockstep::solve when the model has a single configuration or combined with the
+             * equations of the other configurations.
+             */
+            template< unsigned int W >
+            class residual{
+
+                public:
+
+                    /*!
+                     * Construct the residual
+                     *
+                     * \param &lambda: The lambda Lame parameter
+                     * \param &mu: The mu Lame parameter
+                     * \param &numConfigurations: The number of configurations
+                     * \param &numUnknowns: The number of unknowns
+                     */
+                    residual( const floatType &lambda, const floatType &mu, const unsigned int &numConfigurations, const unsigned int &numUnknowns )
+                        : _lambda( lambda ), _mu( mu ), _numConfigurations( numConfigurations ), _numUnknowns( numUnknowns ),
+                          _configurations( 9 * W * numConfigurations ), _precedingConfigurations( 9 * W * numConfigurations ),
+                          _followingConfigurations( 9 * W * numConfigurations ), _dCauchyStressdFe( 81 * W ), _temp( 27 * W ){
+
+                        if ( ( numConfigurations == 0 ) || ( numUnknowns < 9 * numConfigurations ) ){
+
+                            TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "The number of unknowns must be at least nine times the number of configurations which must be positive" ) );
+
+                        }
+
+                    }
+
+                    /*!
+                     * Set the deformation gradients
+                     *
+                     * \param *deformationGradient: The deformation gradients (9 x W). Must remain valid while the residual is evaluated.
+                     */
+                    void setDeformationGradient( const floatType *deformationGradient ){ _deformationGradient = deformationGradient; }
+
+                    //! Get the configurations of the last evaluation (number of configurations x 9 x W)
+                    const floatVector* getConfigurations( ){ return &_configurations; }
+
+                    void operator()( const floatType *X, floatType *R, floatType *J ){
+                        /*!
+                         * Evaluate the stress equations
+                         *
+                         * \param *X: The unknown vectors (number of unknowns x W)
+                         * \param *R: The residuals (number of unknowns x W). The first nine rows are set.
+                         * \param *J: The row-major jacobians (number of unknowns**2 x W). The first nine rows are set.
+                         */
+
+                        const unsigned int n = _numUnknowns;
+
+                        floatType *FeA = _temp.data( );
+
+                        floatType *G = _temp.data( ) + 9 * W;
+
+                        // The products of the configurations which precede and follow each configuration
+                        tardigradeHydra::lockstep::identity< W >( _precedingConfigurations.data( ) + 9 * W );
+
+                        for ( unsigned int c = 1; c < _numConfigurations; c++ ){
+
+                            std::copy( X + 9 * W * c, X + 9 * W * ( c + 1 ), _configurations.data( ) + 9 * W * c );
+
+                            if ( c + 1 < _numConfigurations ){
+
+                                tardigradeHydra::lockstep::multiply< W >( _precedingConfigurations.data( ) + 9 * W * c, _configurations.data( ) + 9 * W * c,
+                                                                          _precedingConfigurations.data( ) + 9 * W * ( c + 1 ) );
+
+                            }
+
+                        }
+
+                        if ( _numConfigurations > 1 ){
+
+                            // The inverse of the product of the configurations
+                            tardigradeHydra::lockstep::multiply< W >( _precedingConfigurations.data( ) + 9 * W * ( _numConfigurations - 1 ),
+                                                                      _configurations.data( ) + 9 * W * ( _numConfigurations - 1 ), FeA );
+
+                            tardigradeHydra::lockstep::invert< W >( FeA, _followingConfigurations.data( ) + 9 * W * ( _numConfigurations - 1 ), G );
+
+                            for ( unsigned int c = _numConfigurations - 2; c > 0; c-- ){
+
+                                tardigradeHydra::lockstep::multiply< W >( _configurations.data( ) + 9 * W * ( c + 1 ), _followingConfigurations.data( ) + 9 * W * ( c + 1 ),
+                                                                          _followingConfigurations.data( ) + 9 * W * c );
+
+                            }
+
+                            tardigradeHydra::lockstep::multiply< W >( _deformationGradient, _followingConfigurations.data( ) + 9 * W * ( _numConfigurations - 1 ), _configurations.data( ) );
+
+                        }
+                        else{
+
+                            std::copy( _deformationGradient, _deformationGradient + 9 * W, _configurations.data( ) );
+
+                        }
+
+                        computeCauchyStress< W >( _lambda, _mu, _configurations.data( ), R, _dCauchyStressdFe.data( ) );
+
+                        for ( unsigned int i = 0; i < 9; i++ ){
+
+                            for ( unsigned int l = 0; l < W; l++ ){
+
+                                R[ W * i + l ] = X[ W * i + l ] - R[ W * i + l ];
+
+                            }
+
+                            for ( unsigned int j = 0; j < n; j++ ){
+
+                                for ( unsigned int l = 0; l < W; l++ ){
+
+                                    J[ W * ( n * i + j ) + l ] = ( i == j ) ? 1 : 0;
+
+                                }
+
+                            }
+
+                        }
+
+                        // d Fe_pq / d Fc_ab = -( Fe P_c )_pa ( Q_c )_bq where P_c are the preceding and Q_c the following configurations
+                        for ( unsigned int c = 1; c < _numConfigurations; c++ ){
+
+                            tardigradeHydra::lockstep::multiply< W >( _configurations.data( ), _precedingConfigurations.data( ) + 9 * W * c, FeA );
+
+                            const floatType *Q = _followingConfigurations.data( ) + 9 * W * c;
+
+                            for ( unsigned int ij = 0; ij < 9; ij++ ){
+
+                                // G_aq = dsigma_ij / dFe_pq ( Fe P_c )_pa
+                                for ( unsigned int a = 0; a < 3; a++ ){
+
+                                    for ( unsigned int q = 0; q < 3; q++ ){
+
+                                        for ( unsigned int l = 0; l < W; l++ ){
+
+                                            G[ W * ( 3 * a + q ) + l ] = _dCauchyStressdFe[ W * ( 9 * ij + 3 * 0 + q ) + l ] * FeA[ W * ( 3 * 0 + a ) + l ]
+                                                                       + _dCauchyStressdFe[ W * ( 9 * ij + 3 * 1 + q ) + l ] * FeA[ W * ( 3 * 1 + a ) + l ]
+                                                                       + _dCauchyStressdFe[ W * ( 9 * ij + 3 * 2 + q ) + l ] * FeA[ W * ( 3 * 2 + a ) + l ];
+
+                                        }
+
+                                    }
+
+                                }
+
+                                for ( unsigned int a = 0; a < 3; a++ ){
+
+                                    for ( unsigned int b = 0; b < 3; b++ ){
+
+                                        for ( unsigned int l = 0; l < W; l++ ){
+
+                                            J[ W * ( n * ij + 9 * c + 3 * a + b ) + l ] = G[ W * ( 3 * a + 0 ) + l ] * Q[ W * ( 3 * b + 0 ) + l ]
+                                                                                        + G[ W * ( 3 * a + 1 ) + l ] * Q[ W * ( 3 * b + 1 ) + l ]
+                                                                                        + G[ W * ( 3 * a + 2 ) + l ] * Q[ W * ( 3 * b + 2 ) + l ];
+
+                                        }
+
+                                    }
+
+                                }
+
+                            }
+
+                        }
+
+                    }
+
+                private:
+
+                    floatType _lambda; //!< The lambda Lame parameter
+
+                    floatType _mu; //!< The mu Lame parameter
+
+                    unsigned int _numConfigurations; //!< The number of configurations
+
+                    unsigned int _numUnknowns; //!< The number of unknowns
+
+                    const floatType *_deformationGradient = NULL; //!< The deformation gradients
+
+                    floatVector _configurations; //!< The configurations
+
+                    floatVector _precedingConfigurations; //!< The products of the configurations between the first and each configuration
+
+                    floatVector _followingConfigurations; //!< The products of the configurations following each configuration and the inverse of the product of all of the configurations after the first
+
+                    floatVector _dCauchyStressdFe; //!< The derivative of the Cauchy stress w.r.t. the elastic deformation gradient
+
+                    floatVector _temp; //!< Scratch space
+
+            };
+
+        }
+
     }
 
 }
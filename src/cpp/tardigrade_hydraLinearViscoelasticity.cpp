@@ -285,6 +285,8 @@ namespace tardigradeHydra{
 
             _previousJe.first = true;
 
+            addPointData( &_previousJe );
+
         }
 
         void residual::setPreviousFehat( const floatVector &previousFehat ){
@@ -684,6 +686,8 @@ namespace tardigradeHydra{
 
             _previousVolumetricRateMultiplier.first = true;
 
+            addPointData( &_previousVolumetricRateMultiplier );
+
         }
 
         void residual::setIsochoricRateMultiplier( const floatType &isochoricRateMultiplier ){
@@ -712,6 +716,8 @@ namespace tardigradeHydra{
 
             _previousIsochoricRateMultiplier.first = true;
 
+            addPointData( &_previousIsochoricRateMultiplier );
+
         }
 
         void residual::setdVolumetricRateMultiplierdT( const floatType &dVolumetricRateMultiplierdT ){
@@ -745,6 +751,8 @@ namespace tardigradeHydra{
 
             _dPreviousVolumetricRateMultiplierdPreviousT.first = true;
 
+            addPointData( &_dPreviousVolumetricRateMultiplierdPreviousT );
+
         }
 
         void residual::setdIsochoricRateMultiplierdT( const floatType &dRateMultiplierdT ){
@@ -777,6 +785,8 @@ namespace tardigradeHydra{
 
             _dPreviousIsochoricRateMultiplierdPreviousT.first = true;
 
+            addPointData( &_dPreviousIsochoricRateMultiplierdPreviousT );
+
         }
 
         const floatType* residual::getVolumetricRateMultiplier( ){
@@ -151,14 +151,14 @@ namespace tardigradeHydra{
              * \param isPrevious: Flag for whether to compute this in the previous configuration
              */
 
+            const bool computeFDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdF );
+
             const floatVector *cauchyStress;
 
             floatVector precedingConfiguration;
 
             floatVector drivingStress;
 
-            floatMatrix precedingConfigurationGradient;
-
             const floatMatrix *dF1dF;
 
             const floatMatrix *dF1dSubFs;
@@ -167,8 +167,6 @@ namespace tardigradeHydra{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( precedingConfiguration = hydra->getPreviousPrecedingConfiguration( *getPlasticConfigurationIndex( ) ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( precedingConfigurationGradient = hydra->getPreviousPrecedingConfigurationGradient( *getPlasticConfigurationIndex( ) ) );
-
                 TARDIGRADE_ERROR_TOOLS_CATCH( cauchyStress = hydra->getPreviousCauchyStress( ) );
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dF1dF = hydra->getPreviousdF1dF( ) );
@@ -180,8 +178,6 @@ namespace tardigradeHydra{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( precedingConfiguration = hydra->getPrecedingConfiguration( *getPlasticConfigurationIndex( ) ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( precedingConfigurationGradient = hydra->getPrecedingConfigurationGradient( *getPlasticConfigurationIndex( ) ) );
-
                 TARDIGRADE_ERROR_TOOLS_CATCH( cauchyStress = hydra->getCauchyStress( ) );
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dF1dF = hydra->getdF1dF( ) );
@@ -197,19 +193,40 @@ namespace tardigradeHydra{
             tardigradeConstitutiveTools::pullBackCauchyStress( *cauchyStress, precedingConfiguration, drivingStress,
                                                                dDrivingStressdCauchyStress, dDrivingStressdPrecedingF );
 
-            floatMatrix dDrivingStressdFn = tardigradeVectorTools::dot( dDrivingStressdPrecedingF, precedingConfigurationGradient );
+            floatMatrix dDrivingStressdFn;
+
+            if ( isPrevious ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( hydra->getPreviousPrecedingConfigurationGradientFactors( *getPlasticConfigurationIndex( ) ).leftMultiply( dDrivingStressdPrecedingF, dDrivingStressdFn ) );
+
+            }
+            else{
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( hydra->getPrecedingConfigurationGradientFactors( *getPlasticConfigurationIndex( ) ).leftMultiply( dDrivingStressdPrecedingF, dDrivingStressdFn ) );
+
+            }
+
+            floatMatrix dDrivingStressdF;
+
+            if ( computeFDerivatives ){
 
-            floatMatrix dDrivingStressdF( drivingStress.size( ), floatVector( precedingConfiguration.size( ), 0 ) );
+                dDrivingStressdF = floatMatrix( drivingStress.size( ), floatVector( precedingConfiguration.size( ), 0 ) );
+
+            }
 
             floatMatrix dDrivingStressdSubFs( drivingStress.size( ), floatVector( ( *dF1dSubFs )[ 0 ].size( ), 0 ) );
 
             for ( unsigned int i = 0; i < ( *hydra->getDimension( ) ) * ( *hydra->getDimension( ) ); i++ ){
 
-                for ( unsigned int j = 0; j < ( *hydra->getDimension( ) ) * ( *hydra->getDimension( ) ); j++ ){
+                if ( computeFDerivatives ){
 
-                    for ( unsigned int k = 0; k < ( *hydra->getDimension( ) ) * ( *hydra->getDimension( ) ); k++ ){
+                    for ( unsigned int j = 0; j < ( *hydra->getDimension( ) ) * ( *hydra->getDimension( ) ); j++ ){
+
+                        for ( unsigned int k = 0; k < ( *hydra->getDimension( ) ) * ( *hydra->getDimension( ) ); k++ ){
 
-                        dDrivingStressdF[ i ][ j ] += dDrivingStressdFn[ i ][ k ] * ( *dF1dF )[ k ][ j ];
+                            dDrivingStressdF[ i ][ j ] += dDrivingStressdFn[ i ][ k ] * ( *dF1dF )[ k ][ j ];
+
+                        }
 
                     }
 
@@ -246,7 +263,11 @@ namespace tardigradeHydra{
 
                 setdDrivingStressdCauchyStress( dDrivingStressdCauchyStress );
 
-                setdDrivingStressdF( dDrivingStressdF );
+                if ( computeFDerivatives ){
+
+                    setdDrivingStressdF( dDrivingStressdF );
+
+                }
 
                 setdDrivingStressdSubFs( dDrivingStressdSubFs );
 
@@ -364,6 +385,8 @@ namespace tardigradeHydra{
 
             _previousDrivingStress.first = true;
 
+            addPointData( &_previousDrivingStress );
+
         }
 
         void residual::setdPreviousDrivingStressdPreviousCauchyStress( const floatMatrix &dPreviousDrivingStressdPreviousCauchyStress ){
@@ -378,6 +401,8 @@ namespace tardigradeHydra{
 
             _dPreviousDrivingStressdPreviousCauchyStress.first = true;
 
+            addPointData( &_dPreviousDrivingStressdPreviousCauchyStress );
+
         }
 
         void residual::setdPreviousDrivingStressdPreviousF( const floatMatrix &dPreviousDrivingStressdPreviousF ){
@@ -392,6 +417,8 @@ namespace tardigradeHydra{
 
             _dPreviousDrivingStressdPreviousF.first = true;
 
+            addPointData( &_dPreviousDrivingStressdPreviousF );
+
         }
 
         void residual::setdPreviousDrivingStressdPreviousSubFs( const floatMatrix &dPreviousDrivingStressdPreviousSubFs ){
@@ -406,6 +433,8 @@ namespace tardigradeHydra{
 
             _dPreviousDrivingStressdPreviousSubFs.first = true;
 
+            addPointData( &_dPreviousDrivingStressdPreviousSubFs );
+
         }
 
         void residual::setFlowDirection( ){
@@ -661,9 +690,27 @@ namespace tardigradeHydra{
              * 
              * \f$ \sigma_{ij}^{\text{dev}} = \sigma_{ij} - \frac{1}{3} \bar{\sigma} \delta_{ij}\f$
              * 
+             * The derivative of the flow direction w.r.t. the driving stress is only computed along with the value if
+             * hydra requests derivatives of the residual (see tardigradeHydra::derivativeRequest).
+             *
              * \param isPrevious: Flag for whether to compute the values in the previous configuration
              */
 
+            TARDIGRADE_ERROR_TOOLS_CATCH( setFlowDirectionAndPartials( isPrevious, *hydra->getDerivativeRequest( ) != 0 ) );
+
+        }
+
+        void residual::setFlowDirectionAndPartials( const bool isPrevious, const bool computePartials ){
+            /*!
+             * Set the flow direction and, if requested, its derivative w.r.t. the driving stress from a single
+             * evaluation of the Drucker-Prager potential. The derivative is cached so that the derivatives of the flow
+             * direction don't re-evaluate the potential.
+             * 
+             * \param isPrevious: Flag for whether to compute the values in the previous configuration
+             * \param computePartials: Flag for whether to compute the derivative of the flow direction w.r.t. the
+             *     driving stress
+             */
+
             const floatVector *drivingStress;
 
             const floatVector *flowParameters;
@@ -687,21 +734,83 @@ namespace tardigradeHydra{
 
             floatVector flowDirection( drivingStress->size( ), 0 );
 
-            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::druckerPragerSurface( *drivingStress, ( *flowParameters )[ 1 ], ( *flowParameters )[ 0 ], g, dgdDrivingStress, flowDirection ) );
+            if ( !computePartials ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::druckerPragerSurface( *drivingStress, ( *flowParameters )[ 1 ], ( *flowParameters )[ 0 ], g, dgdDrivingStress, flowDirection ) );
+
+                if ( isPrevious ){
+
+                    setPreviousFlowDirection( flowDirection );
+
+                }
+                else{
+
+                    setFlowDirection( flowDirection );
+
+                }
+
+                return;
+
+            }
+
+            floatMatrix dFlowDirectiondDrivingStress;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::druckerPragerSurface( *drivingStress, ( *flowParameters )[ 1 ], ( *flowParameters )[ 0 ], g, dgdDrivingStress, flowDirection, dFlowDirectiondDrivingStress ) );
 
             if ( isPrevious ){
 
                 setPreviousFlowDirection( flowDirection );
 
+                _dPreviousFlowDirectiondPreviousDrivingStress.second = dFlowDirectiondDrivingStress;
+
+                _dPreviousFlowDirectiondPreviousDrivingStress.first = true;
+
+                addPointData( &_dPreviousFlowDirectiondPreviousDrivingStress );
+
             }
             else{
 
                 setFlowDirection( flowDirection );
 
+                _dFlowDirectiondDrivingStress.second = dFlowDirectiondDrivingStress;
+
+                _dFlowDirectiondDrivingStress.first = true;
+
+                addIterationData( &_dFlowDirectiondDrivingStress );
+
             }
 
         }
 
+        const floatMatrix* residual::getdFlowDirectiondDrivingStress( const bool isPrevious ){
+            /*!
+             * Get the derivative of the flow direction w.r.t. the driving stress
+             * 
+             * \param isPrevious: Flag for whether to get the value in the previous configuration
+             */
+
+            if ( isPrevious ){
+
+                if ( !_dPreviousFlowDirectiondPreviousDrivingStress.first ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( setFlowDirectionAndPartials( isPrevious, true ) );
+
+                }
+
+                return &_dPreviousFlowDirectiondPreviousDrivingStress.second;
+
+            }
+
+            if ( !_dFlowDirectiondDrivingStress.first ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( setFlowDirectionAndPartials( isPrevious, true ) );
+
+            }
+
+            return &_dFlowDirectiondDrivingStress.second;
+
+        }
+
         void residual::setFlowDirectionDerivatives( const bool isPrevious ){
             /*!
              * Set the derivatives of the flow direction in the current configuration of the
@@ -721,18 +830,14 @@ namespace tardigradeHydra{
              * \param isPrevious: Flag for whether to compute the values in the previous configuration
              */
 
-            const floatVector *drivingStress;
-
-            const floatVector *flowParameters;
+            const bool computeFDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdF );
 
             const floatMatrix *dDrivingStressdCauchyStress;
 
-            const floatMatrix *dDrivingStressdF;
+            const floatMatrix *dDrivingStressdF = NULL;
 
             const floatMatrix *dDrivingStressdSubFs;
 
-            floatType g;
-
             if ( isPrevious ){
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdCauchyStress = getdPreviousDrivingStressdPreviousCauchyStress( ) );
@@ -741,41 +846,39 @@ namespace tardigradeHydra{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdSubFs = getdPreviousDrivingStressdPreviousSubFs( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( drivingStress = getPreviousDrivingStress( ) );
-
             }
             else{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdCauchyStress = getdDrivingStressdCauchyStress( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdF = getdDrivingStressdF( ) );
+                if ( computeFDerivatives ){
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdSubFs = getdDrivingStressdSubFs( ) );
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdF = getdDrivingStressdF( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( drivingStress = getDrivingStress( ) );
+                }
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdSubFs = getdDrivingStressdSubFs( ) );
 
             }
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( flowParameters = getFlowParameters( ) );
+            const floatMatrix *dFlowDirectiondDrivingStress;
 
-            floatVector dgdDrivingStress( drivingStress->size( ), 0 );
+            TARDIGRADE_ERROR_TOOLS_CATCH( dFlowDirectiondDrivingStress = getdFlowDirectiondDrivingStress( isPrevious ) );
 
-            floatVector flowDirection( drivingStress->size( ), 0 );
+            floatMatrix dFlowDirectiondCauchyStress = tardigradeVectorTools::dot( *dFlowDirectiondDrivingStress, *dDrivingStressdCauchyStress );
 
-            floatMatrix dFlowDirectiondDrivingStress;
+            floatMatrix dFlowDirectiondF;
 
-            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::druckerPragerSurface( *drivingStress, ( *flowParameters )[ 1 ], ( *flowParameters )[ 0 ], g, dgdDrivingStress, flowDirection, dFlowDirectiondDrivingStress ) );
+            if ( computeFDerivatives ){
 
-            floatMatrix dFlowDirectiondCauchyStress = tardigradeVectorTools::dot( dFlowDirectiondDrivingStress, *dDrivingStressdCauchyStress );
+                dFlowDirectiondF = tardigradeVectorTools::dot( *dFlowDirectiondDrivingStress, *dDrivingStressdF );
 
-            floatMatrix dFlowDirectiondF            = tardigradeVectorTools::dot( dFlowDirectiondDrivingStress, *dDrivingStressdF );
+            }
 
-            floatMatrix dFlowDirectiondSubFs        = tardigradeVectorTools::dot( dFlowDirectiondDrivingStress, *dDrivingStressdSubFs );
+            floatMatrix dFlowDirectiondSubFs        = tardigradeVectorTools::dot( *dFlowDirectiondDrivingStress, *dDrivingStressdSubFs );
 
             if ( isPrevious ){
 
-                setPreviousFlowDirection( flowDirection );
-
                 setdPreviousFlowDirectiondPreviousCauchyStress( dFlowDirectiondCauchyStress );
 
                 setdPreviousFlowDirectiondPreviousF( dFlowDirectiondF );
@@ -785,11 +888,13 @@ namespace tardigradeHydra{
             }
             else{
 
-                setFlowDirection( flowDirection );
-
                 setdFlowDirectiondCauchyStress( dFlowDirectiondCauchyStress );
 
-                setdFlowDirectiondF( dFlowDirectiondF );
+                if ( computeFDerivatives ){
+
+                    setdFlowDirectiondF( dFlowDirectiondF );
+
+                }
 
                 setdFlowDirectiondSubFs( dFlowDirectiondSubFs );
 
@@ -878,6 +983,8 @@ namespace tardigradeHydra{
 
             _previousFlowDirection.first = true;
 
+            addPointData( &_previousFlowDirection );
+
         }
 
         void residual::setdPreviousFlowDirectiondPreviousCauchyStress( const floatMatrix &dPreviousFlowDirectiondPreviousCauchyStress ){
@@ -893,6 +1000,8 @@ namespace tardigradeHydra{
 
             _dPreviousFlowDirectiondPreviousCauchyStress.first = true;
 
+            addPointData( &_dPreviousFlowDirectiondPreviousCauchyStress );
+
         }
 
         void residual::setdPreviousFlowDirectiondPreviousF( const floatMatrix &dPreviousFlowDirectiondPreviousF ){
@@ -908,6 +1017,8 @@ namespace tardigradeHydra{
 
             _dPreviousFlowDirectiondPreviousF.first = true;
 
+            addPointData( &_dPreviousFlowDirectiondPreviousF );
+
         }
 
         void residual::setdPreviousFlowDirectiondPreviousSubFs( const floatMatrix &dPreviousFlowDirectiondPreviousSubFs ){
@@ -923,6 +1034,8 @@ namespace tardigradeHydra{
 
             _dPreviousFlowDirectiondPreviousSubFs.first = true;
 
+            addPointData( &_dPreviousFlowDirectiondPreviousSubFs );
+
         }
 
         void residual::setYieldFunction( ){
@@ -1037,6 +1150,19 @@ namespace tardigradeHydra{
              * \param isPrevious: Flag for whether this is the previous timestep
              */
 
+            TARDIGRADE_ERROR_TOOLS_CATCH( setYieldFunctionAndPartials( isPrevious ) );
+
+        }
+
+        void residual::setYieldFunctionAndPartials( const bool isPrevious ){
+            /*!
+             * Set the value of the yield function and its derivative w.r.t. the driving stress from
+             * a single evaluation of the Drucker-Prager surface. The derivative is cached so that the
+             * derivatives of the yield function don't re-evaluate the surface.
+             * 
+             * \param isPrevious: Flag for whether this is the previous timestep
+             */
+
             const floatVector* drivingStress;
 
             const floatVector* yieldParameters;
@@ -1056,21 +1182,64 @@ namespace tardigradeHydra{
 
             TARDIGRADE_ERROR_TOOLS_CATCH( yieldParameters = getYieldParameters( ) );
 
-            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::druckerPragerSurface( *drivingStress, ( *yieldParameters )[ 1 ], ( *yieldParameters )[ 0 ], yieldFunction ) );
+            floatVector dYieldFunctiondDrivingStress( drivingStress->size( ), 0 );
+
+            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::druckerPragerSurface( *drivingStress, ( *yieldParameters )[ 1 ], ( *yieldParameters )[ 0 ], yieldFunction, dYieldFunctiondDrivingStress ) );
 
             if ( isPrevious ){
 
                 setPreviousYieldFunction( yieldFunction );
 
+                _dPreviousYieldFunctiondPreviousDrivingStress.second = dYieldFunctiondDrivingStress;
+
+                _dPreviousYieldFunctiondPreviousDrivingStress.first = true;
+
+                addPointData( &_dPreviousYieldFunctiondPreviousDrivingStress );
+
             }
             else{
 
                 setYieldFunction( yieldFunction );
 
+                _dYieldFunctiondDrivingStress.second = dYieldFunctiondDrivingStress;
+
+                _dYieldFunctiondDrivingStress.first = true;
+
+                addIterationData( &_dYieldFunctiondDrivingStress );
+
             }
 
         }
 
+        const floatVector* residual::getdYieldFunctiondDrivingStress( const bool isPrevious ){
+            /*!
+             * Get the derivative of the yield function w.r.t. the driving stress
+             * 
+             * \param isPrevious: Flag for whether this is the previous timestep
+             */
+
+            if ( isPrevious ){
+
+                if ( !_dPreviousYieldFunctiondPreviousDrivingStress.first ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( setYieldFunctionAndPartials( isPrevious ) );
+
+                }
+
+                return &_dPreviousYieldFunctiondPreviousDrivingStress.second;
+
+            }
+
+            if ( !_dYieldFunctiondDrivingStress.first ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( setYieldFunctionAndPartials( isPrevious ) );
+
+            }
+
+            return &_dYieldFunctiondDrivingStress.second;
+
+        }
+
         void residual::setYieldFunctionDerivatives( const bool isPrevious ){
             /*!
              * Set the value of the yield function derivatives
@@ -1078,18 +1247,14 @@ namespace tardigradeHydra{
              * \param isPrevious: Flag for whether this is the previous timestep
              */
 
-            const floatVector* drivingStress;
+            const bool computeFDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdF );
 
             const floatMatrix* dDrivingStressdCauchyStress;
 
-            const floatMatrix* dDrivingStressdF;
+            const floatMatrix* dDrivingStressdF = NULL;
 
             const floatMatrix* dDrivingStressdSubFs;
 
-            const floatVector* yieldParameters;
-
-            floatType yieldFunction;
-
             if ( isPrevious ){
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdCauchyStress = getdPreviousDrivingStressdPreviousCauchyStress( ) );
@@ -1098,36 +1263,38 @@ namespace tardigradeHydra{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdSubFs = getdPreviousDrivingStressdPreviousSubFs( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( drivingStress = getPreviousDrivingStress( ) );
-
             }
             else{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdCauchyStress = getdDrivingStressdCauchyStress( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdF = getdDrivingStressdF( ) );
+                if ( computeFDerivatives ){
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdSubFs = getdDrivingStressdSubFs( ) );
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdF = getdDrivingStressdF( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( drivingStress = getDrivingStress( ) );
+                }
 
-            }
+                TARDIGRADE_ERROR_TOOLS_CATCH( dDrivingStressdSubFs = getdDrivingStressdSubFs( ) );
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( yieldParameters = getYieldParameters( ) );
+            }
 
-            floatVector dYieldFunctiondDrivingStress( drivingStress->size( ), 0 );
+            const floatVector *dYieldFunctiondDrivingStress;
 
-            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::druckerPragerSurface( *drivingStress, ( *yieldParameters )[ 1 ], ( *yieldParameters )[ 0 ], yieldFunction, dYieldFunctiondDrivingStress ) );
+            TARDIGRADE_ERROR_TOOLS_CATCH( dYieldFunctiondDrivingStress = getdYieldFunctiondDrivingStress( isPrevious ) );
 
-            floatVector dYieldFunctiondCauchyStress = tardigradeVectorTools::Tdot( *dDrivingStressdCauchyStress, dYieldFunctiondDrivingStress );
+            floatVector dYieldFunctiondCauchyStress = tardigradeVectorTools::Tdot( *dDrivingStressdCauchyStress, *dYieldFunctiondDrivingStress );
  
-            floatVector dYieldFunctiondF = tardigradeVectorTools::Tdot( *dDrivingStressdF, dYieldFunctiondDrivingStress );
+            floatVector dYieldFunctiondF;
 
-            floatVector dYieldFunctiondSubFs = tardigradeVectorTools::Tdot( *dDrivingStressdSubFs, dYieldFunctiondDrivingStress );
+            if ( computeFDerivatives ){
 
-            if ( isPrevious ){
+                dYieldFunctiondF = tardigradeVectorTools::Tdot( *dDrivingStressdF, *dYieldFunctiondDrivingStress );
 
-                setPreviousYieldFunction( yieldFunction );
+            }
+
+            floatVector dYieldFunctiondSubFs = tardigradeVectorTools::Tdot( *dDrivingStressdSubFs, *dYieldFunctiondDrivingStress );
+
+            if ( isPrevious ){
 
                 setdPreviousYieldFunctiondPreviousCauchyStress( dYieldFunctiondCauchyStress );
 
@@ -1138,11 +1305,13 @@ namespace tardigradeHydra{
             }
             else{
 
-                setYieldFunction( yieldFunction );
-
                 setdYieldFunctiondCauchyStress( dYieldFunctiondCauchyStress );
 
-                setdYieldFunctiondF( dYieldFunctiondF );
+                if ( computeFDerivatives ){
+
+                    setdYieldFunctiondF( dYieldFunctiondF );
+
+                }
 
                 setdYieldFunctiondSubFs( dYieldFunctiondSubFs );
 
@@ -1212,6 +1381,8 @@ namespace tardigradeHydra{
 
             _previousYieldFunction.first = true;
 
+            addPointData( &_previousYieldFunction );
+
         }
 
         void residual::setdPreviousYieldFunctiondPreviousCauchyStress( const floatVector &dPreviousYieldFunctiondPreviousCauchyStress ){
@@ -1223,6 +1394,8 @@ namespace tardigradeHydra{
 
             _dPreviousYieldFunctiondPreviousCauchyStress.first = true;
 
+            addPointData( &_dPreviousYieldFunctiondPreviousCauchyStress );
+
         }
 
         void residual::setdPreviousYieldFunctiondPreviousF( const floatVector &dPreviousYieldFunctiondPreviousF ){
@@ -1234,6 +1407,8 @@ namespace tardigradeHydra{
 
             _dPreviousYieldFunctiondPreviousF.first = true;
 
+            addPointData( &_dPreviousYieldFunctiondPreviousF );
+
         }
 
         void residual::setdPreviousYieldFunctiondPreviousSubFs( const floatVector &dPreviousYieldFunctiondPreviousSubFs ){
@@ -1245,6 +1420,8 @@ namespace tardigradeHydra{
 
             _dPreviousYieldFunctiondPreviousSubFs.first = true;
 
+            addPointData( &_dPreviousYieldFunctiondPreviousSubFs );
+
         }
 
         void residual::setPlasticThermalMultiplier( ){
@@ -1424,6 +1601,8 @@ namespace tardigradeHydra{
 
             _previousPlasticThermalMultiplier.first = true;
 
+            addPointData( &_previousPlasticThermalMultiplier );
+
         }
 
         void residual::setdPreviousPlasticThermalMultiplierdPreviousT( const floatType &dPreviousPlasticThermalMultiplierdPreviousT ){
@@ -1437,6 +1616,8 @@ namespace tardigradeHydra{
 
             _dPreviousPlasticThermalMultiplierdPreviousT.first = true;
 
+            addPointData( &_dPreviousPlasticThermalMultiplierdPreviousT );
+
         }
 
         void residual::setDragStress( ){
@@ -1617,6 +1798,8 @@ namespace tardigradeHydra{
 
             _previousDragStress.first = true;
 
+            addPointData( &_previousDragStress );
+
         }
 
         void residual::setdPreviousDragStressdPreviousStateVariables( const floatVector &dPreviousDragStressdPreviousStateVariables ){
@@ -1630,6 +1813,8 @@ namespace tardigradeHydra{
 
             _dPreviousDragStressdPreviousStateVariables.first = true;
 
+            addPointData( &_dPreviousDragStressdPreviousStateVariables );
+
         }
 
         void residual::setHardeningFunction( ){
@@ -1810,6 +1995,8 @@ namespace tardigradeHydra{
 
             _previousHardeningFunction.first = true;
 
+            addPointData( &_previousHardeningFunction );
+
         }
 
         void residual::setdPreviousHardeningFunctiondPreviousStateVariables( const floatVector &dPreviousHardeningFunctiondPreviousStateVariables ){
@@ -1823,6 +2010,8 @@ namespace tardigradeHydra{
 
             _dPreviousHardeningFunctiondPreviousStateVariables.first = true;
 
+            addPointData( &_dPreviousHardeningFunctiondPreviousStateVariables );
+
         }
 
         void residual::setPlasticMultiplier( ){
@@ -2014,6 +2203,21 @@ namespace tardigradeHydra{
              *     in the previous timestep
              */
 
+            TARDIGRADE_ERROR_TOOLS_CATCH( setPlasticMultiplierAndPartials( isPrevious ) );
+
+        }
+
+        void residual::setPlasticMultiplierAndPartials( const bool isPrevious ){
+            /*!
+             * Set the plastic multiplier and its derivatives w.r.t. the yield function, the drag stress,
+             * and the plastic thermal multiplier from a single evaluation of the Peryzna model. The
+             * derivatives are cached so that the derivatives of the plastic multiplier don't re-evaluate
+             * the model.
+             * 
+             * \param &isPrevious: Flag for whether to compute the plastic multiplier
+             *     in the previous timestep
+             */
+
             const floatType *yieldFunction;
 
             const floatType *dragStress;
@@ -2045,21 +2249,65 @@ namespace tardigradeHydra{
 
             TARDIGRADE_ERROR_TOOLS_CATCH( peryznaParameters = getPeryznaParameters( ) );
 
-            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::peryznaModel( *yieldFunction, *dragStress, *plasticThermalMultiplier, ( *peryznaParameters )[ 0 ], plasticMultiplier ) );
+            floatVector plasticMultiplierPartials( 3, 0 );
+
+            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::peryznaModel( *yieldFunction, *dragStress, *plasticThermalMultiplier, ( *peryznaParameters )[ 0 ], plasticMultiplier, plasticMultiplierPartials[ 0 ], plasticMultiplierPartials[ 1 ], plasticMultiplierPartials[ 2 ] ) );
 
             if ( isPrevious ){
 
                 setPreviousPlasticMultiplier( plasticMultiplier );
 
+                _previousPlasticMultiplierPartials.second = plasticMultiplierPartials;
+
+                _previousPlasticMultiplierPartials.first = true;
+
+                addPointData( &_previousPlasticMultiplierPartials );
+
             }
             else{
 
                 setPlasticMultiplier( plasticMultiplier );
 
+                _plasticMultiplierPartials.second = plasticMultiplierPartials;
+
+                _plasticMultiplierPartials.first = true;
+
+                addIterationData( &_plasticMultiplierPartials );
+
             }
 
         }
 
+        const floatVector* residual::getPlasticMultiplierPartials( const bool isPrevious ){
+            /*!
+             * Get the derivatives of the plastic multiplier w.r.t. the yield function, the drag stress,
+             * and the plastic thermal multiplier (in that order)
+             * 
+             * \param &isPrevious: Flag for whether to get the values in the previous timestep
+             */
+
+            if ( isPrevious ){
+
+                if ( !_previousPlasticMultiplierPartials.first ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( setPlasticMultiplierAndPartials( isPrevious ) );
+
+                }
+
+                return &_previousPlasticMultiplierPartials.second;
+
+            }
+
+            if ( !_plasticMultiplierPartials.first ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( setPlasticMultiplierAndPartials( isPrevious ) );
+
+            }
+
+            return &_plasticMultiplierPartials.second;
+
+        }
+
         void residual::setPlasticMultiplierDerivatives( const bool isPrevious ){
             /*!
              * Set the derivatives of the plastic multiplier in the current configuration of the
@@ -2069,25 +2317,19 @@ namespace tardigradeHydra{
              *     in the previous timestep
              */
 
-            const floatType *yieldFunction;
-
-            const floatType *dragStress;
-
-            const floatType *plasticThermalMultiplier;
-
-            const floatVector *peryznaParameters;
+            const bool computeFDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdF );
 
-            floatType plasticMultiplier;
+            const bool computeTDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdT );
 
             const floatVector *dYieldFunctiondCauchyStress;
 
-            const floatVector *dYieldFunctiondF;
+            const floatVector *dYieldFunctiondF = NULL;
 
             const floatVector *dYieldFunctiondSubFs;
 
             const floatVector *dDragStressdStateVariables;
 
-            const floatType   *dPlasticThermalMultiplierdT;
+            const floatType   *dPlasticThermalMultiplierdT = NULL;
 
             if ( isPrevious ){
 
@@ -2101,57 +2343,63 @@ namespace tardigradeHydra{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticThermalMultiplierdT = getdPreviousPlasticThermalMultiplierdPreviousT( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( yieldFunction = getPreviousYieldFunction( ) );
-
-                TARDIGRADE_ERROR_TOOLS_CATCH( dragStress = getPreviousDragStress( ) );
-
-                TARDIGRADE_ERROR_TOOLS_CATCH( plasticThermalMultiplier = getPreviousPlasticThermalMultiplier( ) );
-
             }
             else{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dYieldFunctiondCauchyStress = getdYieldFunctiondCauchyStress( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dYieldFunctiondF = getdYieldFunctiondF( ) );
+                if ( computeFDerivatives ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dYieldFunctiondF = getdYieldFunctiondF( ) );
+
+                }
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dYieldFunctiondSubFs = getdYieldFunctiondSubFs( ) );
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dDragStressdStateVariables = getdDragStressdStateVariables( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticThermalMultiplierdT = getdPlasticThermalMultiplierdT( ) );
+                if ( computeTDerivatives ){
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( yieldFunction = getYieldFunction( ) );
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticThermalMultiplierdT = getdPlasticThermalMultiplierdT( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dragStress = getDragStress( ) );
-
-                TARDIGRADE_ERROR_TOOLS_CATCH( plasticThermalMultiplier = getPlasticThermalMultiplier( ) );
+                }
 
             }
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( peryznaParameters = getPeryznaParameters( ) );
+            const floatVector *plasticMultiplierPartials;
 
-            floatType dPlasticMultiplierdYieldFunction;
+            TARDIGRADE_ERROR_TOOLS_CATCH( plasticMultiplierPartials = getPlasticMultiplierPartials( isPrevious ) );
 
-            floatType dPlasticMultiplierdDragStress;
+            const floatType dPlasticMultiplierdYieldFunction = ( *plasticMultiplierPartials )[ 0 ];
 
-            floatType dPlasticMultiplierdPlasticThermalMultiplier;
+            const floatType dPlasticMultiplierdDragStress = ( *plasticMultiplierPartials )[ 1 ];
 
-            TARDIGRADE_ERROR_TOOLS_CATCH_NODE_POINTER( tardigradeStressTools::peryznaModel( *yieldFunction, *dragStress, *plasticThermalMultiplier, ( *peryznaParameters )[ 0 ], plasticMultiplier, dPlasticMultiplierdYieldFunction, dPlasticMultiplierdDragStress, dPlasticMultiplierdPlasticThermalMultiplier ) );
+            const floatType dPlasticMultiplierdPlasticThermalMultiplier = ( *plasticMultiplierPartials )[ 2 ];
 
             floatVector dPlasticMultiplierdCauchyStress = dPlasticMultiplierdYieldFunction * ( *dYieldFunctiondCauchyStress );
 
-            floatVector dPlasticMultiplierdF = dPlasticMultiplierdYieldFunction * ( *dYieldFunctiondF );
+            floatVector dPlasticMultiplierdF;
+
+            if ( computeFDerivatives ){
+
+                dPlasticMultiplierdF = dPlasticMultiplierdYieldFunction * ( *dYieldFunctiondF );
+
+            }
 
             floatVector dPlasticMultiplierdSubFs = dPlasticMultiplierdYieldFunction * ( *dYieldFunctiondSubFs );
 
-            floatType   dPlasticMultiplierdT = dPlasticMultiplierdPlasticThermalMultiplier * ( *dPlasticThermalMultiplierdT );
+            floatType   dPlasticMultiplierdT = 0;
+
+            if ( computeTDerivatives ){
+
+                dPlasticMultiplierdT = dPlasticMultiplierdPlasticThermalMultiplier * ( *dPlasticThermalMultiplierdT );
+
+            }
 
             floatVector dPlasticMultiplierdStateVariables = dPlasticMultiplierdDragStress * ( *dDragStressdStateVariables );
 
             if ( isPrevious ){
 
-                setPreviousPlasticMultiplier( plasticMultiplier );
-
                 setdPreviousPlasticMultiplierdPreviousCauchyStress( dPlasticMultiplierdCauchyStress );
 
                 setdPreviousPlasticMultiplierdPreviousF( dPlasticMultiplierdF );
@@ -2165,15 +2413,21 @@ namespace tardigradeHydra{
             }
             else{
 
-                setPlasticMultiplier( plasticMultiplier );
-
                 setdPlasticMultiplierdCauchyStress( dPlasticMultiplierdCauchyStress );
 
-                setdPlasticMultiplierdF( dPlasticMultiplierdF );
+                if ( computeFDerivatives ){
+
+                    setdPlasticMultiplierdF( dPlasticMultiplierdF );
+
+                }
 
                 setdPlasticMultiplierdSubFs( dPlasticMultiplierdSubFs );
 
-                setdPlasticMultiplierdT( dPlasticMultiplierdT );
+                if ( computeTDerivatives ){
+
+                    setdPlasticMultiplierdT( dPlasticMultiplierdT );
+
+                }
 
                 setdPlasticMultiplierdStateVariables( dPlasticMultiplierdStateVariables );
 
@@ -2297,6 +2551,8 @@ namespace tardigradeHydra{
 
             _previousPlasticMultiplier.first = true;
 
+            addPointData( &_previousPlasticMultiplier );
+
         }
 
         void residual::setdPreviousPlasticMultiplierdPreviousCauchyStress( const floatVector &dPreviousPlasticMultiplierdPreviousCauchyStress ){
@@ -2312,6 +2568,8 @@ namespace tardigradeHydra{
 
             _dPreviousPlasticMultiplierdPreviousCauchyStress.first = true;
 
+            addPointData( &_dPreviousPlasticMultiplierdPreviousCauchyStress );
+
         }
 
         void residual::setdPreviousPlasticMultiplierdPreviousF( const floatVector &dPreviousPlasticMultiplierdPreviousF ){
@@ -2327,6 +2585,8 @@ namespace tardigradeHydra{
 
             _dPreviousPlasticMultiplierdPreviousF.first = true;
 
+            addPointData( &_dPreviousPlasticMultiplierdPreviousF );
+
         }
 
         void residual::setdPreviousPlasticMultiplierdPreviousSubFs( const floatVector &dPreviousPlasticMultiplierdPreviousSubFs ){
@@ -2342,6 +2602,8 @@ namespace tardigradeHydra{
 
             _dPreviousPlasticMultiplierdPreviousSubFs.first = true;
 
+            addPointData( &_dPreviousPlasticMultiplierdPreviousSubFs );
+
         }
 
         void residual::setdPreviousPlasticMultiplierdPreviousT( const floatType &dPreviousPlasticMultiplierdPreviousT ){
@@ -2357,6 +2619,8 @@ namespace tardigradeHydra{
 
             _dPreviousPlasticMultiplierdPreviousT.first = true;
 
+            addPointData( &_dPreviousPlasticMultiplierdPreviousT );
+
         }
 
         void residual::setdPreviousPlasticMultiplierdPreviousStateVariables( const floatVector &dPreviousPlasticMultiplierdPreviousStateVariables ){
@@ -2372,6 +2636,8 @@ namespace tardigradeHydra{
 
             _dPreviousPlasticMultiplierdPreviousStateVariables.first = true;
 
+            addPointData( &_dPreviousPlasticMultiplierdPreviousStateVariables );
+
         }
 
         void residual::setVelocityGradient( ){
@@ -2497,9 +2763,24 @@ namespace tardigradeHydra{
         void residual::setPreviousVelocityGradient( ){
             /*!
              * Set the velocity gradient in the current configuration of the plastic
-             * configuration
+             * configuration. If the converged values of the previous increment were
+             * persisted in the additional state variables they are used directly.
              */
 
+            floatVector previousVelocityGradient, previousStateVariableEvolutionRates;
+
+            bool isPersisted;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( isPersisted = readPersistedRates( previousVelocityGradient, previousStateVariableEvolutionRates ) );
+
+            if ( isPersisted ){
+
+                setPreviousVelocityGradient( previousVelocityGradient );
+
+                return;
+
+            }
+
             setVelocityGradient( true );
 
         }
@@ -2597,15 +2878,19 @@ namespace tardigradeHydra{
              *     timestep.
              */
 
+            const bool computeFDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdF );
+
+            const bool computeTDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdT );
+
             const floatType *plasticMultiplier;
 
             const floatVector *dPlasticMultiplierdCauchyStress;
 
-            const floatVector *dPlasticMultiplierdF;
+            const floatVector *dPlasticMultiplierdF = NULL;
 
             const floatVector *dPlasticMultiplierdSubFs;
 
-            const floatType   *dPlasticMultiplierdT;
+            const floatType   *dPlasticMultiplierdT = NULL;
 
             const floatVector *dPlasticMultiplierdStateVariables;
 
@@ -2613,7 +2898,7 @@ namespace tardigradeHydra{
 
             const floatMatrix *dFlowDirectiondCauchyStress;
 
-            const floatMatrix *dFlowDirectiondF;
+            const floatMatrix *dFlowDirectiondF = NULL;
 
             const floatMatrix *dFlowDirectiondSubFs;
 
@@ -2639,7 +2924,16 @@ namespace tardigradeHydra{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( flowDirection = getPreviousFlowDirection( ) );
 
-                setPreviousVelocityGradient( ( *plasticMultiplier ) * ( *flowDirection ) );
+                bool isPersisted;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( isPersisted = hasPersistedRates( ) );
+
+                // Don't replace the persisted value of the previous increment with the re-computed one
+                if ( !isPersisted ){
+
+                    setPreviousVelocityGradient( ( *plasticMultiplier ) * ( *flowDirection ) );
+
+                }
 
                 setdPreviousVelocityGradientdPreviousCauchyStress( tardigradeVectorTools::dyadic( *flowDirection, *dPlasticMultiplierdCauchyStress ) + ( *plasticMultiplier ) * ( *dFlowDirectiondCauchyStress ) );
 
@@ -2656,18 +2950,26 @@ namespace tardigradeHydra{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdCauchyStress   = getdPlasticMultiplierdCauchyStress( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdF              = getdPlasticMultiplierdF( ) );
+                if ( computeFDerivatives ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdF          = getdPlasticMultiplierdF( ) );
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dFlowDirectiondF              = getdFlowDirectiondF( ) );
+
+                }
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdSubFs          = getdPlasticMultiplierdSubFs( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdT              = getdPlasticMultiplierdT( ) );
+                if ( computeTDerivatives ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdT          = getdPlasticMultiplierdT( ) );
+
+                }
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdStateVariables = getdPlasticMultiplierdStateVariables( ) );
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dFlowDirectiondCauchyStress       = getdFlowDirectiondCauchyStress( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dFlowDirectiondF                  = getdFlowDirectiondF( ) );
-
                 TARDIGRADE_ERROR_TOOLS_CATCH( dFlowDirectiondSubFs              = getdFlowDirectiondSubFs( ) );
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( plasticMultiplier = getPlasticMultiplier( ) );
@@ -2678,11 +2980,19 @@ namespace tardigradeHydra{
 
                 setdVelocityGradientdCauchyStress( tardigradeVectorTools::dyadic( *flowDirection, *dPlasticMultiplierdCauchyStress ) + ( *plasticMultiplier ) * ( *dFlowDirectiondCauchyStress ) );
 
-                setdVelocityGradientdF( tardigradeVectorTools::dyadic( *flowDirection, *dPlasticMultiplierdF ) + ( *plasticMultiplier ) * ( *dFlowDirectiondF ) );
+                if ( computeFDerivatives ){
+
+                    setdVelocityGradientdF( tardigradeVectorTools::dyadic( *flowDirection, *dPlasticMultiplierdF ) + ( *plasticMultiplier ) * ( *dFlowDirectiondF ) );
+
+                }
 
                 setdVelocityGradientdSubFs( tardigradeVectorTools::dyadic( *flowDirection, *dPlasticMultiplierdSubFs ) + ( *plasticMultiplier ) * ( *dFlowDirectiondSubFs ) );
 
-                setdVelocityGradientdT( ( *flowDirection ) * ( *dPlasticMultiplierdT ) );
+                if ( computeTDerivatives ){
+
+                    setdVelocityGradientdT( ( *flowDirection ) * ( *dPlasticMultiplierdT ) );
+
+                }
 
                 setdVelocityGradientdStateVariables( tardigradeVectorTools::dyadic( *flowDirection, *dPlasticMultiplierdStateVariables ) );
 
@@ -2805,6 +3115,8 @@ namespace tardigradeHydra{
 
             _previousVelocityGradient.first = true;
 
+            addPointData( &_previousVelocityGradient );
+
         }
 
         void residual::setdPreviousVelocityGradientdPreviousCauchyStress( const floatMatrix &dPreviousVelocityGradientdPreviousCauchyStress ){
@@ -2820,6 +3132,8 @@ namespace tardigradeHydra{
 
             _dPreviousVelocityGradientdPreviousCauchyStress.first = true;
 
+            addPointData( &_dPreviousVelocityGradientdPreviousCauchyStress );
+
         }
 
         void residual::setdPreviousVelocityGradientdPreviousF( const floatMatrix &dPreviousVelocityGradientdPreviousF ){
@@ -2835,6 +3149,8 @@ namespace tardigradeHydra{
 
             _dPreviousVelocityGradientdPreviousF.first = true;
 
+            addPointData( &_dPreviousVelocityGradientdPreviousF );
+
         }
 
         void residual::setdPreviousVelocityGradientdPreviousSubFs( const floatMatrix &dPreviousVelocityGradientdPreviousSubFs ){
@@ -2850,6 +3166,8 @@ namespace tardigradeHydra{
 
             _dPreviousVelocityGradientdPreviousSubFs.first = true;
 
+            addPointData( &_dPreviousVelocityGradientdPreviousSubFs );
+
         }
 
         void residual::setdPreviousVelocityGradientdPreviousT( const floatVector &dPreviousVelocityGradientdPreviousT ){
@@ -2865,6 +3183,8 @@ namespace tardigradeHydra{
 
             _dPreviousVelocityGradientdPreviousT.first = true;
 
+            addPointData( &_dPreviousVelocityGradientdPreviousT );
+
         }
 
         void residual::setdPreviousVelocityGradientdPreviousStateVariables( const floatMatrix &dPreviousVelocityGradientdPreviousStateVariables ){
@@ -2880,6 +3200,8 @@ namespace tardigradeHydra{
 
             _dPreviousVelocityGradientdPreviousStateVariables.first = true;
 
+            addPointData( &_dPreviousVelocityGradientdPreviousStateVariables );
+
         }
 
         void residual::setStateVariableEvolutionRates( ){
@@ -2993,9 +3315,25 @@ namespace tardigradeHydra{
 
         void residual::setPreviousStateVariableEvolutionRates( ){
             /*! 
-             * Set the value of the state variable evolution rates
+             * Set the value of the state variable evolution rates. If the converged values
+             * of the previous increment were persisted in the additional state variables
+             * they are used directly.
              */
 
+            floatVector previousVelocityGradient, previousStateVariableEvolutionRates;
+
+            bool isPersisted;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( isPersisted = readPersistedRates( previousVelocityGradient, previousStateVariableEvolutionRates ) );
+
+            if ( isPersisted ){
+
+                setPreviousStateVariableEvolutionRates( previousStateVariableEvolutionRates );
+
+                return;
+
+            }
+
             setStateVariableEvolutionRates( true );
 
         }
@@ -3095,17 +3433,21 @@ namespace tardigradeHydra{
              *     should be computed.
              */
 
+            const bool computeFDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdF );
+
+            const bool computeTDerivatives = isPrevious || hydra->isDerivativeRequested( derivativeRequest::dRdT );
+
             const floatType *plasticMultiplier;
 
             const floatType *hardeningFunction;
 
             const floatVector *dPlasticMultiplierdCauchyStress;
 
-            const floatVector *dPlasticMultiplierdF;
+            const floatVector *dPlasticMultiplierdF = NULL;
 
             const floatVector *dPlasticMultiplierdSubFs;
 
-            const floatType   *dPlasticMultiplierdT;
+            const floatType   *dPlasticMultiplierdT = NULL;
 
             const floatVector *dPlasticMultiplierdStateVariables;
 
@@ -3134,11 +3476,19 @@ namespace tardigradeHydra{
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdCauchyStress = getdPlasticMultiplierdCauchyStress( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdF = getdPlasticMultiplierdF( ) );
+                if ( computeFDerivatives ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdF = getdPlasticMultiplierdF( ) );
+
+                }
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdSubFs = getdPlasticMultiplierdSubFs( ) );
 
-                TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdT = getdPlasticMultiplierdT( ) );
+                if ( computeTDerivatives ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdT = getdPlasticMultiplierdT( ) );
+
+                }
 
                 TARDIGRADE_ERROR_TOOLS_CATCH( dPlasticMultiplierdStateVariables = getdPlasticMultiplierdStateVariables( ) );
 
@@ -3154,17 +3504,38 @@ namespace tardigradeHydra{
 
             floatMatrix dStateVariableEvolutionRatesdCauchyStress = { ( *dPlasticMultiplierdCauchyStress ) * ( *hardeningFunction ) };
 
-            floatMatrix dStateVariableEvolutionRatesdF = { ( *dPlasticMultiplierdF ) * ( *hardeningFunction ) };
+            floatMatrix dStateVariableEvolutionRatesdF;
+
+            if ( computeFDerivatives ){
+
+                dStateVariableEvolutionRatesdF = { ( *dPlasticMultiplierdF ) * ( *hardeningFunction ) };
+
+            }
 
             floatMatrix dStateVariableEvolutionRatesdSubFs = { ( *dPlasticMultiplierdSubFs ) * ( *hardeningFunction ) };
 
-            floatVector dStateVariableEvolutionRatesdT = { ( *dPlasticMultiplierdT ) * ( *hardeningFunction ) };
+            floatVector dStateVariableEvolutionRatesdT;
+
+            if ( computeTDerivatives ){
+
+                dStateVariableEvolutionRatesdT = { ( *dPlasticMultiplierdT ) * ( *hardeningFunction ) };
+
+            }
 
             floatMatrix dStateVariableEvolutionRatesdStateVariables = { ( *dPlasticMultiplierdStateVariables ) * ( *hardeningFunction ) + ( *plasticMultiplier ) * ( *dHardeningFunctiondStateVariables ) };
 
             if ( isPrevious ){
 
-                setPreviousStateVariableEvolutionRates( stateVariableEvolutionRates );
+                bool isPersisted;
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( isPersisted = hasPersistedRates( ) );
+
+                // Don't replace the persisted value of the previous increment with the re-computed one
+                if ( !isPersisted ){
+
+                    setPreviousStateVariableEvolutionRates( stateVariableEvolutionRates );
+
+                }
 
                 setdPreviousStateVariableEvolutionRatesdPreviousCauchyStress( dStateVariableEvolutionRatesdCauchyStress );
 
@@ -3183,11 +3554,19 @@ namespace tardigradeHydra{
 
                 setdStateVariableEvolutionRatesdCauchyStress( dStateVariableEvolutionRatesdCauchyStress );
 
-                setdStateVariableEvolutionRatesdF( dStateVariableEvolutionRatesdF );
+                if ( computeFDerivatives ){
+
+                    setdStateVariableEvolutionRatesdF( dStateVariableEvolutionRatesdF );
+
+                }
 
                 setdStateVariableEvolutionRatesdSubFs( dStateVariableEvolutionRatesdSubFs );
 
-                setdStateVariableEvolutionRatesdT( dStateVariableEvolutionRatesdT );
+                if ( computeTDerivatives ){
+
+                    setdStateVariableEvolutionRatesdT( dStateVariableEvolutionRatesdT );
+
+                }
 
                 setdStateVariableEvolutionRatesdStateVariables( dStateVariableEvolutionRatesdStateVariables );
 
@@ -3296,6 +3675,8 @@ namespace tardigradeHydra{
 
             _previousStateVariableEvolutionRates.first = true;
 
+            addPointData( &_previousStateVariableEvolutionRates );
+
         }
 
         void residual::setdPreviousStateVariableEvolutionRatesdPreviousCauchyStress( const floatMatrix &dPreviousStateVariableEvolutionRatesdPreviousCauchyStress ){
@@ -3309,6 +3690,8 @@ namespace tardigradeHydra{
 
             _dPreviousStateVariableEvolutionRatesdPreviousCauchyStress.first = true;
 
+            addPointData( &_dPreviousStateVariableEvolutionRatesdPreviousCauchyStress );
+
         }
 
         void residual::setdPreviousStateVariableEvolutionRatesdPreviousF( const floatMatrix &dPreviousStateVariableEvolutionRatesdPreviousF ){
@@ -3322,6 +3705,8 @@ namespace tardigradeHydra{
 
             _dPreviousStateVariableEvolutionRatesdPreviousF.first = true;
 
+            addPointData( &_dPreviousStateVariableEvolutionRatesdPreviousF );
+
         }
 
         void residual::setdPreviousStateVariableEvolutionRatesdPreviousSubFs( const floatMatrix &dPreviousStateVariableEvolutionRatesdPreviousSubFs ){
@@ -3335,6 +3720,8 @@ namespace tardigradeHydra{
 
             _dPreviousStateVariableEvolutionRatesdPreviousSubFs.first = true;
 
+            addPointData( &_dPreviousStateVariableEvolutionRatesdPreviousSubFs );
+
         }
 
         void residual::setdPreviousStateVariableEvolutionRatesdPreviousT( const floatVector &dPreviousStateVariableEvolutionRatesdPreviousT ){
@@ -3348,6 +3735,8 @@ namespace tardigradeHydra{
 
             _dPreviousStateVariableEvolutionRatesdPreviousT.first = true;
 
+            addPointData( &_dPreviousStateVariableEvolutionRatesdPreviousT );
+
         }
 
         void residual::setdPreviousStateVariableEvolutionRatesdPreviousStateVariables( const floatMatrix &dPreviousStateVariableEvolutionRatesdPreviousStateVariables ){
@@ -3361,6 +3750,8 @@ namespace tardigradeHydra{
 
             _dPreviousStateVariableEvolutionRatesdPreviousStateVariables.first = true;
 
+            addPointData( &_dPreviousStateVariableEvolutionRatesdPreviousStateVariables );
+
         }
 
         void residual::setPlasticDeformationGradient( ){
@@ -3487,6 +3878,10 @@ namespace tardigradeHydra{
              * \param setPreviousDerivatives: Flag for if the previous derivatives should be set
              */
 
+            const bool computeFDerivatives = hydra->isDerivativeRequested( derivativeRequest::dRdF );
+
+            const bool computeTDerivatives = hydra->isDerivativeRequested( derivativeRequest::dRdT );
+
             const floatVector *velocityGradient;
 
             const floatVector *previousVelocityGradient;
@@ -3547,11 +3942,19 @@ namespace tardigradeHydra{
 
             setdPlasticDeformationGradientdCauchyStress( tardigradeVectorTools::dot( dFdL, *getdVelocityGradientdCauchyStress( ) ) );
 
-            setdPlasticDeformationGradientdF( tardigradeVectorTools::dot( dFdL, *getdVelocityGradientdF( ) ) );
+            if ( computeFDerivatives ){
+
+                setdPlasticDeformationGradientdF( tardigradeVectorTools::dot( dFdL, *getdVelocityGradientdF( ) ) );
+
+            }
 
             setdPlasticDeformationGradientdSubFs( tardigradeVectorTools::dot( dFdL, *getdVelocityGradientdSubFs( ) ) );
 
-            setdPlasticDeformationGradientdT( tardigradeVectorTools::dot( dFdL, *getdVelocityGradientdT( ) ) );
+            if ( computeTDerivatives ){
+
+                setdPlasticDeformationGradientdT( tardigradeVectorTools::dot( dFdL, *getdVelocityGradientdT( ) ) );
+
+            }
 
             setdPlasticDeformationGradientdStateVariables( tardigradeVectorTools::dot( dFdL, *getdVelocityGradientdStateVariables( ) ) );
 
@@ -3844,6 +4247,10 @@ namespace tardigradeHydra{
              * Set the plastic state variables
              */
 
+            const bool computeFDerivatives = hydra->isDerivativeRequested( derivativeRequest::dRdF );
+
+            const bool computeTDerivatives = hydra->isDerivativeRequested( derivativeRequest::dRdT );
+
             const floatVector *stateVariableEvolutionRates;
 
             const floatVector *previousStateVariableEvolutionRates;
@@ -3852,11 +4259,11 @@ namespace tardigradeHydra{
 
             const floatMatrix *dStateVariableEvolutionRatesdCauchyStress;
 
-            const floatMatrix *dStateVariableEvolutionRatesdF;
+            const floatMatrix *dStateVariableEvolutionRatesdF = NULL;
 
             const floatMatrix *dStateVariableEvolutionRatesdSubFs;
 
-            const floatVector *dStateVariableEvolutionRatesdT;
+            const floatVector *dStateVariableEvolutionRatesdT = NULL;
 
             const floatMatrix *dStateVariableEvolutionRatesdStateVariables;
 
@@ -3890,11 +4297,19 @@ namespace tardigradeHydra{
 
             TARDIGRADE_ERROR_TOOLS_CATCH( dStateVariableEvolutionRatesdCauchyStress = getdStateVariableEvolutionRatesdCauchyStress( ) );
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( dStateVariableEvolutionRatesdF = getdStateVariableEvolutionRatesdF( ) );
+            if ( computeFDerivatives ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( dStateVariableEvolutionRatesdF = getdStateVariableEvolutionRatesdF( ) );
+
+            }
 
             TARDIGRADE_ERROR_TOOLS_CATCH( dStateVariableEvolutionRatesdSubFs = getdStateVariableEvolutionRatesdSubFs( ) );
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( dStateVariableEvolutionRatesdT = getdStateVariableEvolutionRatesdT( ) );
+            if ( computeTDerivatives ){
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( dStateVariableEvolutionRatesdT = getdStateVariableEvolutionRatesdT( ) );
+
+            }
 
             TARDIGRADE_ERROR_TOOLS_CATCH( dStateVariableEvolutionRatesdStateVariables = getdStateVariableEvolutionRatesdStateVariables( ) );
 
@@ -3931,11 +4346,19 @@ namespace tardigradeHydra{
 
             setdPlasticStateVariablesdCauchyStress( tardigradeVectorTools::dot( dXidXidot, *dStateVariableEvolutionRatesdCauchyStress ) );
 
-            setdPlasticStateVariablesdF( tardigradeVectorTools::dot( dXidXidot, *dStateVariableEvolutionRatesdF ) );
+            if ( computeFDerivatives ){
+
+                setdPlasticStateVariablesdF( tardigradeVectorTools::dot( dXidXidot, *dStateVariableEvolutionRatesdF ) );
+
+            }
 
             setdPlasticStateVariablesdSubFs( tardigradeVectorTools::dot( dXidXidot, *dStateVariableEvolutionRatesdSubFs ) );
 
-            setdPlasticStateVariablesdT( tardigradeVectorTools::dot( dXidXidot, *dStateVariableEvolutionRatesdT ) );
+            if ( computeTDerivatives ){
+
+                setdPlasticStateVariablesdT( tardigradeVectorTools::dot( dXidXidot, *dStateVariableEvolutionRatesdT ) );
+
+            }
 
             setdPlasticStateVariablesdStateVariables( tardigradeVectorTools::dot( dXidXidot, *dStateVariableEvolutionRatesdStateVariables ) );
 
@@ -4205,6 +4628,8 @@ namespace tardigradeHydra{
 
             _previousStateVariables.first = true;
 
+            addPointData( &_previousStateVariables );
+
         }
 
         void residual::setPeryznaParameters( const floatVector &peryznaParameters ){
@@ -4318,7 +4743,9 @@ namespace tardigradeHydra{
              * Set the value of the Jacobian
              */
 
-            floatMatrix jacobian( *getNumEquations( ), floatVector( hydra->getUnknownVector( )->size( ), 0 ) );
+            const unsigned int numUnknowns = hydra->getUnknownVector( )->size( );
+
+            floatVector jacobian( ( *getNumEquations( ) ) * numUnknowns, 0 );
 
             // Set the derivatives
             getdPlasticDeformationGradientdCauchyStress( );
@@ -4333,16 +4760,16 @@ namespace tardigradeHydra{
                 for ( unsigned int j = 0; j < ( *getdPlasticDeformationGradientdCauchyStress( ) )[ i ].size( ); j++ ){
                     unsigned int col = j;
 
-                    jacobian[ row ][ col ] += ( *getdPlasticDeformationGradientdCauchyStress( ) )[ i ][ j ];
+                    jacobian[ numUnknowns * row + col ] += ( *getdPlasticDeformationGradientdCauchyStress( ) )[ i ][ j ];
 
                 }
 
                 // Set the Jacobian with respect to the sub-configurations
-                jacobian[ i ][ ( *getdPlasticDeformationGradientdCauchyStress( ) )[ i ].size( ) + i ] -= 1;
+                jacobian[ numUnknowns * row + ( *getdPlasticDeformationGradientdCauchyStress( ) )[ i ].size( ) + i ] -= 1;
                 for ( unsigned int j = 0; j < ( *getdPlasticDeformationGradientdSubFs( ) )[ i ].size( ); j++ ){
                     unsigned int col = ( *getdPlasticDeformationGradientdCauchyStress( ) )[ i ].size( ) + j;
 
-                    jacobian[ row ][ col ] += ( *getdPlasticDeformationGradientdSubFs( ) )[ i ][ j ];
+                    jacobian[ numUnknowns * row + col ] += ( *getdPlasticDeformationGradientdSubFs( ) )[ i ][ j ];
 
                 }
 
@@ -4350,7 +4777,7 @@ namespace tardigradeHydra{
                 for ( auto ind = getStateVariableIndices( )->begin( ); ind != getStateVariableIndices( )->end( ); ind++ ){
                     unsigned int col = ( *getdPlasticDeformationGradientdCauchyStress( ) )[ i ].size( ) + ( *getdPlasticDeformationGradientdSubFs( ) )[ i ].size( ) + *ind;
 
-                    jacobian[ row ][ col ] += ( *getdPlasticDeformationGradientdStateVariables( ) )[ i ][ ( unsigned int )( ind - getStateVariableIndices( )->begin( ) ) ];
+                    jacobian[ numUnknowns * row + col ] += ( *getdPlasticDeformationGradientdStateVariables( ) )[ i ][ ( unsigned int )( ind - getStateVariableIndices( )->begin( ) ) ];
 
                 }
 
@@ -4364,7 +4791,7 @@ namespace tardigradeHydra{
                 for ( unsigned int j = 0; j < ( *getdPlasticStateVariablesdCauchyStress( ) )[ i ].size( ); j++ ){
                     unsigned int col = j;
 
-                    jacobian[ row ][ col ] += ( *getdPlasticStateVariablesdCauchyStress( ) )[ i ][ j ];
+                    jacobian[ numUnknowns * row + col ] += ( *getdPlasticStateVariablesdCauchyStress( ) )[ i ][ j ];
 
                 }
 
@@ -4372,22 +4799,22 @@ namespace tardigradeHydra{
                 for ( unsigned int j = 0; j < ( *getdPlasticStateVariablesdSubFs( ) )[ i ].size( ); j++ ){
                     unsigned int col = ( *getdPlasticDeformationGradientdCauchyStress( ) )[ i ].size( ) + j;
 
-                    jacobian[ row ][ col ] += ( *getdPlasticStateVariablesdSubFs( ) )[ i ][ j ];
+                    jacobian[ numUnknowns * row + col ] += ( *getdPlasticStateVariablesdSubFs( ) )[ i ][ j ];
 
                 }
 
                 // Set the Jacobian with respect to the state variables
-                jacobian[ row ][ ( *getdPlasticStateVariablesdCauchyStress( ) )[ i ].size( ) + ( *getdPlasticStateVariablesdSubFs( ) )[ i ].size( ) + ( *getStateVariableIndices( ) )[ i ] ] -= 1;
+                jacobian[ numUnknowns * row + ( *getdPlasticStateVariablesdCauchyStress( ) )[ i ].size( ) + ( *getdPlasticStateVariablesdSubFs( ) )[ i ].size( ) + ( *getStateVariableIndices( ) )[ i ] ] -= 1;
                 for ( auto ind = getStateVariableIndices( )->begin( ); ind != getStateVariableIndices( )->end( ); ind++ ){
                     unsigned int col = ( *getdPlasticStateVariablesdCauchyStress( ) )[ i ].size( ) + ( *getdPlasticStateVariablesdSubFs( ) )[ i ].size( ) + *ind;
 
-                    jacobian[ row ][ col ] += ( *getdPlasticStateVariablesdStateVariables( ) )[ i ][ ( unsigned int )( ind - getStateVariableIndices( )->begin( ) ) ];
+                    jacobian[ numUnknowns * row + col ] += ( *getdPlasticStateVariablesdStateVariables( ) )[ i ][ ( unsigned int )( ind - getStateVariableIndices( )->begin( ) ) ];
 
                 }
 
             }
 
-            setJacobian( jacobian );
+            setFlatJacobian( jacobian );
 
         }
 
@@ -4426,7 +4853,9 @@ namespace tardigradeHydra{
              * Set the derivative of the residual w.r.t. the deformation gradient.
              */
 
-            floatMatrix dRdF( *getNumEquations( ), floatVector( hydra->getDeformationGradient( )->size( ), 0 ) );
+            const unsigned int sot_dim = hydra->getDeformationGradient( )->size( );
+
+            floatVector dRdF( ( *getNumEquations( ) ) * sot_dim, 0 );
 
             // Set the derivatives
             getdPlasticDeformationGradientdF( );
@@ -4438,7 +4867,7 @@ namespace tardigradeHydra{
 
                 for ( unsigned int j = 0; j < ( *getdPlasticDeformationGradientdF( ) )[ i ].size( ); j++ ){
 
-                    dRdF[ i ][ j ] = ( *getdPlasticDeformationGradientdF( ) )[ i ][ j ];
+                    dRdF[ sot_dim * i + j ] = ( *getdPlasticDeformationGradientdF( ) )[ i ][ j ];
 
                 }
 
@@ -4449,13 +4878,13 @@ namespace tardigradeHydra{
 
                 for ( unsigned int j = 0; j < ( *getdPlasticStateVariablesdF( ) )[ i ].size( ); j++ ){
 
-                    dRdF[ i + getPlasticDeformationGradient( )->size( ) ][ j ] += ( *getdPlasticStateVariablesdF( ) )[ i ][ j ];
+                    dRdF[ sot_dim * ( i + getPlasticDeformationGradient( )->size( ) ) + j ] += ( *getdPlasticStateVariablesdF( ) )[ i ][ j ];
 
                 }
 
             }
 
-            setdRdF( dRdF );
+            setFlatdRdF( dRdF );
 
         }
 
@@ -6021,6 +6450,154 @@ namespace tardigradeHydra{
 
         }
 
+        void residual::setPersistedRatesIndex( const unsigned int &persistedRatesIndex ){
+            /*!
+             * Persist the converged velocity gradient and state variable evolution rates in the additional
+             * state variables so that the next increment reads them as its previous values rather than
+             * re-computing them from the previous state. The stored block is
+             *
+             * { flag, velocity gradient, state variable evolution rates }
+             *
+             * where the flag is one once the block has been written. The block is written by
+             * setCurrentAdditionalStateVariables so persistedRatesIndex must be the offset of this residual's
+             * additional state variables i.e. the number of additional state variables written by the
+             * preceding residuals.
+             *
+             * \param &persistedRatesIndex: The index of the first persisted value in the additional state variables
+             */
+
+            _persistRates = true;
+
+            _persistedRatesIndex = persistedRatesIndex;
+
+        }
+
+        const bool* residual::getPersistRates( ){
+            /*!
+             * Get the flag for whether the converged rates are persisted in the additional state variables
+             */
+
+            return &_persistRates;
+
+        }
+
+        const unsigned int* residual::getPersistedRatesIndex( ){
+            /*!
+             * Get the index of the persisted rates in the additional state variables
+             */
+
+            return &_persistedRatesIndex;
+
+        }
+
+        unsigned int residual::getNumPersistedRates( ){
+            /*!
+             * Get the number of additional state variables required to persist the rates
+             */
+
+            const unsigned int *dim = hydra->getDimension( );
+
+            return 1 + ( *dim ) * ( *dim ) + getStateVariableIndices( )->size( );
+
+        }
+
+        bool residual::hasPersistedRates( ){
+            /*!
+             * Check if the velocity gradient and state variable evolution rates of the previous increment
+             * are persisted in the additional state variables. Returns false if the rates are not persisted
+             * or if they have not been written yet.
+             */
+
+            if ( !_persistRates ){
+
+                return false;
+
+            }
+
+            const floatVector *previousAdditionalStateVariables = hydra->getPreviousAdditionalStateVariables( );
+
+            const unsigned int numPersistedRates = getNumPersistedRates( );
+
+            if ( ( _persistedRatesIndex + numPersistedRates ) > previousAdditionalStateVariables->size( ) ){
+
+                std::string message = "The persisted rates do not fit in the additional state variables\n";
+                message            += "  index of the persisted rates         : " + std::to_string( _persistedRatesIndex ) + "\n";
+                message            += "  number of persisted rates            : " + std::to_string( numPersistedRates ) + "\n";
+                message            += "  number of additional state variables : " + std::to_string( previousAdditionalStateVariables->size( ) );
+
+                TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( message ) );
+
+            }
+
+            return ( *previousAdditionalStateVariables )[ _persistedRatesIndex ] >= 0.5;
+
+        }
+
+        bool residual::readPersistedRates( floatVector &velocityGradient, floatVector &stateVariableEvolutionRates ){
+            /*!
+             * Read the velocity gradient and state variable evolution rates of the previous increment from
+             * the additional state variables. Returns false if the rates are not persisted or if they have
+             * not been written yet.
+             *
+             * \param &velocityGradient: The persisted previous velocity gradient
+             * \param &stateVariableEvolutionRates: The persisted previous state variable evolution rates
+             */
+
+            bool isPersisted;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( isPersisted = hasPersistedRates( ) );
+
+            if ( !isPersisted ){
+
+                return false;
+
+            }
+
+            const unsigned int *dim = hydra->getDimension( );
+
+            floatVector::const_iterator persisted = hydra->getPreviousAdditionalStateVariables( )->begin( ) + _persistedRatesIndex;
+
+            velocityGradient = floatVector( persisted + 1, persisted + 1 + ( *dim ) * ( *dim ) );
+
+            stateVariableEvolutionRates = floatVector( persisted + 1 + ( *dim ) * ( *dim ), persisted + getNumPersistedRates( ) );
+
+            return true;
+
+        }
+
+        void residual::setCurrentAdditionalStateVariables( ){
+            /*!
+             * Set the current additional state variables. If the rates are persisted these are the
+             * converged velocity gradient and state variable evolution rates.
+             */
+
+            if ( !_persistRates ){
+
+                tardigradeHydra::residualBase::setCurrentAdditionalStateVariables( floatVector( 0, 0 ) );
+
+                return;
+
+            }
+
+            const floatVector *velocityGradient;
+
+            const floatVector *stateVariableEvolutionRates;
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( velocityGradient = getVelocityGradient( ) );
+
+            TARDIGRADE_ERROR_TOOLS_CATCH( stateVariableEvolutionRates = getStateVariableEvolutionRates( ) );
+
+            floatVector currentAdditionalStateVariables( getNumPersistedRates( ), 1 );
+
+            std::copy( velocityGradient->begin( ), velocityGradient->end( ), currentAdditionalStateVariables.begin( ) + 1 );
+
+            std::copy( stateVariableEvolutionRates->begin( ), stateVariableEvolutionRates->end( ),
+                       currentAdditionalStateVariables.begin( ) + 1 + velocityGradient->size( ) );
+
+            tardigradeHydra::residualBase::setCurrentAdditionalStateVariables( currentAdditionalStateVariables );
+
+        }
+
         void residual::decomposeParameters( const floatVector &parameters ){
             /*!
              * Decompose the incoming parameter vector
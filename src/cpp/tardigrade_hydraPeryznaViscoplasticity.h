@@ -524,6 +524,14 @@ namespace tardigradeHydra{
 
                 const floatType* getIntegrationParameter( );
 
+                void setPersistedRatesIndex( const unsigned int &persistedRatesIndex );
+
+                const bool* getPersistRates( );
+
+                const unsigned int* getPersistedRatesIndex( );
+
+                unsigned int getNumPersistedRates( );
+
             private:
 
                 unsigned int _plasticConfigurationIndex;
@@ -532,6 +540,16 @@ namespace tardigradeHydra{
 
                 floatType _integrationParameter;
 
+                bool _persistRates = false;
+
+                unsigned int _persistedRatesIndex = 0;
+
+                bool hasPersistedRates( );
+
+                bool readPersistedRates( floatVector &velocityGradient, floatVector &stateVariableEvolutionRates );
+
+                virtual void setCurrentAdditionalStateVariables( );
+
                 virtual void setDrivingStress( );
 
                 virtual void setdDrivingStressdCauchyStress( );
@@ -690,6 +708,10 @@ namespace tardigradeHydra{
 
                 virtual void setFlowDirectionDerivatives( const bool isPrevious );
 
+                virtual void setFlowDirectionAndPartials( const bool isPrevious, const bool computePartials );
+
+                const floatMatrix* getdFlowDirectiondDrivingStress( const bool isPrevious );
+
                 virtual void setdFlowDirectiondCauchyStress( const bool isPrevious );
 
                 virtual void setdFlowDirectiondF( const bool isPrevious );
@@ -700,6 +722,10 @@ namespace tardigradeHydra{
 
                 virtual void setYieldFunctionDerivatives( const bool isPrevious );
 
+                virtual void setYieldFunctionAndPartials( const bool isPrevious );
+
+                const floatVector* getdYieldFunctiondDrivingStress( const bool isPrevious );
+
                 virtual void setdYieldFunctiondCauchyStress( const bool isPrevious );
 
                 virtual void setdYieldFunctiondF( const bool isPrevious );
@@ -728,6 +754,10 @@ namespace tardigradeHydra{
 
                 virtual void setPlasticMultiplierDerivatives( const bool isPrevious );
 
+                virtual void setPlasticMultiplierAndPartials( const bool isPrevious );
+
+                const floatVector* getPlasticMultiplierPartials( const bool isPrevious );
+
                 virtual void setdPlasticMultiplierdCauchyStress( const bool isPrevious );
 
                 virtual void setdPlasticMultiplierdF( const bool isPrevious );
@@ -862,6 +892,10 @@ namespace tardigradeHydra{
 
                 tardigradeHydra::dataStorage< floatMatrix > _dPreviousFlowDirectiondPreviousSubFs;
 
+                tardigradeHydra::dataStorage< floatMatrix > _dFlowDirectiondDrivingStress;
+
+                tardigradeHydra::dataStorage< floatMatrix > _dPreviousFlowDirectiondPreviousDrivingStress;
+
                 tardigradeHydra::dataStorage< floatType > _yieldFunction;
 
                 tardigradeHydra::dataStorage< floatVector > _dYieldFunctiondCauchyStress;
@@ -878,6 +912,10 @@ namespace tardigradeHydra{
 
                 tardigradeHydra::dataStorage< floatVector > _dPreviousYieldFunctiondPreviousSubFs;
 
+                tardigradeHydra::dataStorage< floatVector > _dYieldFunctiondDrivingStress;
+
+                tardigradeHydra::dataStorage< floatVector > _dPreviousYieldFunctiondPreviousDrivingStress;
+
                 tardigradeHydra::dataStorage< floatType > _plasticThermalMultiplier;
 
                 tardigradeHydra::dataStorage< floatType > _dPlasticThermalMultiplierdT;
@@ -926,6 +964,10 @@ namespace tardigradeHydra{
 
                 tardigradeHydra::dataStorage< floatVector > _dPreviousPlasticMultiplierdPreviousStateVariables;
 
+                tardigradeHydra::dataStorage< floatVector > _plasticMultiplierPartials;
+
+                tardigradeHydra::dataStorage< floatVector > _previousPlasticMultiplierPartials;
+
                 tardigradeHydra::dataStorage< floatVector > _velocityGradient;
 
                 tardigradeHydra::dataStorage< floatMatrix > _dVelocityGradientdCauchyStress;
@@ -218,11 +218,16 @@ namespace tardigradeHydra{
 
             setThermalDeformationGradient( thermalDeformationGradient );
 
-            floatMatrix dThermalDeformationGradientdGreenLagrangeStrain;
+            // The derivative w.r.t. the temperature is only required for dRdT
+            if ( hydra->isDerivativeRequested( derivativeRequest::dRdT ) ){
 
-            TARDIGRADE_ERROR_TOOLS_CATCH( dThermalDeformationGradientdGreenLagrangeStrain = tardigradeVectorTools::inflate( 2 * tardigradeVectorTools::inverse( tardigradeVectorTools::appendVectors( dThermalGreenLagrangeStraindThermalDeformationGradient ), ( *dim ) * ( *dim ), ( *dim ) * ( *dim ) ), ( *dim ) * ( *dim ), ( *dim ) * ( *dim ) ) );
+                floatMatrix dThermalDeformationGradientdGreenLagrangeStrain;
 
-            setdThermalDeformationGradientdT( tardigradeVectorTools::dot( dThermalDeformationGradientdGreenLagrangeStrain, *getdThermalGreenLagrangeStraindT( ) ) );
+                TARDIGRADE_ERROR_TOOLS_CATCH( dThermalDeformationGradientdGreenLagrangeStrain = tardigradeVectorTools::inflate( 2 * tardigradeVectorTools::inverse( tardigradeVectorTools::appendVectors( dThermalGreenLagrangeStraindThermalDeformationGradient ), ( *dim ) * ( *dim ), ( *dim ) * ( *dim ) ), ( *dim ) * ( *dim ), ( *dim ) * ( *dim ) ) );
+
+                setdThermalDeformationGradientdT( tardigradeVectorTools::dot( dThermalDeformationGradientdGreenLagrangeStrain, *getdThermalGreenLagrangeStraindT( ) ) );
+
+            }
 
         }
 
@@ -262,15 +267,17 @@ namespace tardigradeHydra{
 
             const unsigned int *dim = hydra->getDimension( );
 
-            floatMatrix jacobian( *getNumEquations( ), floatVector( hydra->getUnknownVector( )->size( ), 0 ) );
+            const unsigned int numUnknowns = hydra->getUnknownVector( )->size( );
+
+            floatVector jacobian( ( *getNumEquations( ) ) * numUnknowns, 0 );
 
             for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
 
-                jacobian[ i ][ ( *dim ) * ( *dim ) * ( *getThermalConfigurationIndex( ) ) + i ] = -1;
+                jacobian[ numUnknowns * i + ( *dim ) * ( *dim ) * ( *getThermalConfigurationIndex( ) ) + i ] = -1;
 
             }
 
-            setJacobian( jacobian );
+            setFlatJacobian( jacobian );
 
         }
 
@@ -288,7 +295,7 @@ namespace tardigradeHydra{
              * Set the derivative of the residual w.r.t. the deformation gradient
              */
 
-            setdRdF( floatMatrix( *getNumEquations( ), floatVector( hydra->getDeformationGradient( )->size( ), 0 ) ) );
+            setFlatdRdF( floatVector( ( *getNumEquations( ) ) * hydra->getDeformationGradient( )->size( ), 0 ) );
 
         }
 
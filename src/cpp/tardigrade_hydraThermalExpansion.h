@@ -86,6 +86,19 @@ namespace tardigradeHydra{
 
                     TARDIGRADE_ERROR_TOOLS_CATCH( decomposeParameters( parameters ) );
 
+                    // The thermal configuration only depends on the temperature so it can be condensed out of the non-linear solve
+                    std::vector< unsigned int > explicitUnknownIndices( numEquations );
+
+                    for ( unsigned int i = 0; i < numEquations; i++ ){
+
+                        explicitUnknownIndices[ i ] = ( *hydra->getDimension( ) ) * ( *hydra->getDimension( ) ) * thermalConfigurationIndex + i;
+
+                    }
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( setExplicitUnknownIndices( explicitUnknownIndices ) );
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( setUnknownBlockDependencies( { thermalConfigurationIndex } ) );
+
                 }
 
                 void setReferenceTemperature( const floatType &referenceTemperature );
@@ -8,6 +8,55 @@
 
 #include<tardigrade_hydra_umat.h>
 
+namespace tardigradeHydra{
+
+    namespace umat{
+
+        void linearElasticHydra::setResidualClasses( ){
+            /*!
+             * Set the linear elastic residual as the only residual class
+             */
+
+            elasticity = tardigradeHydra::linearElasticity::residual( this, ( *getDimension( ) ) * ( *getDimension( ) ), *getParameters( ) );
+
+            std::vector< tardigradeHydra::residualBase* > residuals( 1 );
+
+            residuals[ 0 ] = &elasticity;
+
+            setResidualClasses( residuals );
+
+        }
+
+        std::unique_ptr< tardigradeHydra::hydraBase > buildLinearElasticHydra( const floatType &time, const floatType &deltaTime,
+                                                                              const floatType &temperature, const floatType &previousTemperature,
+                                                                              const floatVector &deformationGradient, const floatVector &previousDeformationGradient,
+                                                                              const floatVector &previousStateVariables, const floatVector &parameters ){
+            /*!
+             * Build the linear elastic hydra model of an Abaqus material point
+             *
+             * \param &time: The current time
+             * \param &deltaTime: The change in time
+             * \param &temperature: The current temperature
+             * \param &previousTemperature: The previous temperature
+             * \param &deformationGradient: The current deformation gradient
+             * \param &previousDeformationGradient The previous deformation gradient
+             * \param &previousStateVariables: The previous state variables
+             * \param &parameters: The Lame parameters { lambda, mu }
+             */
+
+            return std::unique_ptr< tardigradeHydra::hydraBase >( new linearElasticHydra( time, deltaTime, temperature, previousTemperature,
+                                                                                          deformationGradient, previousDeformationGradient,
+                                                                                          previousStateVariables, parameters, 1, 0 ) );
+
+        }
+
+        //! Register the linear elastic material when the UMAT is loaded
+        static tardigradeHydra::abaqusMaterialRegistrar linearElasticRegistrar( linearElasticMaterialName, buildLinearElasticHydra );
+
+    }
+
+}
+
 extern "C" void umat_( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
                        double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
                        const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
@@ -65,7 +114,8 @@ extern "C" void umat_( double *STRESS,       double *STATEV,       double *DDSDD
      * \param &KINC: Increment number.
      */
 
-     //Add switching logic to handle more than one UMAT.
+     //Materials with a hydra model registered by tardigradeHydra::registerAbaqusMaterial are evaluated by that model.
+     //The UMAT registers tardigradeHydra::umat::linearElasticMaterialName which is built from PROPS = { lambda, mu }.
      //Call the appropriate UMAT interface
      tardigradeHydra::abaqusInterface( STRESS, STATEV, DDSDDE,    SSE,    SPD,
                                            SCD,    RPL, DDSDDT, DRPLDE, DRPLDT,
@@ -10,6 +10,7 @@
 #define UMAT_H
 
 #include<tardigrade_hydra.h>
+#include<tardigrade_hydraLinearElasticity.h>
 
 extern "C" void UMAT( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
                       double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
@@ -20,4 +21,41 @@ extern "C" void UMAT( double *STRESS,       double *STATEV,       double *DDSDDE
                       const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
                       const int *JSTEP,     const int &KINC );
 
+namespace tardigradeHydra{
+
+    namespace umat{
+
+        //! The name of the linear elastic material registered by the UMAT
+        const std::string linearElasticMaterialName = "HYDRA-LINEAR-ELASTIC";
+
+        /*!
+         * A linear elastic hydra model which is registered with the Abaqus interface by the UMAT. The material
+         * properties are the Lame parameters { lambda, mu } and all of the state variables are additional state
+         * variables which are passed through unchanged.
+         */
+        class linearElasticHydra : public tardigradeHydra::hydraBase{
+
+            public:
+
+                using tardigradeHydra::hydraBase::hydraBase;
+
+                using tardigradeHydra::hydraBase::setResidualClasses;
+
+                virtual void setResidualClasses( ) override;
+
+            private:
+
+                tardigradeHydra::linearElasticity::residual elasticity; //!< The linear elastic residual
+
+        };
+
+        std::unique_ptr< tardigradeHydra::hydraBase > buildLinearElasticHydra( const floatType &time, const floatType &deltaTime,
+                                                                              const floatType &temperature, const floatType &previousTemperature,
+                                                                              const floatVector &deformationGradient, const floatVector &previousDeformationGradient,
+                                                                              const floatVector &previousStateVariables, const floatVector &parameters );
+
+    }
+
+}
+
 #endif
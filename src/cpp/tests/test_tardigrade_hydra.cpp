@@ -20,6 +20,90 @@ typedef tardigradeHydra::floatType floatType; //!< Redefinition of the floating
 typedef tardigradeHydra::floatVector floatVector; //!< Redefinition of the vector of floating points type
 typedef tardigradeHydra::floatMatrix floatMatrix; //!< Redefinition of the matrix of floating points type
 
+#ifdef __GLIBC__
+
+// Count every allocation from the heap (see tardigradeHydra::solveStatistics::countAllocation). Eigen allocates with
+// malloc rather than operator new so malloc, calloc, and realloc are replaced and forward to the allocator of glibc.
+extern "C" void *__libc_malloc( std::size_t size ) noexcept;
+
+extern "C" void *__libc_calloc( std::size_t num, std::size_t size ) noexcept;
+
+extern "C" void *__libc_realloc( void *ptr, std::size_t size ) noexcept;
+
+extern "C" void *malloc( std::size_t size ) noexcept{
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    return __libc_malloc( size );
+
+}
+
+extern "C" void *calloc( std::size_t num, std::size_t size ) noexcept{
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    return __libc_calloc( num, size );
+
+}
+
+extern "C" void *realloc( void *ptr, std::size_t size ) noexcept{
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    return __libc_realloc( ptr, size );
+
+}
+
+#else
+
+// Count the allocations made through the global operator new (see tardigradeHydra::solveStatistics::countAllocation).
+// The allocations Eigen makes with malloc are not counted.
+void* operator new( std::size_t size ){
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    if ( void *ptr = std::malloc( size > 0 ? size : 1 ) ){
+
+        return ptr;
+
+    }
+
+    throw std::bad_alloc( );
+
+}
+
+void* operator new[]( std::size_t size ){
+
+    return operator new( size );
+
+}
+
+void operator delete( void *ptr ) noexcept{
+
+    std::free( ptr );
+
+}
+
+void operator delete[]( void *ptr ) noexcept{
+
+    std::free( ptr );
+
+}
+
+void operator delete( void *ptr, std::size_t ) noexcept{
+
+    std::free( ptr );
+
+}
+
+void operator delete[]( void *ptr, std::size_t ) noexcept{
+
+    std::free( ptr );
+
+}
+
+#endif
+
 struct cout_redirect{
     cout_redirect( std::streambuf * new_buffer)
         : old( std::cout.rdbuf( new_buffer ) )
@@ -169,13 +253,21 @@ namespace tardigradeHydra{
 
                 static void checkdF1dF( hydraBase &hydra ){
 
-                    BOOST_CHECK( std::find( hydra._iterationData.begin( ), hydra._iterationData.end( ), &hydra._dF1dF ) != hydra._iterationData.end( ) );
+                    BOOST_CHECK( hydra._dF1dF.first );
+
+                    hydra.resetIterationData( );
+
+                    BOOST_CHECK( !hydra._dF1dF.first );
 
                 }
 
                 static void checkdF1dFn( hydraBase &hydra ){
 
-                    BOOST_CHECK( std::find( hydra._iterationData.begin( ), hydra._iterationData.end( ), &hydra._dF1dFn ) != hydra._iterationData.end( ) );
+                    BOOST_CHECK( hydra._dF1dFn.first );
+
+                    hydra.resetIterationData( );
+
+                    BOOST_CHECK( !hydra._dF1dFn.first );
 
                 }
 
@@ -203,6 +295,24 @@ namespace tardigradeHydra{
 
                 }
 
+                static void formNonLinearResidual( hydraBase &hydra ){
+
+                    BOOST_CHECK_NO_THROW( hydra.formNonLinearResidual( ) );
+
+                }
+
+                static void formNonLinearJacobian( hydraBase &hydra ){
+
+                    BOOST_CHECK_NO_THROW( hydra.formNonLinearJacobian( ) );
+
+                }
+
+                static bool get_jacobianIsSet( hydraBase &hydra ){
+
+                    return hydra._jacobian.first;
+
+                }
+
                 static void initializeUnknownVector( hydraBase &hydra ){
 
                     BOOST_CHECK_NO_THROW( hydra.initializeUnknownVector( ) );
@@ -422,6 +532,322 @@ BOOST_AUTO_TEST_CASE( testAbaqusInterface ){
 
 }
 
+BOOST_AUTO_TEST_CASE( test_abaqusHydraInterface ){
+    /*!
+     * Test the evaluation of a registered hydra model through the Abaqus interface
+     */
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase{
+
+        public:
+
+            tardigradeHydra::linearElasticity::residual elasticity;
+
+            unsigned int elasticitySize = 9;
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                elasticity = tardigradeHydra::linearElasticity::residual( this, elasticitySize, *getParameters( ) );
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 1 );
+
+                residuals[ 0 ] = &elasticity;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    unsigned int numBuilds = 0;
+
+    tardigradeHydra::registerAbaqusMaterial( "HYDRA-ELASTIC",
+        [ &numBuilds ]( const floatType &time, const floatType &deltaTime, const floatType &temperature, const floatType &previousTemperature,
+                        const floatVector &deformationGradient, const floatVector &previousDeformationGradient,
+                        const floatVector &previousStateVariables, const floatVector &parameters ){
+
+            numBuilds++;
+
+            return std::unique_ptr< tardigradeHydra::hydraBase >( new hydraBaseMock( time, deltaTime, temperature, previousTemperature,
+                                                                                     deformationGradient, previousDeformationGradient,
+                                                                                     previousStateVariables, parameters, 1, 0 ) );
+
+        } );
+
+    // Fortran pads the material name with spaces
+    char CMNAME[ ] = "HYDRA-ELASTIC      ";
+
+    int NDI = 3;
+
+    int NSHR = 3;
+
+    int NTENS = 6;
+
+    double TIME[ 2 ] = { 0.1, 1.1 };
+
+    double DTIME = 0.2;
+
+    double TEMP = 293.15;
+
+    double DTEMP = 1.5;
+
+    double PROPS[ 2 ] = { 123.4, 56.7 };
+
+    int NPROPS = 2;
+
+    double STATEV[ 1 ] = { 3.4 };
+
+    int NSTATV = 1;
+
+    double PNEWDT = 1.;
+
+    double STRESS[ 6 ], DDSDDE[ 36 ], DDSDDT[ 6 ];
+
+    double DFGRD0[ 9 ] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    double DFGRD1[ 9 ] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    BOOST_CHECK( tardigradeHydra::abaqusHydraInterface( STRESS, STATEV, DDSDDE, DDSDDT, TIME, DTIME, TEMP, DTEMP, CMNAME, NDI, NSHR, NTENS,
+                                                        NSTATV, PROPS, NPROPS, PNEWDT, DFGRD0, DFGRD1 ) );
+
+    BOOST_TEST( numBuilds == 1 );
+
+    BOOST_TEST( PNEWDT == 1. );
+
+    // The undeformed material has the isotropic small strain tangent
+    floatVector isotropicAnswer( 36, 0 );
+
+    for ( unsigned int i = 0; i < 3; i++ ){
+
+        for ( unsigned int j = 0; j < 3; j++ ){
+
+            isotropicAnswer[ i + 6 * j ] = PROPS[ 0 ];
+
+        }
+
+        isotropicAnswer[ i + 6 * i ] += 2 * PROPS[ 1 ];
+
+        isotropicAnswer[ ( i + 3 ) + 6 * ( i + 3 ) ] = PROPS[ 1 ];
+
+    }
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( STRESS, STRESS + 6 ), floatVector( 6, 0 ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( DDSDDE, DDSDDE + 36 ), isotropicAnswer ) );
+
+    // Move the persistent model to a deformed point and compare to a directly evaluated model
+    floatVector deformationGradient = { 1.01, 0.02, 0.00,
+                                        0.00, 0.99, 0.01,
+                                        0.03, 0.00, 1.02 };
+
+    for ( unsigned int i = 0; i < 3; i++ ){
+
+        for ( unsigned int j = 0; j < 3; j++ ){
+
+            DFGRD1[ i + 3 * j ] = deformationGradient[ 3 * i + j ];
+
+        }
+
+    }
+
+    floatVector previousStateVariables( STATEV, STATEV + NSTATV );
+
+    hydraBaseMock hydra( TIME[ 1 ] + DTIME, DTIME, TEMP + DTEMP, TEMP, deformationGradient, floatVector( DFGRD0, DFGRD0 + 9 ),
+                         previousStateVariables, floatVector( PROPS, PROPS + NPROPS ), 1, 0 );
+
+    hydra.evaluate( );
+
+    BOOST_CHECK( tardigradeHydra::abaqusHydraInterface( STRESS, STATEV, DDSDDE, DDSDDT, TIME, DTIME, TEMP, DTEMP, CMNAME, NDI, NSHR, NTENS,
+                                                        NSTATV, PROPS, NPROPS, PNEWDT, DFGRD0, DFGRD1 ) );
+
+    BOOST_TEST( numBuilds == 1 );
+
+    const floatVector *cauchyStress = hydra.getCauchyStress( );
+
+    floatVector stressAnswer = { ( *cauchyStress )[ 0 ], ( *cauchyStress )[ 4 ], ( *cauchyStress )[ 8 ],
+                                 ( *cauchyStress )[ 1 ], ( *cauchyStress )[ 2 ], ( *cauchyStress )[ 5 ] };
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( STRESS, STRESS + 6 ), stressAnswer ) );
+
+    // The tangent is the finite difference of the Kirchhoff stress divided by J for the perturbation
+    // F + dF = ( I + eps sym( e_k x e_l ) ) F. The perturbation has no spin so the Jaumann rate of the Kirchhoff stress
+    // is its material rate.
+    const unsigned int abaqusIndices[ 6 ][ 2 ] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 0, 1 }, { 0, 2 }, { 1, 2 } };
+
+    floatType J = tardigradeVectorTools::determinant( deformationGradient, 3, 3 );
+
+    floatType eps = 1e-6;
+
+    floatVector tangentAnswer( 36, 0 );
+
+    for ( unsigned int q = 0; q < 6; q++ ){
+
+        const unsigned int k = abaqusIndices[ q ][ 0 ];
+
+        const unsigned int l = abaqusIndices[ q ][ 1 ];
+
+        floatVector kirchhoffStress[ 2 ];
+
+        for ( unsigned int s = 0; s < 2; s++ ){
+
+            floatType delta = ( s == 0 ) ? eps : -eps;
+
+            floatVector Fp = deformationGradient;
+
+            for ( unsigned int M = 0; M < 3; M++ ){
+
+                Fp[ 3 * k + M ] += 0.5 * delta * deformationGradient[ 3 * l + M ];
+
+                Fp[ 3 * l + M ] += 0.5 * delta * deformationGradient[ 3 * k + M ];
+
+            }
+
+            hydraBaseMock hydrap( TIME[ 1 ] + DTIME, DTIME, TEMP + DTEMP, TEMP, Fp, floatVector( DFGRD0, DFGRD0 + 9 ),
+                                  previousStateVariables, floatVector( PROPS, PROPS + NPROPS ), 1, 0 );
+
+            hydrap.evaluate( );
+
+            floatType Jp = tardigradeVectorTools::determinant( Fp, 3, 3 );
+
+            kirchhoffStress[ s ] = *hydrap.getCauchyStress( );
+
+            for ( auto v = kirchhoffStress[ s ].begin( ); v != kirchhoffStress[ s ].end( ); v++ ){
+
+                *v *= Jp;
+
+            }
+
+        }
+
+        for ( unsigned int p = 0; p < 6; p++ ){
+
+            const unsigned int i = abaqusIndices[ p ][ 0 ];
+
+            const unsigned int j = abaqusIndices[ p ][ 1 ];
+
+            tangentAnswer[ p + 6 * q ] = ( kirchhoffStress[ 0 ][ 3 * i + j ] - kirchhoffStress[ 1 ][ 3 * i + j ] ) / ( 2 * eps * J );
+
+        }
+
+    }
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( DDSDDE, DDSDDE + 36 ), tangentAnswer, 1e-5, 1e-5 ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( STATEV, STATEV + NSTATV ), *hydra.getUpdatedStateVariables( ) ) );
+
+    // The full interface dispatches to the registered model
+    double SSE, SPD, SCD, RPL, DRPLDT, CELENT;
+
+    double STRAN[ 6 ], DSTRAN[ 6 ], PREDEF[ 1 ], DPRED[ 1 ], COORDS[ 3 ], DROT[ 9 ], DRPLDE[ 6 ];
+
+    int NOEL = 1, NPT = 1, LAYER = 1, KSPT = 1, KINC = 1;
+
+    int JSTEP[ 4 ] = { 1, 1, 1, 0 };
+
+    std::fill( STRESS, STRESS + 6, 0 );
+
+    tardigradeHydra::abaqusInterface( STRESS, STATEV, DDSDDE, SSE,    SPD,
+                                      SCD,    RPL,    DDSDDT, DRPLDE, DRPLDT,
+                                      STRAN,  DSTRAN, TIME,   DTIME,  TEMP,
+                                      DTEMP,  PREDEF, DPRED,  CMNAME, NDI,
+                                      NSHR,   NTENS,  NSTATV, PROPS,  NPROPS,
+                                      COORDS, DROT,   PNEWDT, CELENT, DFGRD0,
+                                      DFGRD1, NOEL,   NPT,    LAYER,  KSPT,
+                                      JSTEP,  KINC );
+
+    BOOST_TEST( numBuilds == 1 );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( STRESS, STRESS + 6 ), stressAnswer ) );
+
+    // The number of state variables of a built model can't change
+    double STATEV_incorrect[ 2 ] = { 3.4, 0.0 };
+
+    int NSTATV_incorrect = 2;
+
+    BOOST_CHECK_THROW( tardigradeHydra::abaqusHydraInterface( STRESS, STATEV_incorrect, DDSDDE, DDSDDT, TIME, DTIME, TEMP, DTEMP, CMNAME, NDI, NSHR, NTENS,
+                                                              NSTATV_incorrect, PROPS, NPROPS, PNEWDT, DFGRD0, DFGRD1 ), std::nested_exception );
+
+    // Unregistered materials are left to the template interface
+    char unregistered[ ] = "HYDRA-UNREGISTERED";
+
+    BOOST_CHECK( !tardigradeHydra::abaqusHydraInterface( STRESS, STATEV, DDSDDE, DDSDDT, TIME, DTIME, TEMP, DTEMP, unregistered, NDI, NSHR, NTENS,
+                                                         NSTATV, PROPS, NPROPS, PNEWDT, DFGRD0, DFGRD1 ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_abaqusHydraInterface_failedSolve ){
+    /*!
+     * Test that a failed solve of a registered hydra model requests a smaller increment and leaves the outputs unchanged
+     */
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase{
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            virtual void evaluate( ) override{
+
+                throw tardigradeHydra::convergence_error( "Failure to converge" );
+
+            }
+
+    };
+
+    tardigradeHydra::registerAbaqusMaterial( "HYDRA-FAILING",
+        [ ]( const floatType &time, const floatType &deltaTime, const floatType &temperature, const floatType &previousTemperature,
+             const floatVector &deformationGradient, const floatVector &previousDeformationGradient,
+             const floatVector &previousStateVariables, const floatVector &parameters ){
+
+            return std::unique_ptr< tardigradeHydra::hydraBase >( new hydraBaseMock( time, deltaTime, temperature, previousTemperature,
+                                                                                     deformationGradient, previousDeformationGradient,
+                                                                                     previousStateVariables, parameters, 1, 0 ) );
+
+        } );
+
+    char CMNAME[ ] = "HYDRA-FAILING";
+
+    int NDI = 3, NSHR = 3, NTENS = 6, NSTATV = 2, NPROPS = 2;
+
+    double TIME[ 2 ] = { 0.1, 1.1 };
+
+    double DTIME = 0.2, TEMP = 293.15, DTEMP = 1.5, PNEWDT = 1.;
+
+    double PROPS[ 2 ] = { 123.4, 56.7 };
+
+    double STATEV[ 2 ] = { 3.4, -5.6 };
+
+    double STRESS[ 6 ] = { 1, 2, 3, 4, 5, 6 };
+
+    double DDSDDE[ 36 ], DDSDDT[ 6 ];
+
+    double DFGRD0[ 9 ] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    double DFGRD1[ 9 ] = { 1.01, 0.00, 0.03, 0.02, 0.99, 0.00, 0.00, 0.01, 1.02 };
+
+    BOOST_CHECK( tardigradeHydra::abaqusHydraInterface( STRESS, STATEV, DDSDDE, DDSDDT, TIME, DTIME, TEMP, DTEMP, CMNAME, NDI, NSHR, NTENS,
+                                                        NSTATV, PROPS, NPROPS, PNEWDT, DFGRD0, DFGRD1 ) );
+
+    BOOST_TEST( PNEWDT == 0.5 );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( STRESS, STRESS + 6 ), floatVector( { 1, 2, 3, 4, 5, 6 } ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( STATEV, STATEV + 2 ), floatVector( { 3.4, -5.6 } ) ) );
+
+    // A smaller suggested increment is not increased
+    PNEWDT = 0.25;
+
+    BOOST_CHECK( tardigradeHydra::abaqusHydraInterface( STRESS, STATEV, DDSDDE, DDSDDT, TIME, DTIME, TEMP, DTEMP, CMNAME, NDI, NSHR, NTENS,
+                                                        NSTATV, PROPS, NPROPS, PNEWDT, DFGRD0, DFGRD1 ) );
+
+    BOOST_TEST( PNEWDT == 0.25 );
+
+}
+
 BOOST_AUTO_TEST_CASE( test_hydraBase_getTime ){
 
     tardigradeHydra::hydraBase hydra;
@@ -863,7 +1289,11 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_getFollowingConfiguration ){
 
 }
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_getPreviousSubConfiguration ){
+BOOST_AUTO_TEST_CASE( test_hydraBase_subConfigurationCache ){
+    /*!
+     * Test that the sub-configurations and their gradients are served from a cache which is refreshed when the
+     * unknown vector is updated
+     */
 
     floatType time = 1.1;
 
@@ -901,23 +1331,263 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_getPreviousSubConfiguration ){
     tardigradeHydra::hydraBase hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
                             previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousSubConfiguration( 0, 4 ), *hydra.getPreviousDeformationGradient( ) ) );
+    for ( unsigned int lower = 0; lower <= numConfigurations; lower++ ){
 
-    floatVector answer1 = { 2.24332648, 1.48246714, 2.02801682,
-                            1.50380989, 2.98203598, 2.08079721,
-                            1.58939152, 1.2551092 , 2.38201794 };
+        for ( unsigned int upper = lower; upper <= numConfigurations; upper++ ){
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousSubConfiguration( 1, 3 ), answer1 ) );
+            BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getSubConfiguration( lower, upper ),
+                                                             hydra.getSubConfiguration( *hydra.getConfigurations( ), lower, upper ) ) );
 
-}
+            BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getSubConfigurationGradient( lower, upper ),
+                                                             hydra.getSubConfigurationGradient( *hydra.getConfigurations( ), lower, upper ) ) );
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_getPreviousPrecedingConfiguration ){
+            BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousSubConfiguration( lower, upper ),
+                                                             hydra.getSubConfiguration( *hydra.getPreviousConfigurations( ), lower, upper ) ) );
 
-    floatType time = 1.1;
+            BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousSubConfigurationGradient( lower, upper ),
+                                                             hydra.getSubConfigurationGradient( *hydra.getPreviousConfigurations( ), lower, upper ) ) );
 
-    floatType deltaTime = 2.2;
+        }
 
-    floatType temperature = 5.3;
+    }
+
+    // Repeated requests are served from the cache
+    BOOST_CHECK( &hydra.getPrecedingConfiguration( 2 ) == &hydra.getSubConfiguration( 0, 2 ) );
+
+    BOOST_CHECK( &hydra.getFollowingConfigurationGradient( 1 ) == &hydra.getSubConfigurationGradient( 2, 4 ) );
+
+    BOOST_CHECK_THROW( hydra.getSubConfiguration( 2, 1 ), std::nested_exception );
+
+    BOOST_CHECK_THROW( hydra.getSubConfigurationGradient( 0, 5 ), std::nested_exception );
+
+    // Updating the unknown vector refreshes the cache
+    floatVector unknownVector( 9 * numConfigurations + numNonLinearSolveStateVariables, 0 );
+
+    for ( unsigned int i = 0; i < unknownVector.size( ); i++ ){
+
+        unknownVector[ i ] = 0.1 * ( i % 7 ) + ( ( i % 9 ) % 4 == 0 ? 1 : 0 );
+
+    }
+
+    floatVector precedingConfiguration = hydra.getPrecedingConfiguration( 3 );
+
+    tardigradeHydra::unit_test::hydraBaseTester::updateUnknownVector( hydra, unknownVector );
+
+    BOOST_CHECK( !tardigradeVectorTools::fuzzyEquals( hydra.getPrecedingConfiguration( 3 ), precedingConfiguration ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPrecedingConfiguration( 3 ),
+                                                     hydra.getSubConfiguration( *hydra.getConfigurations( ), 0, 3 ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getFollowingConfigurationGradient( 0 ),
+                                                     hydra.getSubConfigurationGradient( *hydra.getConfigurations( ), 1, 4 ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_getSubConfigurationGradientFactors ){
+    /*!
+     * Test the factored form of the gradients of the sub-configurations
+     */
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    tardigradeHydra::hydraBase hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                            previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    floatMatrix A( 4, floatVector( 9, 0 ) );
+
+    for ( unsigned int r = 0; r < A.size( ); r++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            A[ r ][ i ] = 0.1 * ( ( 3 * r + 7 * i ) % 11 ) - 0.4;
+
+        }
+
+    }
+
+    for ( unsigned int lower = 0; lower <= numConfigurations; lower++ ){
+
+        for ( unsigned int upper = lower; upper <= numConfigurations; upper++ ){
+
+            tardigradeHydra::subConfigurationGradient gradient = hydra.getSubConfigurationGradientFactors( lower, upper );
+
+            floatMatrix dense = hydra.getSubConfigurationGradient( *hydra.getConfigurations( ), lower, upper );
+
+            BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( gradient.toDense( ), dense ) );
+
+            floatMatrix result;
+
+            gradient.leftMultiply( A, result );
+
+            BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( result, tardigradeVectorTools::dot( A, dense ) ) );
+
+            tardigradeHydra::subConfigurationGradient previousGradient = hydra.getPreviousSubConfigurationGradientFactors( lower, upper );
+
+            BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( previousGradient.toDense( ), hydra.getSubConfigurationGradient( *hydra.getPreviousConfigurations( ), lower, upper ) ) );
+
+        }
+
+    }
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPrecedingConfigurationGradientFactors( 2 ).toDense( ), hydra.getPrecedingConfigurationGradient( 2 ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getFollowingConfigurationGradientFactors( 1 ).toDense( ), hydra.getFollowingConfigurationGradient( 1 ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousPrecedingConfigurationGradientFactors( 2 ).toDense( ), hydra.getPreviousPrecedingConfigurationGradient( 2 ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousFollowingConfigurationGradientFactors( 1 ).toDense( ), hydra.getPreviousFollowingConfigurationGradient( 1 ) ) );
+
+    BOOST_CHECK_THROW( hydra.getSubConfigurationGradientFactors( 3, 2 ), std::nested_exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_computeFirstConfigurationGradients ){
+    /*!
+     * Test the fixed-size kernel of the gradients of the first configuration against the general implementation
+     */
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    tardigradeHydra::hydraBase hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                            previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    tardigradeHydra::subConfigurationGradient dFscdFs = hydra.getFollowingConfigurationGradientFactors( 0 );
+
+    floatMatrix dF1dF, dF1dFn;
+
+    tardigradeHydra::computeFirstConfigurationGradients( deformationGradient, dFscdFs, dF1dF, dF1dFn );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dF1dF, *hydra.getdF1dF( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dF1dFn, *hydra.getdF1dFn( ) ) );
+
+    floatVector flatdF1dF( 81 ), flatdF1dFn( 81 * ( numConfigurations - 1 ) );
+
+    tardigradeHydra::computeFixedSizeFirstConfigurationGradients< 3 >( deformationGradient.data( ), dFscdFs, flatdF1dF.data( ), flatdF1dFn.data( ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( flatdF1dF, tardigradeVectorTools::appendVectors( dF1dF ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( flatdF1dFn, tardigradeVectorTools::appendVectors( dF1dFn ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_getPreviousSubConfiguration ){
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    tardigradeHydra::hydraBase hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                            previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousSubConfiguration( 0, 4 ), *hydra.getPreviousDeformationGradient( ) ) );
+
+    floatVector answer1 = { 2.24332648, 1.48246714, 2.02801682,
+                            1.50380989, 2.98203598, 2.08079721,
+                            1.58939152, 1.2551092 , 2.38201794 };
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousSubConfiguration( 1, 3 ), answer1 ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_getPreviousPrecedingConfiguration ){
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
 
     floatType previousTemperature = 23.4;
 
@@ -2194,21 +2864,19 @@ BOOST_AUTO_TEST_CASE( test_residualBase_setAdditionalDerivatives ){
 
 }
 
-BOOST_AUTO_TEST_CASE( test_residualBase_setCauchyStress ){
+BOOST_AUTO_TEST_CASE( test_residualBase_setFlatJacobian ){
 
     class residualBaseMock : public tardigradeHydra::residualBase{
 
         public:
 
-            using tardigradeHydra::residualBase::setCauchyStress;
-
-            floatVector cauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+            floatVector jacobian = { 1, 2, 3, 4, 5, 6 };
 
             residualBaseMock( tardigradeHydra::hydraBase *hydra, unsigned int numEquations ) : residualBase( hydra, numEquations ){ }
     
-            virtual void setCauchyStress( ){
+            virtual void setJacobian( ){
     
-                setCauchyStress( cauchyStress );
+                setFlatJacobian( jacobian );
     
             }
 
@@ -2216,29 +2884,31 @@ BOOST_AUTO_TEST_CASE( test_residualBase_setCauchyStress ){
 
     tardigradeHydra::hydraBase hydra;
 
-    unsigned int numEquations = 3;
+    unsigned int numEquations = 2;
 
     residualBaseMock residual( &hydra, numEquations );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getCauchyStress( ), residual.cauchyStress ) );
+    floatMatrix answer = { { 1, 2, 3 }, { 4, 5, 6 } };
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getFlatJacobian( ), residual.jacobian ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getJacobian( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_residualBase_setPreviousCauchyStress ){
+BOOST_AUTO_TEST_CASE( test_residualBase_setFlatdRdF ){
 
     class residualBaseMock : public tardigradeHydra::residualBase{
 
         public:
 
-            using tardigradeHydra::residualBase::setPreviousCauchyStress;
-
-            floatVector previousCauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+            floatVector dRdF = { 1, 2, 3, 4, 5, 6 };
 
             residualBaseMock( tardigradeHydra::hydraBase *hydra, unsigned int numEquations ) : residualBase( hydra, numEquations ){ }
     
-            virtual void setPreviousCauchyStress( ){
+            virtual void setdRdF( ){
     
-                setPreviousCauchyStress( previousCauchyStress );
+                setFlatdRdF( dRdF );
     
             }
 
@@ -2246,29 +2916,31 @@ BOOST_AUTO_TEST_CASE( test_residualBase_setPreviousCauchyStress ){
 
     tardigradeHydra::hydraBase hydra;
 
-    unsigned int numEquations = 3;
+    unsigned int numEquations = 2;
 
     residualBaseMock residual( &hydra, numEquations );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getPreviousCauchyStress( ), residual.previousCauchyStress ) );
+    floatMatrix answer = { { 1, 2, 3 }, { 4, 5, 6 } };
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getFlatdRdF( ), residual.dRdF ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getdRdF( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_residualBase_setCurrentAdditionalStateVariables ){
+BOOST_AUTO_TEST_CASE( test_residualBase_setFlatAdditionalDerivatives ){
 
     class residualBaseMock : public tardigradeHydra::residualBase{
 
         public:
 
-            using tardigradeHydra::residualBase::setCurrentAdditionalStateVariables;
-
-            floatVector currentAdditionalStateVariables = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+            floatVector additionalDerivatives = { 1, 2, 3, 4, 5, 6 };
 
             residualBaseMock( tardigradeHydra::hydraBase *hydra, unsigned int numEquations ) : residualBase( hydra, numEquations ){ }
     
-            virtual void setCurrentAdditionalStateVariables( ){
+            virtual void setAdditionalDerivatives( ){
     
-                setCurrentAdditionalStateVariables( currentAdditionalStateVariables );
+                setFlatAdditionalDerivatives( additionalDerivatives );
     
             }
 
@@ -2276,41 +2948,135 @@ BOOST_AUTO_TEST_CASE( test_residualBase_setCurrentAdditionalStateVariables ){
 
     tardigradeHydra::hydraBase hydra;
 
-    unsigned int numEquations = 3;
+    unsigned int numEquations = 2;
 
     residualBaseMock residual( &hydra, numEquations );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getCurrentAdditionalStateVariables( ), residual.currentAdditionalStateVariables ) );
+    floatMatrix answer = { { 1, 2, 3 }, { 4, 5, 6 } };
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getFlatAdditionalDerivatives( ), residual.additionalDerivatives ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getAdditionalDerivatives( ), answer ) );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_setResidualClasses ){
+BOOST_AUTO_TEST_CASE( test_residualBase_setCauchyStress ){
 
-    class hydraBaseMock : public tardigradeHydra::hydraBase{
+    class residualBaseMock : public tardigradeHydra::residualBase{
 
         public:
 
-            tardigradeHydra::residualBase r1;
-        
-            tardigradeHydra::residualBase r2;
-        
-            tardigradeHydra::residualBase r3;
+            using tardigradeHydra::residualBase::setCauchyStress;
 
-            unsigned int s1 = 36;
+            floatVector cauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 
-            unsigned int s2 = 2;
+            residualBaseMock( tardigradeHydra::hydraBase *hydra, unsigned int numEquations ) : residualBase( hydra, numEquations ){ }
+    
+            virtual void setCauchyStress( ){
+    
+                setCauchyStress( cauchyStress );
+    
+            }
 
-            unsigned int s3 = 3;
+    };
 
-            using tardigradeHydra::hydraBase::hydraBase;
+    tardigradeHydra::hydraBase hydra;
 
-            using tardigradeHydra::hydraBase::setResidualClasses;
+    unsigned int numEquations = 3;
 
-            virtual void setResidualClasses( ){
+    residualBaseMock residual( &hydra, numEquations );
 
-                r1 = tardigradeHydra::residualBase( this, s1 );
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getCauchyStress( ), residual.cauchyStress ) );
 
-                r2 = tardigradeHydra::residualBase( this, s2 );
+}
+
+BOOST_AUTO_TEST_CASE( test_residualBase_setPreviousCauchyStress ){
+
+    class residualBaseMock : public tardigradeHydra::residualBase{
+
+        public:
+
+            using tardigradeHydra::residualBase::setPreviousCauchyStress;
+
+            floatVector previousCauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+            residualBaseMock( tardigradeHydra::hydraBase *hydra, unsigned int numEquations ) : residualBase( hydra, numEquations ){ }
+    
+            virtual void setPreviousCauchyStress( ){
+    
+                setPreviousCauchyStress( previousCauchyStress );
+    
+            }
+
+    };
+
+    tardigradeHydra::hydraBase hydra;
+
+    unsigned int numEquations = 3;
+
+    residualBaseMock residual( &hydra, numEquations );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getPreviousCauchyStress( ), residual.previousCauchyStress ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_residualBase_setCurrentAdditionalStateVariables ){
+
+    class residualBaseMock : public tardigradeHydra::residualBase{
+
+        public:
+
+            using tardigradeHydra::residualBase::setCurrentAdditionalStateVariables;
+
+            floatVector currentAdditionalStateVariables = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+            residualBaseMock( tardigradeHydra::hydraBase *hydra, unsigned int numEquations ) : residualBase( hydra, numEquations ){ }
+    
+            virtual void setCurrentAdditionalStateVariables( ){
+    
+                setCurrentAdditionalStateVariables( currentAdditionalStateVariables );
+    
+            }
+
+    };
+
+    tardigradeHydra::hydraBase hydra;
+
+    unsigned int numEquations = 3;
+
+    residualBaseMock residual( &hydra, numEquations );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *residual.getCurrentAdditionalStateVariables( ), residual.currentAdditionalStateVariables ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_setResidualClasses ){
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase{
+
+        public:
+
+            tardigradeHydra::residualBase r1;
+        
+            tardigradeHydra::residualBase r2;
+        
+            tardigradeHydra::residualBase r3;
+
+            unsigned int s1 = 36;
+
+            unsigned int s2 = 2;
+
+            unsigned int s3 = 3;
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                r1 = tardigradeHydra::residualBase( this, s1 );
+
+                r2 = tardigradeHydra::residualBase( this, s2 );
 
                 r3 = tardigradeHydra::residualBase( this, s3 );
 
@@ -2679,26 +3445,16 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_formNonLinearProblem ){
 
 }
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_initializeUnknownVector ){
+BOOST_AUTO_TEST_CASE( test_hydraBase_formNonLinearResidual ){
 
     class residualBaseMock : public tardigradeHydra::residualBase{
 
         public:
 
-            unsigned int numVariables = 41;
-
             using tardigradeHydra::residualBase::residualBase;
 
             using tardigradeHydra::residualBase::setResidual;
 
-            using tardigradeHydra::residualBase::setJacobian;
-
-            using tardigradeHydra::residualBase::setdRdF;
-
-            using tardigradeHydra::residualBase::setdRdT;
-
-            using tardigradeHydra::residualBase::setAdditionalDerivatives;
-
             virtual void setResidual( ){
 
                 floatVector residual( *getNumEquations( ), 0 );
@@ -2715,79 +3471,25 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_initializeUnknownVector ){
 
             virtual void setJacobian( ){
 
-                floatMatrix jacobian( *getNumEquations( ), floatVector( numVariables, 0 ) );
-
-                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
-
-                    for ( unsigned int j = 0; j < numVariables; j++ ){
-
-                        jacobian[ i ][ j ] = i + 0.1 * j;
-
-                    }
-
-                }
-
-                setJacobian( jacobian );
+                throw std::runtime_error( "The jacobian should not be requested" );
 
             }
 
             virtual void setdRdF( ){
 
-                floatMatrix dRdF( *getNumEquations( ), floatVector( 9, 0 ) );
-
-                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
-
-                    for ( unsigned int j = 0; j < 9; j++ ){
-
-                        dRdF[ i ][ j ] = i - 0.1 * j;
-
-                    }
-
-                }
-
-                setdRdF( dRdF );
+                throw std::runtime_error( "dRdF should not be requested" );
 
             }
 
             virtual void setdRdT( ){
 
-                floatVector dRdT( *getNumEquations( ), 0 );
-
-                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
-
-                    dRdT[ i ] = 0.3 * i;
-
-                }
-
-                setdRdT( dRdT );
+                throw std::runtime_error( "dRdT should not be requested" );
 
             }
 
-    };
-
-    class residualBaseMockStress : public residualBaseMock{
-
-        public:
-
-            floatVector cauchyStress = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9 };
-
-            using residualBaseMock::residualBaseMock;
-
-            using residualBaseMock::setResidual;
-
-            using residualBaseMock::setJacobian;
-
-            using residualBaseMock::setdRdF;
-
-            using residualBaseMock::setdRdT;
-
-            using residualBaseMock::setAdditionalDerivatives;
-
-            using tardigradeHydra::residualBase::setCauchyStress;
-
-            virtual void setCauchyStress( ){
+            virtual void setAdditionalDerivatives( ){
 
-                setCauchyStress( cauchyStress );
+                throw std::runtime_error( "The additional derivatives should not be requested" );
 
             }
 
@@ -2797,7 +3499,7 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_initializeUnknownVector ){
 
         public:
 
-            residualBaseMockStress r1;
+            residualBaseMock r1;
         
             residualBaseMock r2;
         
@@ -2815,7 +3517,7 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_initializeUnknownVector ){
 
             virtual void setResidualClasses( ){
 
-                r1 = residualBaseMockStress( this, s1 );
+                r1 = residualBaseMock( this, s1 );
 
                 r2 = residualBaseMock( this, s2 );
 
@@ -2871,102 +3573,144 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_initializeUnknownVector ){
     hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
                          previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
 
-    hydra.setResidualClasses( );
+    hydraBaseMock hydraGet( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                            previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
 
-    tardigradeHydra::unit_test::hydraBaseTester::initializeUnknownVector( hydra );
+    hydraGet.setResidualClasses( );
 
-    floatVector unknownVectorAnswer = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9,
-                                        1.53155137, 0.53182759, 0.63440096, 0.84943179, 1.72445532, 0.61102351, 0.72244338, 0.32295891, 1.36178866,
-                                        1.22826323, 0.29371405, 0.63097612, 0.09210494, 1.43370117, 0.43086276, 0.4936851 , 0.42583029, 1.31226122,
-                                        1.42635131, 0.89338916, 0.94416002, 0.50183668, 1.62395295, 0.1156184 , 0.31728548, 0.41482621, 1.86630916,
-                                        0.25045537, 0.48303426, 0.98555979, 0.51948512, 0.61289453 };
-                                         
+    floatVector residualAnswer = tardigradeVectorTools::appendVectors( { *hydraGet.r1.getResidual( ),
+                                                                         *hydraGet.r2.getResidual( ),
+                                                                         *hydraGet.r3.getResidual( ) } );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( unknownVectorAnswer, *hydra.getUnknownVector( ) ) );
+    tardigradeHydra::unit_test::hydraBaseTester::formNonLinearResidual( hydra );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( residualAnswer, *hydra.getResidual( ) ) );
+
+    BOOST_CHECK( !tardigradeHydra::unit_test::hydraBaseTester::get_jacobianIsSet( hydra ) );
+
+    BOOST_CHECK_THROW( hydra.getFlatJacobian( ), std::nested_exception );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_setTolerance ){
+BOOST_AUTO_TEST_CASE( test_hydraBase_formNonLinearJacobian ){
 
-    class hydraBaseMock : public tardigradeHydra::hydraBase {
+    class residualBaseMock : public tardigradeHydra::residualBase{
 
         public:
 
-            using tardigradeHydra::hydraBase::hydraBase;
+            using tardigradeHydra::residualBase::residualBase;
 
-    };
+            unsigned int numVariables = 41;
 
-    floatType time = 1.1;
+            using tardigradeHydra::residualBase::setResidual;
 
-    floatType deltaTime = 2.2;
+            using tardigradeHydra::residualBase::setJacobian;
 
-    floatType temperature = 5.3;
+            virtual void setResidual( ){
 
-    floatType previousTemperature = 23.4;
+                floatVector residual( *getNumEquations( ), 0 );
 
-    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
-                                        0.10262954,  0.43893794, -0.15378708,
-                                        0.9615284 ,  0.36965948, -0.0381362 };
+                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
 
-    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
-                                                -0.12285551, -0.88064421, -0.20391149,
-                                                 0.47599081, -0.63501654, -0.64909649 };
+                    residual[ i ] = i;
 
-    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
-                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
-                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
-                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
-                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
-                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
-                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
-                                           0.54506801, 0.34276383, 0.30412079 }; 
+                }
 
-    floatVector parameters = { 1, 2, 3, 4, 5 };
+                setResidual( residual );
 
-    unsigned int numConfigurations = 4;
+            }
 
-    unsigned int numNonLinearSolveStateVariables = 5;
+            virtual void setJacobian( ){
 
-    unsigned int dimension = 3;
+                floatMatrix jacobian( *getNumEquations( ), floatVector( numVariables, 0 ) );
 
-    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
-                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
 
-    floatVector residual = { 1, 2, -3, 0 };
+                    for ( unsigned int j = 0; j < numVariables; j++ ){
 
-    floatVector unknownVector = { -2, 5, 10, 0.3 };
+                        jacobian[ i ][ j ] = i + 0.1 * j;
 
-    floatVector toleranceAnswer = 1e-9 * (tardigradeVectorTools::abs( residual ) + tardigradeVectorTools::abs( unknownVector )) + 1e-9;
+                    }
 
-    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+                }
 
-    tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( hydra, unknownVector );
+                setJacobian( jacobian );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getTolerance( ), toleranceAnswer ) );
+            }
 
-}
+            virtual void setdRdF( ){
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_checkConvergence ){
+                throw std::runtime_error( "dRdF should not be requested" );
 
-    class hydraBaseMock : public tardigradeHydra::hydraBase {
+            }
 
-        public:
+            virtual void setdRdT( ){
 
-            using tardigradeHydra::hydraBase::hydraBase;
+                throw std::runtime_error( "dRdT should not be requested" );
 
-    };
+            }
 
-    floatType time = 1.1;
+            virtual void setAdditionalDerivatives( ){
 
-    floatType deltaTime = 2.2;
+                throw std::runtime_error( "The additional derivatives should not be requested" );
 
-    floatType temperature = 5.3;
+            }
 
-    floatType previousTemperature = 23.4;
+    };
 
-    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
-                                        0.10262954,  0.43893794, -0.15378708,
-                                        0.9615284 ,  0.36965948, -0.0381362 };
+    class hydraBaseMock : public tardigradeHydra::hydraBase{
+
+        public:
+
+            residualBaseMock r1;
+        
+            residualBaseMock r2;
+        
+            residualBaseMock r3;
+
+            unsigned int s1 = 36;
+
+            unsigned int s2 = 2;
+
+            unsigned int s3 = 3;
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                r1 = residualBaseMock( this, s1 );
+
+                r2 = residualBaseMock( this, s2 );
+
+                r3 = residualBaseMock( this, s3 );
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 3 );
+
+                residuals[ 0 ] = &r1;
+
+                residuals[ 1 ] = &r2;
+
+                residuals[ 2 ] = &r3;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
 
     floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
                                                 -0.12285551, -0.88064421, -0.20391149,
@@ -2992,443 +3736,564 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_checkConvergence ){
     hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
                          previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
 
-    floatVector residual = { 1, 2, -3, 0 };
+    hydraBaseMock hydraGet( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                            previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
 
-    floatVector unknownVector = { -2, 5, 10, 0.3 };
+    hydraGet.setResidualClasses( );
 
-    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+    floatVector jacobianAnswer = tardigradeVectorTools::appendVectors( { tardigradeVectorTools::appendVectors( *hydraGet.r1.getJacobian( ) ),
+                                                                         tardigradeVectorTools::appendVectors( *hydraGet.r2.getJacobian( ) ),
+                                                                         tardigradeVectorTools::appendVectors( *hydraGet.r3.getJacobian( ) ) } );
 
-    tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( hydra, unknownVector );
+    BOOST_CHECK( *hydra.getDerivativeRequest( ) == tardigradeHydra::derivativeRequest::all );
 
-    BOOST_CHECK( !hydra.checkConvergence( ) );
+    tardigradeHydra::unit_test::hydraBaseTester::formNonLinearJacobian( hydra );
 
-    residual = { 0, 2, -3, 0 };
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( jacobianAnswer, *hydra.getFlatJacobian( ) ) );
+
+    BOOST_CHECK_THROW( hydra.getFlatdRdF( ), std::nested_exception );
+
+    BOOST_CHECK_THROW( hydra.getdRdT( ), std::nested_exception );
+
+    BOOST_CHECK_THROW( hydra.getFlatAdditionalDerivatives( ), std::nested_exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_getJacobianFactorization ){
+
+    tardigradeHydra::hydraBase hydra;
+
+    floatVector residual = { 6, 10, 8 };
+
+    floatVector jacobian = { 4, 1, 0,
+                             1, 3, 1,
+                             0, 1, 2 };
+
+    floatVector answer = { 1, 2, 3 };
 
     tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
 
-    BOOST_CHECK( !hydra.checkConvergence( ) );
+    tardigradeHydra::unit_test::hydraBaseTester::set_flatJacobian( hydra, jacobian );
 
-    residual = { 0, 0, 0, 0 };
+    const tardigradeHydra::jacobianFactorization *factorization = hydra.getJacobianFactorization( );
+
+    floatVector result( residual.size( ), 0 );
+
+    Eigen::Map< Eigen::Matrix< floatType, -1, 1 > >( result.data( ), result.size( ) )
+        = factorization->solve( Eigen::Map< const Eigen::Matrix< floatType, -1, 1 > >( residual.data( ), residual.size( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( result, answer ) );
+
+    tardigradeHydra::unit_test::hydraBaseTester::resetIterationData( hydra );
+
+    floatVector singularJacobian = { 1, 2, 3,
+                                     2, 4, 6,
+                                     0, 1, 2 };
 
     tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
 
-    BOOST_CHECK( hydra.checkConvergence( ) );
+    tardigradeHydra::unit_test::hydraBaseTester::set_flatJacobian( hydra, singularJacobian );
+
+    BOOST_CHECK_THROW( hydra.getJacobianFactorization( ), std::nested_exception );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_getLSResidualNorm ){
+BOOST_AUTO_TEST_CASE( test_jacobianFactorization_compute ){
 
-    tardigradeHydra::hydraBase hydra;
+    floatVector jacobian = { 4, 1, 2,
+                             1, 3, 1,
+                             0, 0,-1 };
 
-    floatVector residual = { 1, 2, 3 };
+    floatVector rhs = { 6, 10, -3 };
 
-    floatType lsResidualNormAnswer = tardigradeVectorTools::l2norm( residual );
-      tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+    floatVector answer = { -7. / 11, 28. / 11, 3 };
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getLSResidualNorm( ), lsResidualNormAnswer ) );
+    floatVector result( rhs.size( ), 0 );
 
-}
+    tardigradeHydra::jacobianFactorization condensed;
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_checkLSConvergence ){
+    condensed.compute( jacobian, 3, { 2 }, { 2 } );
 
-    class hydraBaseMock : public tardigradeHydra::hydraBase {
+    BOOST_CHECK( condensed.getNumCondensedUnknowns( ) == 1 );
 
-        public:
+    Eigen::Map< Eigen::Matrix< floatType, -1, 1 > >( result.data( ), result.size( ) )
+        = condensed.solve( Eigen::Map< const Eigen::Matrix< floatType, -1, 1 > >( rhs.data( ), rhs.size( ) ) );
 
-            using tardigradeHydra::hydraBase::hydraBase;
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( result, answer ) );
 
-    };
+    // The equation doesn't have the form of an explicit equation so the full jacobian is factored
+    tardigradeHydra::jacobianFactorization full;
 
-    floatType time = 1.1;
+    full.compute( jacobian, 3, { 1 }, { 1 } );
 
-    floatType deltaTime = 2.2;
+    BOOST_CHECK( full.getNumCondensedUnknowns( ) == 0 );
 
-    floatType temperature = 5.3;
+    Eigen::Map< Eigen::Matrix< floatType, -1, 1 > >( result.data( ), result.size( ) )
+        = full.solve( Eigen::Map< const Eigen::Matrix< floatType, -1, 1 > >( rhs.data( ), rhs.size( ) ) );
 
-    floatType previousTemperature = 23.4;
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( result, answer ) );
 
-    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
-                                        0.10262954,  0.43893794, -0.15378708,
-                                        0.9615284 ,  0.36965948, -0.0381362 };
+}
 
-    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
-                                                -0.12285551, -0.88064421, -0.20391149,
-                                                 0.47599081, -0.63501654, -0.64909649 };
+BOOST_AUTO_TEST_CASE( test_jacobianFactorization_compute_blockElimination ){
 
-    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
-                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
-                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
-                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
-                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
-                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
-                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
-                                           0.54506801, 0.34276383, 0.30412079 }; 
+    // An arrowhead jacobian where the first three blocks are only coupled to the last block
+    std::vector< unsigned int > blockSizes = { 2, 2, 2, 2 };
 
-    floatVector parameters = { 1, 2, 3, 4, 5 };
+    std::vector< bool > blockSparsity = { true, false, false,  true,
+                                         false,  true, false,  true,
+                                         false, false,  true,  true,
+                                          true,  true,  true,  true };
 
-    unsigned int numConfigurations = 4;
+    floatVector jacobian = { 5, 1, 0, 0, 0, 0, 1, 2,
+                             1, 6, 0, 0, 0, 0, 0, 1,
+                             0, 0, 7, 2, 0, 0, 2, 0,
+                             0, 0, 1, 5, 0, 0, 1, 1,
+                             0, 0, 0, 0, 4, 1, 0, 2,
+                             0, 0, 0, 0, 2, 8, 1, 0,
+                             1, 0, 2, 1, 0, 1, 9, 1,
+                             2, 1, 0, 1, 1, 0, 2, 7 };
 
-    unsigned int numNonLinearSolveStateVariables = 5;
+    floatVector rhs = { 1, 2, 3, 4, 5, 6, 7, 8 };
 
-    unsigned int dimension = 3;
+    Eigen::Map< const tardigradeHydra::floatRowMajorMatrix > J( jacobian.data( ), 8, 8 );
 
-    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
-                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+    Eigen::Map< const Eigen::Matrix< floatType, -1, 1 > > b( rhs.data( ), rhs.size( ) );
 
-    floatVector residual = { 1, 2, -3, 0 };
+    Eigen::Matrix< floatType, -1, 1 > answer = J.partialPivLu( ).solve( b );
 
-    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+    tardigradeHydra::jacobianFactorization blocked;
 
-    BOOST_CHECK( !hydra.checkLSConvergence( ) );
+    blocked.compute( jacobian, 8, { }, { }, blockSizes, blockSparsity );
 
-    residual = { 0.1, 2, -3, 0 };
+    BOOST_CHECK( blocked.usesBlockElimination( ) );
 
-    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+    BOOST_CHECK( blocked.solve( b ).isApprox( answer ) );
 
-    BOOST_CHECK( hydra.checkLSConvergence( ) );
+    // Multiple right hand sides
+    tardigradeHydra::floatRowMajorMatrix B( 8, 2 );
 
-}
+    B.col( 0 ) = b;
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_getPreviousCauchyStress ){
+    B.col( 1 ) = 2 * b;
 
+    tardigradeHydra::floatRowMajorMatrix X = blocked.solve( B );
 
-    class residualMockGood : public tardigradeHydra::residualBase {
+    BOOST_CHECK( X.col( 0 ).isApprox( answer ) );
 
-        public:
+    BOOST_CHECK( X.col( 1 ).isApprox( 2 * answer ) );
 
-            using tardigradeHydra::residualBase::residualBase;
+    // The declared sparsity doesn't match the jacobian so the dense factorization is used
+    floatVector coupledJacobian = jacobian;
 
-            floatVector previousCauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    coupledJacobian[ 8 * 0 + 2 ] = 1;
 
-        private:
+    tardigradeHydra::jacobianFactorization dense;
 
-            virtual void setPreviousCauchyStress( ){
+    dense.compute( coupledJacobian, 8, { }, { }, blockSizes, blockSparsity );
 
-                tardigradeHydra::residualBase::setPreviousCauchyStress( previousCauchyStress );
+    BOOST_CHECK( !dense.usesBlockElimination( ) );
 
-            }
+    Eigen::Map< const tardigradeHydra::floatRowMajorMatrix > coupledJ( coupledJacobian.data( ), 8, 8 );
 
-    };
+    BOOST_CHECK( dense.solve( b ).isApprox( coupledJ.partialPivLu( ).solve( b ) ) );
 
-    class hydraBaseMock : public tardigradeHydra::hydraBase {
+    // The estimate of the reciprocal condition number follows Eigen's
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dense.rcond( ), coupledJ.partialPivLu( ).rcond( ) ) );
 
-        public:
+    // The solution may be written into a caller provided buffer
+    Eigen::Matrix< floatType, -1, 1 > x( 8 );
 
-            residualMockGood residual1;
+    dense.solve( b, x );
 
-            tardigradeHydra::residualBase residual2;
+    BOOST_CHECK( x.isApprox( coupledJ.partialPivLu( ).solve( b ) ) );
 
-            tardigradeHydra::residualBase remainder;
+}
 
-            using tardigradeHydra::hydraBase::hydraBase;
+BOOST_AUTO_TEST_CASE( test_jacobianFactorization_compute_symmetricStress ){
 
-            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+    // A jacobian of a symmetric stress and three additional unknowns
+    const unsigned int numUnknowns = 12;
 
-                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+    floatVector jacobian( numUnknowns * numUnknowns, 0 );
 
-            }
+    for ( unsigned int i = 0; i < numUnknowns; i++ ){
 
-        private:
+        for ( unsigned int j = 0; j < numUnknowns; j++ ){
 
-            virtual void setResidualClasses( ){
+            jacobian[ numUnknowns * i + j ] = std::sin( 1.3 * i + 0.7 * j + 0.1 ) + ( ( i == j ) ? 5 : 0 );
 
-                std::vector< tardigradeHydra::residualBase* > residuals( 3 );
+        }
 
-                residual1 = residualMockGood( this, 9 );
+    }
 
-                residual2 = tardigradeHydra::residualBase( this, 9 );
+    // A non-symmetric pair of stress equations can't be reduced so the full jacobian is factored
+    floatVector nonSymmetricAnswer = { 1.0, 0.2, 0.3,
+                                       0.7, 2.0, 0.4,
+                                      -0.3, 0.9, 3.0,
+                                      -1.0, 0.5, 2.5 };
 
-                remainder = tardigradeHydra::residualBase( this, 3 );
+    Eigen::Map< const tardigradeHydra::floatRowMajorMatrix > nonSymmetricJ( jacobian.data( ), numUnknowns, numUnknowns );
 
-                residuals[ 0 ] = &residual1;
+    Eigen::Map< const Eigen::Matrix< floatType, -1, 1 > > nonSymmetricX( nonSymmetricAnswer.data( ), numUnknowns );
 
-                residuals[ 1 ] = &residual2;
+    Eigen::Matrix< floatType, -1, 1 > nonSymmetricB = nonSymmetricJ * nonSymmetricX;
 
-                residuals[ 2 ] = &remainder;
+    tardigradeHydra::jacobianFactorization nonSymmetric;
 
-                setResidualClasses( residuals );
+    nonSymmetric.compute( jacobian, numUnknowns, { }, { }, { 9, 3 }, { true, true, true, true }, true );
 
-            }
+    BOOST_CHECK( !nonSymmetric.usesSymmetricStress( ) );
 
-    };
+    BOOST_CHECK( nonSymmetric.solve( nonSymmetricB ).isApprox( nonSymmetricX ) );
 
-    floatType time = 1.1;
+    // The equation of each lower stress component is its upper component's equation with the stress transposed
+    constexpr unsigned int transpose[ 9 ] = { 0, 3, 6, 1, 4, 7, 2, 5, 8 };
 
-    floatType deltaTime = 2.2;
+    for ( unsigned int i = 0; i < 9; i++ ){
 
-    floatType temperature = 300.0;
+        if ( transpose[ i ] < i ){
 
-    floatType previousTemperature = 320.4;
+            for ( unsigned int j = 0; j < numUnknowns; j++ ){
 
-    floatVector deformationGradient = { 1.1, 0.1, 0.0,
-                                        0.0, 1.0, 0.0,
-                                        0.0, 0.0, 1.0 };
+                jacobian[ numUnknowns * i + j ] = jacobian[ numUnknowns * transpose[ i ] + ( ( j < 9 ) ? transpose[ j ] : j ) ];
 
-    floatVector previousDeformationGradient = { 1.0, 0.0, 0.0,
-                                                0.0, 1.0, 0.0,
-                                                0.0, 0.0, 1.0 };
+            }
 
-    floatVector previousStateVariables = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0.01, 0.02, 0.03 };
+        }
 
-    floatVector parameters = { 123.4, 56.7, 293.15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    }
 
-    floatVector unknownVector = { 1, 1, 1, 1, 1, 1, 1, 1, 1,
-                                  1.2, 0.0, 0.0,
-                                  0.0, 1.0, 0.0,
-                                  0.0, 0.0, 1.0,
-                                  4, 5, 6 };
+    floatVector answer = { 1.0, 0.2, 0.3,
+                           0.2, 2.0, 0.4,
+                           0.3, 0.4, 3.0,
+                           -1.0, 0.5, 2.5 };
 
-    unsigned int numConfigurations = 2;
+    Eigen::Map< const tardigradeHydra::floatRowMajorMatrix > J( jacobian.data( ), numUnknowns, numUnknowns );
 
-    unsigned int numNonLinearSolveStateVariables = 3;
+    Eigen::Map< const Eigen::Matrix< floatType, -1, 1 > > x( answer.data( ), numUnknowns );
 
-    unsigned int dimension = 3;
+    Eigen::Matrix< floatType, -1, 1 > b = J * x;
 
-    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
-                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+    tardigradeHydra::jacobianFactorization symmetric;
 
-    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    symmetric.compute( jacobian, numUnknowns, { }, { }, { 9, 3 }, { true, true, true, true }, true );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( answer, *hydra.getPreviousCauchyStress( ) ) );
+    BOOST_CHECK( symmetric.usesSymmetricStress( ) );
 
-}
+    BOOST_CHECK( symmetric.solve( b ).isApprox( x ) );
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_decomposeUnknownVector ){
+    // Explicit stress equations are condensed out of the reduced system
+    floatVector explicitJacobian = jacobian;
 
-    class hydraBaseMock : public tardigradeHydra::hydraBase {
+    for ( unsigned int i = 0; i < 9; i++ ){
 
-        public:
+        for ( unsigned int j = 0; j < numUnknowns; j++ ){
 
-            using tardigradeHydra::hydraBase::hydraBase;
+            explicitJacobian[ numUnknowns * i + j ] = ( i == j ) ? -1 : 0;
 
-    };
+        }
 
-    floatType time = 1.1;
+    }
 
-    floatType deltaTime = 2.2;
+    Eigen::Map< const tardigradeHydra::floatRowMajorMatrix > explicitJ( explicitJacobian.data( ), numUnknowns, numUnknowns );
 
-    floatType temperature = 5.3;
+    b = explicitJ * x;
 
-    floatType previousTemperature = 23.4;
+    tardigradeHydra::jacobianFactorization condensed;
 
-    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
-                                        0.10262954,  0.43893794, -0.15378708,
-                                        0.9615284 ,  0.36965948, -0.0381362 };
+    condensed.compute( explicitJacobian, numUnknowns, { 0, 1, 2, 3, 4, 5, 6, 7, 8 }, { 0, 1, 2, 3, 4, 5, 6, 7, 8 }, { }, { }, true );
 
-    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
-                                                -0.12285551, -0.88064421, -0.20391149,
-                                                 0.47599081, -0.63501654, -0.64909649 };
+    BOOST_CHECK( condensed.usesSymmetricStress( ) );
 
-    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
-                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
-                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
-                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
-                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
-                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
-                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
-                                           0.54506801, 0.34276383, 0.30412079 }; 
+    BOOST_CHECK( condensed.getNumCondensedUnknowns( ) == 6 );
 
-    floatVector parameters = { 1, 2, 3, 4, 5 };
+    BOOST_CHECK( condensed.solve( b ).isApprox( x ) );
 
-    unsigned int numConfigurations = 4;
+}
 
-    unsigned int numNonLinearSolveStateVariables = 5;
+BOOST_AUTO_TEST_CASE( test_dataStorage_bindToEpoch ){
 
-    unsigned int dimension = 3;
+    unsigned long long epoch = 3;
 
-    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
-                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+    tardigradeHydra::dataStorage< floatVector > data( true, { 1, 2, 3 } );
 
-    floatVector unknownVector = { -0.15564097, -0.82143154, -0.27568448, -0.86079836,  0.07935105,
-                                   0.14494499,  0.24999455,  0.43334209, -0.56655812, -0.30347709,
-                                  -0.6423031 ,  0.31882307, -0.40934079, -0.68385209, -0.93550481,
-                                   0.87222402, -0.44175239, -0.65098503, -0.70008955, -0.42273504,
-                                   0.28778728,  0.04507432,  0.90587052, -0.23518004,  0.1069888 ,
-                                  -0.63207718, -0.3026225 ,  0.21407967,  0.2462129 ,  0.62193457,
-                                   0.88751802, -0.06915571,  0.81058704,  0.87534601,  0.58086916,
-                                   0.68175081,  0.7558753 ,  0.90210319, -0.15050147, -0.83735103,
-                                  -0.8684919 };
+    tardigradeHydra::dataStorage< floatVector > unbound( true, { 4, 5 } );
 
-    floatVector cauchyStressAnswer = { -0.15564097, -0.82143154, -0.27568448, -0.86079836,  0.07935105,
-                                        0.14494499,  0.24999455,  0.43334209, -0.56655812 };
+    data.bindToEpoch( &epoch );
 
-    floatMatrix configurationsAnswer = {  { -2.51323148, -2.34583945,  1.64112676,  0.66198512,  1.02970651,  0.93612154, -1.30632269,  0.42502445,  2.20594616 },
-                                          { -0.30347709, -0.6423031 ,  0.31882307, -0.40934079, -0.68385209, -0.93550481,  0.87222402, -0.44175239, -0.65098503 },
-                                          { -0.70008955, -0.42273504,  0.28778728,  0.04507432,  0.90587052, -0.23518004,  0.1069888 , -0.63207718, -0.3026225  },
-                                          {  0.21407967,  0.2462129 ,  0.62193457,  0.88751802, -0.06915571,  0.81058704,  0.87534601,  0.58086916,  0.68175081 } };
+    BOOST_CHECK( data.first );
 
-    floatVector isvAnswer = { 0.7558753 ,  0.90210319, -0.15050147, -0.83735103, -0.8684919 };
+    epoch++;
 
-    tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( hydra, unknownVector );
+    BOOST_CHECK( !data.first );
 
-    tardigradeHydra::unit_test::hydraBaseTester::decomposeUnknownVector( hydra );
+    BOOST_CHECK( unbound.first );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getCauchyStress( ), cauchyStressAnswer ) );
+    // The storage is retained for re-use
+    BOOST_CHECK( data.second.capacity( ) >= 3 );
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getConfigurations( ), configurationsAnswer ) );
+    data.first = true;
 
-    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getNonLinearSolveStateVariables( ), isvAnswer ) );
+    BOOST_CHECK( data.first );
+
+    epoch++;
+
+    BOOST_CHECK( !data.first );
 
 }
 
-BOOST_AUTO_TEST_CASE( test_hydraBase_solveNonLinearProblem ){
+BOOST_AUTO_TEST_CASE( test_histogram ){
 
-    class hydraBaseMock : public tardigradeHydra::hydraBase {
+    tardigradeHydra::histogram h;
 
-        public:
+    BOOST_CHECK( tardigradeHydra::histogram::getBin( 0 ) == 0 );
 
-            using tardigradeHydra::hydraBase::hydraBase;
+    BOOST_CHECK( tardigradeHydra::histogram::getBin( 1 ) == 1 );
 
-            floatVector initialUnknownVector = { 1, 2, 3 };
+    BOOST_CHECK( tardigradeHydra::histogram::getBin( 3 ) == 2 );
 
-            std::vector< unsigned int > numLSIterations = { 1, 2, 1, 3 };
+    BOOST_CHECK( tardigradeHydra::histogram::getBin( 4 ) == 3 );
 
-            std::vector< std::vector< floatVector > > residual = {
-                                                                     {
-                                                                       { 1, 2, 3 } 
-                                                                     },
-                                                                     { 
-                                                                       { 4, 5, 6 },
-                                                                       { 7, 8, 9 }
-                                                                     },
-                                                                     { 
-                                                                       { 10, 9, 8 }
-                                                                     },
-                                                                     { 
-                                                                       { 7, 6, 5 },
-                                                                       { 4, 3, 2 },
-                                                                       { 1, 1, 1 }
-                                                                     },
-                                                                 };
+    h.addValue( 0 );
 
-            std::vector< std::vector< floatVector > > flatJacobian = {
-                                                                         {
-                                                                           {  0.99951474, -0.18854971, -0.59377647,  0.73798389,  0.50649978,
-                                                                             -0.24789123, -0.32889876, -0.60029673, -0.14211995 } 
-                                                                         },
-                                                                         { 
-                                                                           {  0.39531964, -0.92103617,  0.15529267, -0.88403283, -0.29325643,
-                                                                              0.33220876, -0.86852642,  0.29966728,  0.83480685 },
-                                                                           { -0.52407245,  0.35366894,  0.08551378,  0.70688925, -0.14848006,
-                                                                              0.24923792,  0.67051005, -0.08228108,  0.65747464 }
-                                                                         },
-                                                                         { 
-                                                                           { -0.81643355,  0.85279545, -0.18966435, -0.42616781,  0.53676336,
-                                                                             -0.92714295, -0.624413  ,  0.09900722, -0.01636474 }
-                                                                         },
-                                                                         { 
-                                                                           { -0.2448239 ,  0.74837591,  0.68140055, -0.14194502,  0.67937811,
-                                                                             -0.28307126,  0.01624776,  0.02491045, -0.39841209 },
-                                                                           { -0.65594132, -0.44378971, -0.43630527,  0.13856471,  0.95333808,
-                                                                             -0.89484459, -0.26311552, -0.94030312,  0.69678361 },
-                                                                           { -0.82400549, -0.05626004, -0.17170742,  0.34131108,  0.49817018,
-                                                                             -0.78483747,  0.95727384,  0.23324588, -0.22667228 }
-                                                                         },
-                                                                     };
+    h.addValue( 5 );
 
-            std::vector< std::vector< floatVector > > expectedXVectors = {
-                                                                             {
-                                                                               { 17.15005309, -9.55454694, 35.53888217 } 
-                                                                             },
-                                                                             { 
-                                                                               { 18.95259726, -5.57445709, 28.79822658 },
-                                                                               { 18.05132518, -7.56450202, 32.16855437 }
-                                                                             },
-                                                                             { 
-                                                                               { 31.01502518, -5.8216338 , 36.92596115 }
-                                                                             },
-                                                                             { 
-                                                                               { 407.30865444,  77.76786468,  70.0478993  },
-                                                                               { 219.16183981,  35.97311544,  53.48693023 },
-                                                                               { 125.0884325 ,  15.07574082,  45.20644569 }
-                                                                             },
-                                                                         };
+    h.addValue( 6 );
 
-        private:
+    tardigradeHydra::histogram other;
 
-            using tardigradeHydra::hydraBase::getResidual;
+    other.addValue( 1 );
 
-            virtual void initializeUnknownVector( ){
+    h.merge( other );
 
-                tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( *this, initialUnknownVector );
+    std::vector< unsigned long long > answer = { 1, 1, 0, 2 };
 
-                tardigradeHydra::unit_test::hydraBaseTester::set_residual( *this, residual[ 0 ][ 0 ] );
+    BOOST_CHECK( *h.getBins( ) == answer );
 
-                tardigradeHydra::unit_test::hydraBaseTester::set_flatJacobian( *this, flatJacobian[ 0 ][ 0 ] );
+    BOOST_CHECK( *h.getCount( ) == 4 );
 
-            }
+    BOOST_CHECK( *h.getSum( ) == 12 );
 
-            virtual bool checkConvergence( ){
+    BOOST_CHECK( *h.getMinimum( ) == 0 );
 
-                unsigned int iteration = tardigradeHydra::unit_test::hydraBaseTester::get_iteration( *this );
+    BOOST_CHECK( *h.getMaximum( ) == 6 );
 
-                if ( iteration < residual.size( ) ){
+    std::stringstream stream;
 
-                    return false;
+    h.write( stream );
+
+    BOOST_CHECK( stream.str( ) == "count 4 sum 12 min 0 max 6 bins 1 1 0 2" );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_solveStatistics ){
+
+    tardigradeHydra::solveStatistics statistics;
+
+    statistics.addSolve( true, 3, 1, 10 );
+
+    statistics.setResidualName( 1, "elasticity" );
+
+    statistics.addResidualTime( 1, tardigradeHydra::residualStage::jacobian, 100 );
+
+    tardigradeHydra::solveStatistics other;
+
+    other.addSolve( false, 20, 7, 30 );
+
+    other.setResidualName( 2, "plasticity" );
+
+    other.addResidualTime( 2, tardigradeHydra::residualStage::residual, 50 );
+
+    BOOST_CHECK_THROW( other.addResidualTime( 0, tardigradeHydra::residualStage::numStages, 50 ), std::nested_exception );
+
+    BOOST_CHECK_THROW( other.addResidualTime( 3, tardigradeHydra::residualStage::residual, 50 ), std::nested_exception );
+
+    statistics.merge( other );
+
+    BOOST_CHECK( *statistics.getNumSolves( ) == 2 );
+
+    BOOST_CHECK( *statistics.getNumFailedSolves( ) == 1 );
+
+    BOOST_CHECK( *statistics.getIterations( )->getSum( ) == 23 );
+
+    BOOST_CHECK( *statistics.getLineSearchIterations( )->getMaximum( ) == 7 );
+
+    BOOST_CHECK( *statistics.getAllocations( )->getMinimum( ) == 10 );
+
+    BOOST_CHECK( statistics.getResidualTimes( )->size( ) == 3 );
+
+    BOOST_CHECK( ( *statistics.getResidualNames( ) )[ 2 ] == "plasticity" );
+
+    BOOST_CHECK( *( *statistics.getResidualTimes( ) )[ 1 ][ tardigradeHydra::residualStage::jacobian ].getSum( ) == 100 );
+
+    BOOST_CHECK( *( *statistics.getResidualTimes( ) )[ 2 ][ tardigradeHydra::residualStage::residual ].getCount( ) == 1 );
+
+    unsigned long long initialCount = tardigradeHydra::solveStatistics::getAllocationCount( );
+
+    tardigradeHydra::solveStatistics::countAllocation( );
+
+    BOOST_CHECK( tardigradeHydra::solveStatistics::getAllocationCount( ) == initialCount + 1 );
+
+    std::stringstream stream;
+
+    statistics.write( stream );
+
+    BOOST_CHECK( stream.str( ).find( "residual 2 plasticity residual time (ns) count 1 sum 50" ) != std::string::npos );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_initializeUnknownVector ){
+
+    class residualBaseMock : public tardigradeHydra::residualBase{
+
+        public:
+
+            unsigned int numVariables = 41;
+
+            using tardigradeHydra::residualBase::residualBase;
+
+            using tardigradeHydra::residualBase::setResidual;
+
+            using tardigradeHydra::residualBase::setJacobian;
+
+            using tardigradeHydra::residualBase::setdRdF;
+
+            using tardigradeHydra::residualBase::setdRdT;
+
+            using tardigradeHydra::residualBase::setAdditionalDerivatives;
+
+            virtual void setResidual( ){
+
+                floatVector residual( *getNumEquations( ), 0 );
+
+                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
+
+                    residual[ i ] = i;
 
                 }
 
-                return true;
+                setResidual( residual );
 
             }
 
-            virtual bool checkLSConvergence( ){
+            virtual void setJacobian( ){
 
-                unsigned int iteration = tardigradeHydra::unit_test::hydraBaseTester::get_iteration( *this );
+                floatMatrix jacobian( *getNumEquations( ), floatVector( numVariables, 0 ) );
 
-                unsigned int LSIteration = tardigradeHydra::unit_test::hydraBaseTester::get_LSIteration( *this );
+                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
 
-                getResidual( );
+                    for ( unsigned int j = 0; j < numVariables; j++ ){
 
-                if ( LSIteration < residual[ iteration ].size( ) - 1 ){
+                        jacobian[ i ][ j ] = i + 0.1 * j;
 
-                    return false;
+                    }
 
                 }
 
-                return true;
+                setJacobian( jacobian );
 
             }
 
-            virtual void formNonLinearProblem( ){
-
-                unsigned int iteration = tardigradeHydra::unit_test::hydraBaseTester::get_iteration( *this );
+            virtual void setdRdF( ){
 
-                unsigned int LSIteration = tardigradeHydra::unit_test::hydraBaseTester::get_LSIteration( *this );
+                floatMatrix dRdF( *getNumEquations( ), floatVector( 9, 0 ) );
 
-                unsigned int iterationOffset = 0;
+                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
 
-                unsigned int LSoffset = 0;
+                    for ( unsigned int j = 0; j < 9; j++ ){
 
-                if ( LSIteration < residual[ iteration ].size( ) - 1 ){
+                        dRdF[ i ][ j ] = i - 0.1 * j;
 
-                    LSoffset += 1;
+                    }
 
                 }
-                else if ( iteration < residual.size( ) - 1 ){
 
-                    iterationOffset += 1;
-                    LSIteration = 0;
+                setdRdF( dRdF );
+
+            }
+
+            virtual void setdRdT( ){
+
+                floatVector dRdT( *getNumEquations( ), 0 );
+
+                for ( unsigned int i = 0; i < *getNumEquations( ); i++ ){
+
+                    dRdT[ i ] = 0.3 * i;
 
                 }
 
-                tardigradeHydra::unit_test::hydraBaseTester::set_residual( *this, residual[ iteration + iterationOffset ][ LSIteration + LSoffset ] );
+                setdRdT( dRdT );
 
-                tardigradeHydra::unit_test::hydraBaseTester::set_flatJacobian( *this, flatJacobian[ iteration + iterationOffset ][ LSIteration + LSoffset ] );
+            }
+
+    };
+
+    class residualBaseMockStress : public residualBaseMock{
+
+        public:
+
+            floatVector cauchyStress = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9 };
+
+            using residualBaseMock::residualBaseMock;
+
+            using residualBaseMock::setResidual;
+
+            using residualBaseMock::setJacobian;
+
+            using residualBaseMock::setdRdF;
+
+            using residualBaseMock::setdRdT;
+
+            using residualBaseMock::setAdditionalDerivatives;
+
+            using tardigradeHydra::residualBase::setCauchyStress;
+
+            virtual void setCauchyStress( ){
+
+                setCauchyStress( cauchyStress );
 
             }
 
-            virtual void updateUnknownVector( const floatVector &newUnknownVector ){
+    };
 
-                tardigradeHydra::unit_test::hydraBaseTester::resetIterationData( *this );
+    class hydraBaseMock : public tardigradeHydra::hydraBase{
 
-                unsigned int iteration = tardigradeHydra::unit_test::hydraBaseTester::get_iteration( *this );
+        public:
 
-                unsigned int LSIteration = tardigradeHydra::unit_test::hydraBaseTester::get_LSIteration( *this );
+            residualBaseMockStress r1;
+        
+            residualBaseMock r2;
+        
+            residualBaseMock r3;
 
-                BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( expectedXVectors[ iteration ][ LSIteration ], newUnknownVector ) );
+            unsigned int s1 = 36;
 
-                tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( *this, newUnknownVector );
+            unsigned int s2 = 2;
+
+            unsigned int s3 = 3;
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                r1 = residualBaseMockStress( this, s1 );
+
+                r2 = residualBaseMock( this, s2 );
+
+                r3 = residualBaseMock( this, s3 );
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 3 );
+
+                residuals[ 0 ] = &r1;
+
+                residuals[ 1 ] = &r2;
+
+                residuals[ 2 ] = &r3;
+
+                setResidualClasses( residuals );
 
             }
 
@@ -3459,18 +4324,1040 @@ BOOST_AUTO_TEST_CASE( test_hydraBase_solveNonLinearProblem ){
                                            0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
                                            0.54506801, 0.34276383, 0.30412079 }; 
 
-    floatVector parameters = { 1, 2, 3, 4, 5 };
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    hydra.setResidualClasses( );
+
+    tardigradeHydra::unit_test::hydraBaseTester::initializeUnknownVector( hydra );
+
+    floatVector unknownVectorAnswer = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9,
+                                        1.53155137, 0.53182759, 0.63440096, 0.84943179, 1.72445532, 0.61102351, 0.72244338, 0.32295891, 1.36178866,
+                                        1.22826323, 0.29371405, 0.63097612, 0.09210494, 1.43370117, 0.43086276, 0.4936851 , 0.42583029, 1.31226122,
+                                        1.42635131, 0.89338916, 0.94416002, 0.50183668, 1.62395295, 0.1156184 , 0.31728548, 0.41482621, 1.86630916,
+                                        0.25045537, 0.48303426, 0.98555979, 0.51948512, 0.61289453 };
+                                         
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( unknownVectorAnswer, *hydra.getUnknownVector( ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_setTolerance ){
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    floatVector residual = { 1, 2, -3, 0 };
+
+    floatVector unknownVector = { -2, 5, 10, 0.3 };
+
+    floatVector toleranceAnswer = 1e-9 * (tardigradeVectorTools::abs( residual ) + tardigradeVectorTools::abs( unknownVector )) + 1e-9;
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( hydra, unknownVector );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getTolerance( ), toleranceAnswer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_checkConvergence ){
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    floatVector residual = { 1, 2, -3, 0 };
+
+    floatVector unknownVector = { -2, 5, 10, 0.3 };
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( hydra, unknownVector );
+
+    BOOST_CHECK( !hydra.checkConvergence( ) );
+
+    residual = { 0, 2, -3, 0 };
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+
+    BOOST_CHECK( !hydra.checkConvergence( ) );
+
+    residual = { 0, 0, 0, 0 };
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+
+    BOOST_CHECK( hydra.checkConvergence( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_getLSResidualNorm ){
+
+    tardigradeHydra::hydraBase hydra;
+
+    floatVector residual = { 1, 2, 3 };
+
+    floatType lsResidualNormAnswer = tardigradeVectorTools::l2norm( residual );
+      tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getLSResidualNorm( ), lsResidualNormAnswer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_checkLSConvergence ){
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    floatVector residual = { 1, 2, -3, 0 };
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+
+    BOOST_CHECK( !hydra.checkLSConvergence( ) );
+
+    residual = { 0.1, 2, -3, 0 };
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_residual( hydra, residual );
+
+    BOOST_CHECK( hydra.checkLSConvergence( ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_getPreviousCauchyStress ){
+
+
+    class residualMockGood : public tardigradeHydra::residualBase {
+
+        public:
+
+            using tardigradeHydra::residualBase::residualBase;
+
+            floatVector previousCauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+        private:
+
+            virtual void setPreviousCauchyStress( ){
+
+                tardigradeHydra::residualBase::setPreviousCauchyStress( previousCauchyStress );
+
+            }
+
+    };
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            residualMockGood residual1;
+
+            tardigradeHydra::residualBase residual2;
+
+            tardigradeHydra::residualBase remainder;
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+
+                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+
+            }
+
+        private:
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 3 );
+
+                residual1 = residualMockGood( this, 9 );
+
+                residual2 = tardigradeHydra::residualBase( this, 9 );
+
+                remainder = tardigradeHydra::residualBase( this, 3 );
+
+                residuals[ 0 ] = &residual1;
+
+                residuals[ 1 ] = &residual2;
+
+                residuals[ 2 ] = &remainder;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 300.0;
+
+    floatType previousTemperature = 320.4;
+
+    floatVector deformationGradient = { 1.1, 0.1, 0.0,
+                                        0.0, 1.0, 0.0,
+                                        0.0, 0.0, 1.0 };
+
+    floatVector previousDeformationGradient = { 1.0, 0.0, 0.0,
+                                                0.0, 1.0, 0.0,
+                                                0.0, 0.0, 1.0 };
+
+    floatVector previousStateVariables = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0.01, 0.02, 0.03 };
+
+    floatVector parameters = { 123.4, 56.7, 293.15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+    floatVector unknownVector = { 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                                  1.2, 0.0, 0.0,
+                                  0.0, 1.0, 0.0,
+                                  0.0, 0.0, 1.0,
+                                  4, 5, 6 };
+
+    unsigned int numConfigurations = 2;
+
+    unsigned int numNonLinearSolveStateVariables = 3;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    floatVector answer = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( answer, *hydra.getPreviousCauchyStress( ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_decomposeUnknownVector ){
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    floatVector unknownVector = { -0.15564097, -0.82143154, -0.27568448, -0.86079836,  0.07935105,
+                                   0.14494499,  0.24999455,  0.43334209, -0.56655812, -0.30347709,
+                                  -0.6423031 ,  0.31882307, -0.40934079, -0.68385209, -0.93550481,
+                                   0.87222402, -0.44175239, -0.65098503, -0.70008955, -0.42273504,
+                                   0.28778728,  0.04507432,  0.90587052, -0.23518004,  0.1069888 ,
+                                  -0.63207718, -0.3026225 ,  0.21407967,  0.2462129 ,  0.62193457,
+                                   0.88751802, -0.06915571,  0.81058704,  0.87534601,  0.58086916,
+                                   0.68175081,  0.7558753 ,  0.90210319, -0.15050147, -0.83735103,
+                                  -0.8684919 };
+
+    floatVector cauchyStressAnswer = { -0.15564097, -0.82143154, -0.27568448, -0.86079836,  0.07935105,
+                                        0.14494499,  0.24999455,  0.43334209, -0.56655812 };
+
+    floatMatrix configurationsAnswer = {  { -2.51323148, -2.34583945,  1.64112676,  0.66198512,  1.02970651,  0.93612154, -1.30632269,  0.42502445,  2.20594616 },
+                                          { -0.30347709, -0.6423031 ,  0.31882307, -0.40934079, -0.68385209, -0.93550481,  0.87222402, -0.44175239, -0.65098503 },
+                                          { -0.70008955, -0.42273504,  0.28778728,  0.04507432,  0.90587052, -0.23518004,  0.1069888 , -0.63207718, -0.3026225  },
+                                          {  0.21407967,  0.2462129 ,  0.62193457,  0.88751802, -0.06915571,  0.81058704,  0.87534601,  0.58086916,  0.68175081 } };
+
+    floatVector isvAnswer = { 0.7558753 ,  0.90210319, -0.15050147, -0.83735103, -0.8684919 };
+
+    tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( hydra, unknownVector );
+
+    tardigradeHydra::unit_test::hydraBaseTester::decomposeUnknownVector( hydra );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getCauchyStress( ), cauchyStressAnswer ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getConfigurations( ), configurationsAnswer ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydra.getNonLinearSolveStateVariables( ), isvAnswer ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_solveNonLinearProblem ){
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector initialUnknownVector = { 1, 2, 3 };
+
+            std::vector< unsigned int > numLSIterations = { 1, 2, 1, 3 };
+
+            std::vector< std::vector< floatVector > > residual = {
+                                                                     {
+                                                                       { 1, 2, 3 } 
+                                                                     },
+                                                                     { 
+                                                                       { 4, 5, 6 },
+                                                                       { 7, 8, 9 }
+                                                                     },
+                                                                     { 
+                                                                       { 10, 9, 8 }
+                                                                     },
+                                                                     { 
+                                                                       { 7, 6, 5 },
+                                                                       { 4, 3, 2 },
+                                                                       { 1, 1, 1 }
+                                                                     },
+                                                                 };
+
+            std::vector< std::vector< floatVector > > flatJacobian = {
+                                                                         {
+                                                                           {  0.99951474, -0.18854971, -0.59377647,  0.73798389,  0.50649978,
+                                                                             -0.24789123, -0.32889876, -0.60029673, -0.14211995 } 
+                                                                         },
+                                                                         { 
+                                                                           {  0.39531964, -0.92103617,  0.15529267, -0.88403283, -0.29325643,
+                                                                              0.33220876, -0.86852642,  0.29966728,  0.83480685 },
+                                                                           { -0.52407245,  0.35366894,  0.08551378,  0.70688925, -0.14848006,
+                                                                              0.24923792,  0.67051005, -0.08228108,  0.65747464 }
+                                                                         },
+                                                                         { 
+                                                                           { -0.81643355,  0.85279545, -0.18966435, -0.42616781,  0.53676336,
+                                                                             -0.92714295, -0.624413  ,  0.09900722, -0.01636474 }
+                                                                         },
+                                                                         { 
+                                                                           { -0.2448239 ,  0.74837591,  0.68140055, -0.14194502,  0.67937811,
+                                                                             -0.28307126,  0.01624776,  0.02491045, -0.39841209 },
+                                                                           { -0.65594132, -0.44378971, -0.43630527,  0.13856471,  0.95333808,
+                                                                             -0.89484459, -0.26311552, -0.94030312,  0.69678361 },
+                                                                           { -0.82400549, -0.05626004, -0.17170742,  0.34131108,  0.49817018,
+                                                                             -0.78483747,  0.95727384,  0.23324588, -0.22667228 }
+                                                                         },
+                                                                     };
+
+            std::vector< std::vector< floatVector > > expectedXVectors = {
+                                                                             {
+                                                                               { 17.15005309, -9.55454694, 35.53888217 } 
+                                                                             },
+                                                                             { 
+                                                                               { 18.95259726, -5.57445709, 28.79822658 },
+                                                                               { 18.05132518, -7.56450202, 32.16855437 }
+                                                                             },
+                                                                             { 
+                                                                               { 31.01502518, -5.8216338 , 36.92596115 }
+                                                                             },
+                                                                             { 
+                                                                               { 407.30865444,  77.76786468,  70.0478993  },
+                                                                               { 219.16183981,  35.97311544,  53.48693023 },
+                                                                               { 125.0884325 ,  15.07574082,  45.20644569 }
+                                                                             },
+                                                                         };
+
+        private:
+
+            using tardigradeHydra::hydraBase::getResidual;
+
+            virtual void initializeUnknownVector( ){
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( *this, initialUnknownVector );
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_residual( *this, residual[ 0 ][ 0 ] );
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_flatJacobian( *this, flatJacobian[ 0 ][ 0 ] );
+
+            }
+
+            virtual bool checkConvergence( ){
+
+                unsigned int iteration = tardigradeHydra::unit_test::hydraBaseTester::get_iteration( *this );
+
+                if ( iteration < residual.size( ) ){
+
+                    return false;
+
+                }
+
+                return true;
+
+            }
+
+            virtual bool checkLSConvergence( ){
+
+                unsigned int iteration = tardigradeHydra::unit_test::hydraBaseTester::get_iteration( *this );
+
+                unsigned int LSIteration = tardigradeHydra::unit_test::hydraBaseTester::get_LSIteration( *this );
+
+                getResidual( );
+
+                if ( LSIteration < residual[ iteration ].size( ) - 1 ){
+
+                    return false;
+
+                }
+
+                return true;
+
+            }
+
+            virtual void formNonLinearResidual( ){
+
+                // The line search only requests the residual so the Jacobian for the next iteration is also set here
+
+                BOOST_CHECK( *getDerivativeRequest( ) == tardigradeHydra::derivativeRequest::jacobian );
+
+                unsigned int iteration = tardigradeHydra::unit_test::hydraBaseTester::get_iteration( *this );
+
+                unsigned int LSIteration = tardigradeHydra::unit_test::hydraBaseTester::get_LSIteration( *this );
+
+                unsigned int iterationOffset = 0;
+
+                unsigned int LSoffset = 0;
+
+                if ( LSIteration < residual[ iteration ].size( ) - 1 ){
+
+                    LSoffset += 1;
+
+                }
+                else if ( iteration < residual.size( ) - 1 ){
+
+                    iterationOffset += 1;
+                    LSIteration = 0;
+
+                }
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_residual( *this, residual[ iteration + iterationOffset ][ LSIteration + LSoffset ] );
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_flatJacobian( *this, flatJacobian[ iteration + iterationOffset ][ LSIteration + LSoffset ] );
+
+            }
+
+            virtual void updateUnknownVector( const floatVector &newUnknownVector ){
+
+                tardigradeHydra::unit_test::hydraBaseTester::resetIterationData( *this );
+
+                unsigned int iteration = tardigradeHydra::unit_test::hydraBaseTester::get_iteration( *this );
+
+                unsigned int LSIteration = tardigradeHydra::unit_test::hydraBaseTester::get_LSIteration( *this );
+
+                BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( expectedXVectors[ iteration ][ LSIteration ], newUnknownVector ) );
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( *this, newUnknownVector );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    hydra.setDerivativeRequest( tardigradeHydra::derivativeRequest::dRdF | tardigradeHydra::derivativeRequest::dRdT );
+
+    tardigradeHydra::unit_test::hydraBaseTester::solveNonLinearProblem( hydra );
+
+    BOOST_CHECK( *hydra.getDerivativeRequest( ) == ( tardigradeHydra::derivativeRequest::dRdF | tardigradeHydra::derivativeRequest::dRdT ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_solveNonLinearProblem_nonLinearSolvers ){
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector initialUnknownVector = { 0, 0, 0 };
+
+            floatVector A = { 4, 1, 0,
+                              1, 3, 1,
+                              0, 1, 2 };
+
+            floatVector b = { 1, 2, 3 };
+
+            floatType c = 0.1;
+
+            unsigned int numJacobianEvaluations = 0;
+
+        private:
+
+            virtual void initializeUnknownVector( ){
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( *this, initialUnknownVector );
+
+            }
+
+            virtual bool checkConvergence( ){
+
+                return tardigradeVectorTools::l2norm( *getResidual( ) ) < 1e-10;
+
+            }
+
+            virtual void formNonLinearResidual( ){
+
+                const floatVector *X = getUnknownVector( );
+
+                floatVector residual = -b;
+
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    for ( unsigned int j = 0; j < 3; j++ ){
+
+                        residual[ i ] += A[ 3 * i + j ] * ( *X )[ j ];
+
+                    }
+
+                    residual[ i ] += c * std::pow( ( *X )[ i ], 3 );
+
+                }
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_residual( *this, residual );
+
+            }
+
+            virtual void formNonLinearJacobian( ){
+
+                const floatVector *X = getUnknownVector( );
+
+                floatVector jacobian = A;
+
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    jacobian[ 3 * i + i ] += 3 * c * std::pow( ( *X )[ i ], 2 );
+
+                }
+
+                numJacobianEvaluations++;
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_flatJacobian( *this, jacobian );
+
+            }
+
+            virtual void updateUnknownVector( const floatVector &newUnknownVector ){
+
+                tardigradeHydra::unit_test::hydraBaseTester::resetIterationData( *this );
+
+                tardigradeHydra::unit_test::hydraBaseTester::set_unknownVector( *this, newUnknownVector );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { 0.53155137, 0.53182759, 0.63440096, 0.84943179, 0.72445532,
+                                           0.61102351, 0.72244338, 0.32295891, 0.36178866, 0.22826323,
+                                           0.29371405, 0.63097612, 0.09210494, 0.43370117, 0.43086276,
+                                           0.4936851 , 0.42583029, 0.31226122, 0.42635131, 0.89338916,
+                                           0.94416002, 0.50183668, 0.62395295, 0.1156184 , 0.31728548,
+                                           0.41482621, 0.86630916, 0.25045537, 0.48303426, 0.98555979,
+                                           0.51948512, 0.61289453, 0.12062867, 0.8263408 , 0.60306013,
+                                           0.54506801, 0.34276383, 0.30412079 }; 
+
+    floatVector parameters = { 1, 2, 3, 4, 5 };
+
+    unsigned int numConfigurations = 4;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock newton( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                          previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    hydraBaseMock modifiedNewton( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                                  previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    hydraBaseMock broyden( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                           previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    BOOST_CHECK( *newton.getNonLinearSolver( ) == tardigradeHydra::nonLinearSolver::newton );
+
+    BOOST_CHECK_THROW( newton.setNonLinearSolver( 3 ), std::nested_exception );
+
+    BOOST_CHECK_THROW( newton.setMaxJacobianAge( 0 ), std::nested_exception );
+
+    modifiedNewton.setNonLinearSolver( tardigradeHydra::nonLinearSolver::modifiedNewton );
+
+    modifiedNewton.setMaxJacobianAge( 10 );
+
+    broyden.setNonLinearSolver( tardigradeHydra::nonLinearSolver::broyden );
+
+    broyden.setMaxJacobianAge( 10 );
+
+    tardigradeHydra::unit_test::hydraBaseTester::solveNonLinearProblem( newton );
+
+    tardigradeHydra::unit_test::hydraBaseTester::solveNonLinearProblem( modifiedNewton );
+
+    tardigradeHydra::unit_test::hydraBaseTester::solveNonLinearProblem( broyden );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *newton.getUnknownVector( ), *modifiedNewton.getUnknownVector( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *newton.getUnknownVector( ), *broyden.getUnknownVector( ) ) );
+
+    BOOST_CHECK( *newton.getNumJacobianFactorizations( ) > 1 );
+
+    BOOST_CHECK( *modifiedNewton.getNumJacobianFactorizations( ) < *newton.getNumJacobianFactorizations( ) );
+
+    BOOST_CHECK( *broyden.getNumJacobianFactorizations( ) == 1 );
+
+    BOOST_CHECK( newton.numJacobianEvaluations == *newton.getNumJacobianFactorizations( ) );
+
+    BOOST_CHECK( modifiedNewton.numJacobianEvaluations == *modifiedNewton.getNumJacobianFactorizations( ) );
+
+    BOOST_CHECK( broyden.numJacobianEvaluations == 1 );
+
+    BOOST_CHECK( *newton.getNumIterations( ) == *newton.getNumJacobianFactorizations( ) );
+
+    BOOST_CHECK( *modifiedNewton.getNumIterations( ) >= *newton.getNumIterations( ) );
+
+#ifdef TARDIGRADE_HYDRA_SOLVE_STATISTICS
+    tardigradeHydra::solveStatistics statistics;
+
+    hydraBaseMock recorded( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                            previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    recorded.setSolveStatistics( &statistics );
+
+    recorded.evaluate( );
+
+    BOOST_CHECK( *statistics.getNumSolves( ) == 1 );
+
+    BOOST_CHECK( *statistics.getNumFailedSolves( ) == 0 );
+
+    BOOST_CHECK( *statistics.getIterations( )->getSum( ) == *newton.getNumIterations( ) );
+
+    // The residual classes are registered once and their names are not copied while timing
+    BOOST_CHECK( statistics.getResidualTimes( )->size( ) == recorded.getResidualClasses( )->size( ) );
+
+    BOOST_CHECK( !( *statistics.getResidualNames( ) )[ 0 ].empty( ) );
+
+    BOOST_CHECK( *( *statistics.getResidualTimes( ) )[ 0 ][ tardigradeHydra::residualStage::residual ].getCount( ) > 0 );
+#endif
+
+}
+
+BOOST_AUTO_TEST_CASE( test_workspaceArena ){
+
+    tardigradeHydra::workspaceArena arena;
+
+    // The first cycle spills over several blocks
+    floatType *a = arena.allocate( 10 );
+
+    floatType *b = arena.allocate( 100 );
+
+    floatType *c = arena.allocate( 1000 );
+
+    std::fill( a, a + 10, 1 );
+
+    std::fill( b, b + 100, 2 );
+
+    std::fill( c, c + 1000, 3 );
+
+    BOOST_CHECK( std::all_of( a, a + 10, [ ]( const floatType &v ){ return v == 1; } ) );
+
+    BOOST_CHECK( std::all_of( b, b + 100, [ ]( const floatType &v ){ return v == 2; } ) );
+
+    BOOST_CHECK( *arena.getSize( ) == 1110 );
+
+    BOOST_CHECK( *arena.getNumBlockAllocations( ) > 1 );
+
+    arena.reset( );
+
+    BOOST_CHECK( *arena.getSize( ) == 0 );
+
+    BOOST_CHECK( *arena.getHighWaterMark( ) == 1110 );
+
+    // The blocks are consolidated so that a cycle with the same demand does not allocate
+    const unsigned long long numBlockAllocations = *arena.getNumBlockAllocations( );
+
+    for ( unsigned int cycle = 0; cycle < 3; cycle++ ){
+
+        const unsigned long long initialAllocations = tardigradeHydra::solveStatistics::getAllocationCount( );
+
+        arena.allocate( 10 );
+
+        arena.allocate( 100 );
+
+        arena.allocate( 1000 );
+
+        BOOST_CHECK( tardigradeHydra::solveStatistics::getAllocationCount( ) == initialAllocations );
+
+        arena.reset( );
+
+    }
+
+    BOOST_CHECK( *arena.getNumBlockAllocations( ) == numBlockAllocations );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_iterationAllocations ){
+    /*!
+     * Test that the iterations of the non-linear solve do not allocate once the workspace has been sized. The
+     * residual and jacobian of the residual class are formed in place so any allocations are made by the assembly,
+     * decomposition, and solve of hydraBase. With glibc the allocations Eigen makes with malloc are counted too.
+     */
+
+    class residualMock : public tardigradeHydra::residualBase{
+
+        public:
+
+            using tardigradeHydra::residualBase::residualBase;
+
+            using tardigradeHydra::residualBase::setResidual;
+
+            floatVector b = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+            floatType c = 0.1;
+
+            floatVector residual = floatVector( 9, 0 );
+
+            floatVector jacobian = floatVector( 81, 0 );
+
+            std::vector< unsigned long long > allocationCounts;
+
+        private:
+
+            virtual void setResidual( ) override {
+
+                allocationCounts.push_back( tardigradeHydra::solveStatistics::getAllocationCount( ) );
+
+                const floatVector *X = hydra->getUnknownVector( );
+
+                for ( unsigned int i = 0; i < 9; i++ ){
+
+                    residual[ i ] = -b[ i ] + 4 * ( *X )[ i ] + c * std::pow( ( *X )[ i ], 3 );
+
+                    if ( i > 0 ){
+
+                        residual[ i ] += ( *X )[ i - 1 ];
+
+                    }
+
+                    if ( i < 8 ){
+
+                        residual[ i ] += ( *X )[ i + 1 ];
+
+                    }
+
+                }
+
+                setResidual( residual );
+
+            }
+
+            virtual void setJacobian( ) override {
+
+                const floatVector *X = hydra->getUnknownVector( );
+
+                std::fill( jacobian.begin( ), jacobian.end( ), 0 );
+
+                for ( unsigned int i = 0; i < 9; i++ ){
+
+                    jacobian[ 9 * i + i ] = 4 + 3 * c * std::pow( ( *X )[ i ], 2 );
+
+                    if ( i > 0 ){
+
+                        jacobian[ 9 * i + i - 1 ] = 1;
+
+                    }
+
+                    if ( i < 8 ){
+
+                        jacobian[ 9 * i + i + 1 ] = 1;
+
+                    }
+
+                }
+
+                setFlatJacobian( jacobian );
+
+            }
+
+    };
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            residualMock cubic;
+
+            floatVector initialUnknownVector = floatVector( 9, 0 );
+
+            virtual void setResidualClasses( ) override {
+
+                cubic = residualMock( this, 9 );
+
+                cubic.allocationCounts.reserve( 100 );
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 1 );
+
+                residuals[ 0 ] = &cubic;
+
+                setResidualClasses( residuals );
+
+            }
+
+        private:
+
+            virtual void initializeUnknownVector( ){
+
+                tardigradeHydra::unit_test::hydraBaseTester::updateUnknownVector( *this, initialUnknownVector );
+
+            }
+
+    };
+
+    floatVector deformationGradient = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector previousStateVariables = { };
+
+    floatVector parameters = { };
+
+    hydraBaseMock hydra( 1.1, 2.2, 5.3, 23.4, deformationGradient, deformationGradient,
+                         previousStateVariables, parameters, 1, 0 );
+
+    tardigradeHydra::unit_test::hydraBaseTester::solveNonLinearProblem( hydra );
+
+    // The first residual is formed before the jacobian and the workspace of the solve are sized
+    BOOST_REQUIRE( hydra.cubic.allocationCounts.size( ) > 3 );
+
+    for ( unsigned int i = 2; i < hydra.cubic.allocationCounts.size( ); i++ ){
+
+        BOOST_TEST( hydra.cubic.allocationCounts[ i ] == hydra.cubic.allocationCounts[ 1 ] );
+
+    }
+
+    BOOST_CHECK( *hydra.getSolveArena( )->getHighWaterMark( ) == 0 );
+
+    BOOST_CHECK( *hydra.getSolveArena( )->getSize( ) == 27 );
+
+    // The Broyden updates are written into a history which is drawn from the solve workspace
+    hydraBaseMock broyden( 1.1, 2.2, 5.3, 23.4, deformationGradient, deformationGradient,
+                           previousStateVariables, parameters, 1, 0 );
+
+    broyden.setNonLinearSolver( tardigradeHydra::nonLinearSolver::broyden );
+
+    broyden.setMaxJacobianAge( 3 );
 
-    unsigned int numConfigurations = 4;
+    tardigradeHydra::unit_test::hydraBaseTester::solveNonLinearProblem( broyden );
 
-    unsigned int numNonLinearSolveStateVariables = 5;
+    BOOST_REQUIRE( broyden.cubic.allocationCounts.size( ) > 3 );
 
-    unsigned int dimension = 3;
+    for ( unsigned int i = 2; i < broyden.cubic.allocationCounts.size( ); i++ ){
 
-    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
-                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+        BOOST_TEST( broyden.cubic.allocationCounts[ i ] == broyden.cubic.allocationCounts[ 1 ] );
 
-    tardigradeHydra::unit_test::hydraBaseTester::solveNonLinearProblem( hydra );
+    }
+
+    BOOST_TEST( *broyden.getSolveArena( )->getSize( ) == 27 + 2 * 3 * 9 );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *broyden.getUnknownVector( ), *hydra.getUnknownVector( ) ) );
 
 }
 
@@ -3606,3 +5493,431 @@ BOOST_AUTO_TEST_CASE( test_getConfiguration ){
     BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( hydra.getPreviousConfiguration( 3 ), ( *hydra.getPreviousConfigurations( ) )[ 3 ] ) );
 
 }
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_getdCauchyStressdF ){
+    /*!
+     * Boost test of the consistent tangent computed from the converged solution
+     */
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase{
+
+        public:
+
+            tardigradeHydra::linearElasticity::residual elasticity;
+
+            unsigned int elasticitySize = 9;
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                elasticity = tardigradeHydra::linearElasticity::residual( this, elasticitySize, *getParameters( ) );
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 1 );
+
+                residuals[ 0 ] = &elasticity;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 1.05, 0.02, 0.00,
+                                        0.01, 0.98, 0.03,
+                                        0.00, 0.10, 1.01 };
+
+    floatVector previousDeformationGradient = { 1, 0, 0,
+                                                0, 1, 0,
+                                                0, 0, 1 };
+
+    floatVector previousStateVariables = { };
+
+    floatVector parameters = { 123.4, 56.7 };
+
+    unsigned int numConfigurations = 1;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    BOOST_CHECK_NO_THROW( hydra.evaluate( ) );
+
+    floatMatrix dCauchyStressdF( deformationGradient.size( ), floatVector( deformationGradient.size( ), 0 ) );
+
+    floatVector dCauchyStressdT( deformationGradient.size( ), 0 );
+
+    floatType eps = 1e-6;
+
+    for ( unsigned int i = 0; i < deformationGradient.size( ); i++ ){
+
+        floatVector deltas( deformationGradient.size( ), 0 );
+
+        deltas[ i ] = eps * std::fabs( deformationGradient[ i ] ) + eps;
+
+        hydraBaseMock hydrap( time, deltaTime, temperature, previousTemperature, deformationGradient + deltas, previousDeformationGradient,
+                              previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+        hydraBaseMock hydram( time, deltaTime, temperature, previousTemperature, deformationGradient - deltas, previousDeformationGradient,
+                              previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+        hydrap.evaluate( );
+
+        hydram.evaluate( );
+
+        for ( unsigned int j = 0; j < deformationGradient.size( ); j++ ){
+
+            dCauchyStressdF[ j ][ i ] = ( ( *hydrap.getCauchyStress( ) )[ j ] - ( *hydram.getCauchyStress( ) )[ j ] ) / ( 2 * deltas[ i ] );
+
+        }
+
+    }
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dCauchyStressdF, *hydra.getdCauchyStressdF( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dCauchyStressdT, *hydra.getdCauchyStressdT( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dCauchyStressdF, hydra.getdXdF( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dCauchyStressdT, *hydra.getdXdT( ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_lockstep_tensorOperations ){
+    /*!
+     * Test the lockstep multiplication, inversion, and decomposition of the configurations
+     */
+
+    constexpr unsigned int W = 4;
+
+    floatMatrix A = { { 1.10, 0.20, 0.00, 0.10, 0.90, 0.30, 0.00, 0.10, 1.05 },
+                      { 1.00, 0.00, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                      { 0.95, 0.05, 0.10, 0.00, 1.02, 0.00, 0.20, 0.00, 0.98 },
+                      { 2.00, 1.00, 0.00, 1.00, 3.00, 1.00, 0.00, 1.00, 4.00 } };
+
+    floatMatrix B = { { 1.01, 0.02, 0.03, 0.00, 0.99, 0.01, 0.02, 0.00, 1.00 },
+                      { 0.50, 0.10, 0.00, 0.20, 0.70, 0.00, 0.00, 0.30, 0.90 },
+                      { 1.00, 0.00, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                      { 1.20, 0.00, 0.10, 0.00, 1.10, 0.00, 0.10, 0.00, 1.30 } };
+
+    floatVector laneA( 9 * W ), laneB( 9 * W ), laneC( 9 * W ), laneAinv( 9 * W ), determinant( W );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            laneA[ W * i + l ] = A[ l ][ i ];
+
+            laneB[ W * i + l ] = B[ l ][ i ];
+
+        }
+
+    }
+
+    tardigradeHydra::lockstep::multiply< W >( laneA.data( ), laneB.data( ), laneC.data( ) );
+
+    tardigradeHydra::lockstep::invert< W >( laneA.data( ), laneAinv.data( ), determinant.data( ) );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        floatVector C( 9 ), Ainv( 9 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            C[ i ] = laneC[ W * i + l ];
+
+            Ainv[ i ] = laneAinv[ W * i + l ];
+
+        }
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( C, tardigradeVectorTools::matrixMultiply( A[ l ], B[ l ], 3, 3, 3, 3, false, false ) ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( Ainv, tardigradeVectorTools::inverse( A[ l ], 3, 3 ) ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( determinant[ l ], tardigradeVectorTools::determinant( A[ l ], 3, 3 ) ) );
+
+    }
+
+    // F = F1 F2 F3 so F1 = F ( F2 F3 )^{-1}
+    const unsigned int numConfigurations = 3;
+
+    floatVector unknownVector( 9 * W * numConfigurations, 0 );
+
+    std::copy( laneA.begin( ), laneA.end( ), unknownVector.begin( ) + 9 * W );
+
+    std::copy( laneB.begin( ), laneB.end( ), unknownVector.begin( ) + 18 * W );
+
+    floatVector configurations( 9 * W * numConfigurations ), workspace( 27 * W );
+
+    tardigradeHydra::lockstep::decomposeUnknownVector< W >( numConfigurations, laneB.data( ), unknownVector.data( ), configurations.data( ), workspace.data( ) );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        floatVector F1( 9 ), F2( 9 ), F3( 9 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            F1[ i ] = configurations[ W * i + l ];
+
+            F2[ i ] = configurations[ 9 * W + W * i + l ];
+
+            F3[ i ] = configurations[ 18 * W + W * i + l ];
+
+        }
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( F2, A[ l ] ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( F3, B[ l ] ) );
+
+        floatVector F = tardigradeVectorTools::matrixMultiply( tardigradeVectorTools::matrixMultiply( F1, F2, 3, 3, 3, 3, false, false ), F3, 3, 3, 3, 3, false, false );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( F, B[ l ] ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_lockstep_solveLinearSystem ){
+    /*!
+     * Test the lockstep solution of linear systems with pivoting and inactive and singular lanes
+     */
+
+    constexpr unsigned int W = 4;
+
+    const unsigned int n = 4;
+
+    // The second lane requires pivoting, the third lane is singular, and the fourth lane is inactive
+    floatMatrix A = { {  4.0,  1.0,  0.0,  0.5,
+                         1.0,  3.0,  1.0,  0.0,
+                         0.0,  1.0,  5.0,  2.0,
+                         0.5,  0.0,  2.0,  6.0 },
+                      {  0.0,  2.0,  1.0,  0.0,
+                         3.0,  0.0,  0.0,  1.0,
+                         1.0,  1.0,  0.0,  4.0,
+                         0.0,  0.0,  2.0,  1.0 },
+                      {  1.0,  2.0,  3.0,  4.0,
+                         2.0,  4.0,  6.0,  8.0,
+                         0.0,  1.0,  0.0,  1.0,
+                         1.0,  0.0,  1.0,  0.0 },
+                      {  1.0,  0.0,  0.0,  0.0,
+                         0.0,  1.0,  0.0,  0.0,
+                         0.0,  0.0,  1.0,  0.0,
+                         0.0,  0.0,  0.0,  1.0 } };
+
+    floatMatrix b = { { 1, 2, 3, 4 }, { -1, 0.5, 2, 3 }, { 1, 1, 1, 1 }, { 7, 8, 9, 10 } };
+
+    floatVector laneA( n * n * W ), laneB( n * W );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        for ( unsigned int i = 0; i < n * n; i++ ){
+
+            laneA[ W * i + l ] = A[ l ][ i ];
+
+        }
+
+        for ( unsigned int i = 0; i < n; i++ ){
+
+            laneB[ W * i + l ] = b[ l ][ i ];
+
+        }
+
+    }
+
+    bool active[ W ] = { true, true, true, false };
+
+    tardigradeHydra::lockstep::solveLinearSystem< W >( n, laneA.data( ), laneB.data( ), active );
+
+    BOOST_CHECK( active[ 0 ] );
+
+    BOOST_CHECK( active[ 1 ] );
+
+    BOOST_CHECK( !active[ 2 ] );
+
+    BOOST_CHECK( !active[ 3 ] );
+
+    for ( unsigned int l = 0; l < 2; l++ ){
+
+        floatVector x( n );
+
+        for ( unsigned int i = 0; i < n; i++ ){
+
+            x[ i ] = laneB[ W * i + l ];
+
+        }
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( tardigradeVectorTools::matrixMultiply( A[ l ], x, n, n, n, 1, false, false ), b[ l ] ) );
+
+    }
+
+    // The right hand side of the inactive lane is unchanged
+    for ( unsigned int i = 0; i < n; i++ ){
+
+        BOOST_CHECK( laneB[ W * i + 3 ] == b[ 3 ][ i ] );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_lockstep_solveLinearSystem_relativePivot ){
+    /*!
+     * Test that the singularity of the lockstep linear systems is judged relative to the scale of the matrices
+     */
+
+    constexpr unsigned int W = 4;
+
+    const unsigned int n = 2;
+
+    const floatType eps = std::numeric_limits< floatType >::epsilon( );
+
+    // The first lane is well conditioned but tiny, the second and third lanes are singular to machine precision
+    // with different scales, and the fourth lane is well conditioned
+    floatMatrix A = { { 4e-20, 1e-20,
+                        1e-20, 3e-20 },
+                      { 1.0, 1.0,
+                        1.0, 1.0 + eps },
+                      { 1e20, 1e20,
+                        1e20, 1e20 * ( 1.0 + eps ) },
+                      { 4.0, 1.0,
+                        1.0, 3.0 } };
+
+    floatMatrix b = { { 1e-20, 2e-20 }, { 1, 2 }, { 1, 2 }, { 1, 2 } };
+
+    floatVector laneA( n * n * W ), laneB( n * W );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        for ( unsigned int i = 0; i < n * n; i++ ){
+
+            laneA[ W * i + l ] = A[ l ][ i ];
+
+        }
+
+        for ( unsigned int i = 0; i < n; i++ ){
+
+            laneB[ W * i + l ] = b[ l ][ i ];
+
+        }
+
+    }
+
+    bool active[ W ] = { true, true, true, true };
+
+    tardigradeHydra::lockstep::solveLinearSystem< W >( n, laneA.data( ), laneB.data( ), active );
+
+    BOOST_CHECK( active[ 0 ] );
+
+    BOOST_CHECK( !active[ 1 ] );
+
+    BOOST_CHECK( !active[ 2 ] );
+
+    BOOST_CHECK( active[ 3 ] );
+
+    // The scaled lane has the same solution as the unscaled one
+    for ( unsigned int i = 0; i < n; i++ ){
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( laneB[ W * i + 0 ], laneB[ W * i + 3 ] ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_lockstep_solve ){
+    /*!
+     * Test the lockstep Newton solve where the lanes converge after different numbers of iterations
+     */
+
+    constexpr unsigned int W = 4;
+
+    const unsigned int n = 2;
+
+    // x0^3 + x1 = a, x1^3 + x0 = b
+    floatVector a = { 2, 10, 1e-3, -30 };
+
+    floatVector b = { 2, 3, 0, 5 };
+
+    unsigned int numEvaluations = 0;
+
+    auto residual = [ & ]( const floatType *X, floatType *R, floatType *J ){
+
+        numEvaluations++;
+
+        for ( unsigned int l = 0; l < W; l++ ){
+
+            const floatType x0 = X[ W * 0 + l ], x1 = X[ W * 1 + l ];
+
+            R[ W * 0 + l ] = x0 * x0 * x0 + x1 - a[ l ];
+
+            R[ W * 1 + l ] = x1 * x1 * x1 + x0 - b[ l ];
+
+            J[ W * 0 + l ] = 3 * x0 * x0;
+
+            J[ W * 1 + l ] = 1;
+
+            J[ W * 2 + l ] = 1;
+
+            J[ W * 3 + l ] = 3 * x1 * x1;
+
+        }
+
+    };
+
+    floatVector X = { 1, 1, 0, 1,
+                      1, 1, 0, 1 };
+
+    bool converged[ W ];
+
+    unsigned int iterations[ W ];
+
+    floatVector workspace( tardigradeHydra::lockstep::solveWorkspaceSize< W >( n ) );
+
+    tardigradeHydra::lockstep::solve< W >( n, residual, X.data( ), 1e-12, 1e-12, 50, converged, iterations, workspace.data( ) );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        BOOST_CHECK( converged[ l ] );
+
+        const floatType x0 = X[ W * 0 + l ], x1 = X[ W * 1 + l ];
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( x0 * x0 * x0 + x1, a[ l ] ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( x1 * x1 * x1 + x0, b[ l ] ) );
+
+    }
+
+    // The first lane starts at the solution and is frozen immediately
+    BOOST_CHECK( iterations[ 0 ] == 0 );
+
+    BOOST_CHECK( X[ W * 0 + 0 ] == 1 );
+
+    BOOST_CHECK( iterations[ 1 ] > iterations[ 2 ] );
+
+    BOOST_CHECK( numEvaluations == *std::max_element( iterations, iterations + W ) + 1 );
+
+    // A lane which can't converge in the allowed iterations is reported
+    X = { 1, 1, 0, 1,
+          1, 1, 0, 1 };
+
+    // The workspace is re-used
+    tardigradeHydra::lockstep::solve< W >( n, residual, X.data( ), 1e-12, 1e-12, 2, converged, iterations, workspace.data( ) );
+
+    BOOST_CHECK( converged[ 0 ] );
+
+    BOOST_CHECK( !converged[ 3 ] );
+
+    BOOST_CHECK( iterations[ 3 ] == 2 );
+
+}
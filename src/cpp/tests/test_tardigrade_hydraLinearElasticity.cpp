@@ -57,15 +57,39 @@ namespace tardigradeHydra{
     
                         BOOST_CHECK( &R._dPK2StressdEe.second == R.getdPK2StressdEe( ) );
 
+                        BOOST_CHECK( &R._isotropicdPK2StressdEe.second == R.getIsotropicdPK2StressdEe( ) );
+
                         BOOST_CHECK( &R._dPK2StressdFe.second == R.getdPK2StressdFe( ) );
     
                         BOOST_CHECK( &R._dCauchyStressdPK2Stress.second == R.getdCauchyStressdPK2Stress( ) );
 
+                        BOOST_CHECK( &R._dCauchyStressdFe.second == R.getdCauchyStressdFe( ) );
+
                         BOOST_CHECK( &R._dCauchyStressdF.second == R.getdCauchyStressdF( ) );
     
                         BOOST_CHECK( &R._dCauchyStressdFn.second == R.getdCauchyStressdFn( ) );
     
                     }
+
+                    static void checkValueOnlyCauchyStress( tardigradeHydra::linearElasticity::residual &R ){
+
+                        R.getCauchyStress( );
+
+                        BOOST_CHECK( !R._dEedFe.first );
+
+                        BOOST_CHECK( !R._dPK2StressdEe.first );
+
+                        BOOST_CHECK( !R._dPK2StressdFe.first );
+
+                        BOOST_CHECK( !R._dCauchyStressdPK2Stress.first );
+
+                        BOOST_CHECK( !R._dCauchyStressdFe.first );
+
+                        BOOST_CHECK( !R._dCauchyStressdF.first );
+
+                        BOOST_CHECK( !R._dCauchyStressdFn.first );
+
+                    }
     
             };
     
@@ -568,6 +592,224 @@ BOOST_AUTO_TEST_CASE( test_residual_setdPK2StressdFe ){
 
     BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( gradient, *R.getdPK2StressdFe( ) ) );
 
+    // The default stiffness is applied through its structure and agrees with the expanded matrix
+    BOOST_CHECK( R.getIsotropicdPK2StressdEe( ) != NULL );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( tardigradeVectorTools::dot( *R.getdPK2StressdEe( ), *R.getdEedFe( ) ), *R.getdPK2StressdFe( ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_residual_setdPK2StressdFe_overriddenStiffness ){
+    /*!
+     * Test that the derivative of the second Piola-Kirchhoff stress w.r.t. the elastic deformation gradient uses
+     * the stiffness of a residual which overrides the gradient of the PK2 stress w.r.t. the elastic strain
+     */
+
+    class residualMock : public tardigradeHydra::linearElasticity::residual {
+
+        public:
+
+            using tardigradeHydra::linearElasticity::residual::residual;
+
+            floatMatrix stiffness = initializeStiffness( );
+
+        private:
+
+            static floatMatrix initializeStiffness( ){
+
+                floatMatrix C( 9, floatVector( 9, 0 ) );
+
+                for ( unsigned int i = 0; i < 9; i++ ){
+
+                    for ( unsigned int j = 0; j < 9; j++ ){
+
+                        C[ i ][ j ] = 0.1 * ( i + 1 ) + 0.01 * ( j + 1 ) * ( j + 1 );
+
+                    }
+
+                }
+
+                return C;
+
+            }
+
+            virtual void setdPK2StressdEe( ) override {
+
+                tardigradeHydra::linearElasticity::residual::setdPK2StressdEe( stiffness );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { };
+
+    floatVector parameters = { 123.4, 56.7 };
+
+    unsigned int numConfigurations = 1;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    tardigradeHydra::hydraBase hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                                      previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    residualMock R( &hydra, 9, parameters );
+
+    BOOST_CHECK( R.getIsotropicdPK2StressdEe( ) == NULL );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( R.stiffness, *R.getdPK2StressdEe( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( tardigradeVectorTools::dot( R.stiffness, *R.getdEedFe( ) ), *R.getdPK2StressdFe( ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_residual_setdPK2StressdFe_overriddenEe ){
+    /*!
+     * Test that the derivative of the second Piola-Kirchhoff stress w.r.t. the elastic deformation gradient is
+     * consistent with the stress of a residual which overrides the elastic strain
+     */
+
+    class residualMock : public tardigradeHydra::linearElasticity::residual {
+
+        public:
+
+            using tardigradeHydra::linearElasticity::residual::residual;
+
+            floatType scale = 2.5;
+
+        private:
+
+            // A scaled Green-Lagrange strain
+            virtual void setEe( ) override {
+
+                floatVector Ee;
+
+                floatMatrix dEedFe;
+
+                tardigradeConstitutiveTools::computeGreenLagrangeStrain( ( *hydra->getConfigurations( ) )[ 0 ], Ee, dEedFe );
+
+                tardigradeHydra::linearElasticity::residual::setEe( scale * Ee );
+
+            }
+
+            virtual void setdEedFe( ) override {
+
+                floatVector Ee;
+
+                floatMatrix dEedFe;
+
+                tardigradeConstitutiveTools::computeGreenLagrangeStrain( ( *hydra->getConfigurations( ) )[ 0 ], Ee, dEedFe );
+
+                tardigradeHydra::linearElasticity::residual::setdEedFe( scale * dEedFe );
+
+            }
+
+    };
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase{
+
+        public:
+
+            residualMock elasticity;
+
+            unsigned int elasticitySize = 9;
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                elasticity = residualMock( this, elasticitySize, *getParameters( ) );
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 1 );
+
+                residuals[ 0 ] = &elasticity;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { };
+
+    floatVector parameters = { 123.4, 56.7 };
+
+    unsigned int numConfigurations = 1;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    residualMock R( &hydra, 9, parameters );
+
+    floatType eps = 1e-6;
+
+    floatMatrix gradient( deformationGradient.size( ), floatVector( deformationGradient.size( ), 0 ) );
+
+    for ( unsigned int i = 0; i < deformationGradient.size( ); i++ ){
+
+        floatVector delta( deformationGradient.size( ), 0 );
+
+        delta[ i ] = eps * std::fabs( deformationGradient[ i ] ) + eps;
+
+        hydraBaseMock hydrap( time, deltaTime, temperature, previousTemperature, deformationGradient + delta, previousDeformationGradient,
+                             previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+        hydraBaseMock hydram( time, deltaTime, temperature, previousTemperature, deformationGradient - delta, previousDeformationGradient,
+                             previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+        residualMock Rp( &hydrap, 9, parameters );
+
+        residualMock Rm( &hydram, 9, parameters );
+
+        for ( unsigned int j = 0; j < deformationGradient.size( ); j++ ){
+
+            gradient[ j ][ i ] = ( ( *Rp.getPK2Stress( ) )[ j ] - ( *Rm.getPK2Stress( ) )[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+    }
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( gradient, *R.getdPK2StressdFe( ) ) );
+
 }
 
 BOOST_AUTO_TEST_CASE( test_residual_setCauchyStress ){
@@ -655,6 +897,9 @@ BOOST_AUTO_TEST_CASE( test_residual_setCauchyStress ){
 
     BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( cauchyStressAnswer, *R.getCauchyStress( ) ) );
 
+    // The intermediate product is drawn from the iteration workspace of the hydra object
+    BOOST_TEST( *hydra.getIterationArena( )->getSize( ) == 9 );
+
 }
 
 BOOST_AUTO_TEST_CASE( test_residual_setdCauchyStressdPK2Stress ){
@@ -776,6 +1021,101 @@ BOOST_AUTO_TEST_CASE( test_residual_setdCauchyStressdPK2Stress ){
 
 }
 
+BOOST_AUTO_TEST_CASE( test_residual_setdCauchyStressdFe ){
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase{
+
+        public:
+
+            tardigradeHydra::linearElasticity::residual elasticity;
+
+            unsigned int elasticitySize = 9;
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                elasticity = tardigradeHydra::linearElasticity::residual( this, elasticitySize, *getParameters( ) );
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 1 );
+
+                residuals[ 0 ] = &elasticity;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 5.3;
+
+    floatType previousTemperature = 23.4;
+
+    floatVector deformationGradient = { 0.39293837, -0.42772133, -0.54629709,
+                                        0.10262954,  0.43893794, -0.15378708,
+                                        0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector previousDeformationGradient = { -0.21576496, -0.31364397,  0.45809941,
+                                                -0.12285551, -0.88064421, -0.20391149,
+                                                 0.47599081, -0.63501654, -0.64909649 };
+
+    floatVector previousStateVariables = { };
+
+    floatVector parameters = { 123.4, 56.7 };
+
+    unsigned int numConfigurations = 1;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    tardigradeHydra::linearElasticity::residual R( &hydra, 9, parameters );
+
+    floatMatrix gradient( deformationGradient.size( ), floatVector( deformationGradient.size( ), 0 ) );
+
+    floatType eps = 1e-6;
+
+    for ( unsigned int i = 0; i < deformationGradient.size( ); i++ ){
+
+        floatVector delta( deformationGradient.size( ), 0 );
+
+        delta[ i ] = eps * std::fabs( deformationGradient[ i ] ) + eps;
+
+        hydraBaseMock hydrap( time, deltaTime, temperature, previousTemperature, deformationGradient + delta, previousDeformationGradient,
+                             previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+        hydraBaseMock hydram( time, deltaTime, temperature, previousTemperature, deformationGradient - delta, previousDeformationGradient,
+                             previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+        tardigradeHydra::linearElasticity::residual Rp( &hydrap, 9, parameters );
+
+        tardigradeHydra::linearElasticity::residual Rm( &hydram, 9, parameters );
+
+        for ( unsigned int j = 0; j < deformationGradient.size( ); j++ ){
+
+            gradient[ j ][ i ] = ( ( *Rp.getCauchyStress( ) )[ j ] - ( *Rm.getCauchyStress( ) )[ j ] ) / ( 2 * delta[ i ] );
+
+        }
+
+    }
+
+    // The Cauchy stress is computed without any of its gradients
+    tardigradeHydra::linearElasticity::unit_test::residualTester::checkValueOnlyCauchyStress( R );
+
+    // With a single configuration the elastic deformation gradient is the deformation gradient
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( gradient, *R.getdCauchyStressdFe( ) ) );
+
+}
+
 BOOST_AUTO_TEST_CASE( test_residual_setdCauchyStressdF ){
 
     class hydraBaseMock : public tardigradeHydra::hydraBase{
@@ -1525,3 +1865,413 @@ BOOST_AUTO_TEST_CASE( test_residual_setdRdF ){
     BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( gradient, *R.getdRdF( ) ) );
 
 }
+
+BOOST_AUTO_TEST_CASE( test_voigt_computedEedFe ){
+    /*!
+     * Test the computation of the derivative of the elastic Green-Lagrange strain w.r.t. the elastic deformation
+     * gradient using the Voigt components
+     */
+
+    floatVector Fe = { 0.39293837, -0.42772133, -0.54629709,
+                       0.10262954,  0.43893794, -0.15378708,
+                       0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector Ee;
+
+    floatMatrix dEedFeAnswer;
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fe, Ee, dEedFeAnswer );
+
+    floatVector dEedFe( 81 );
+
+    tardigradeHydra::linearElasticity::voigt::computedEedFe( Fe.data( ), dEedFe.data( ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( tardigradeVectorTools::appendVectors( dEedFeAnswer ), dEedFe ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_voigt_computeGreenLagrangeStrain ){
+    /*!
+     * Test the computation of the Voigt components of the elastic Green-Lagrange strain
+     */
+
+    floatVector Fe = { 0.39293837, -0.42772133, -0.54629709,
+                       0.10262954,  0.43893794, -0.15378708,
+                       0.9615284 ,  0.36965948, -0.0381362 };
+
+    floatVector EeAnswer;
+
+    tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fe, EeAnswer );
+
+    floatVector voigtEe( 6 );
+
+    tardigradeHydra::linearElasticity::voigt::computeGreenLagrangeStrain( Fe.data( ), voigtEe.data( ) );
+
+    floatVector Ee( 9 );
+
+    tardigradeHydra::linearElasticity::voigt::expand( voigtEe.data( ), Ee.data( ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( EeAnswer, Ee ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_voigt_isotropicStiffness ){
+    /*!
+     * Test the application and the expansion of the isotropic stiffness
+     */
+
+    tardigradeHydra::linearElasticity::voigt::isotropicStiffness stiffness;
+
+    stiffness.lambda = 123.4;
+
+    stiffness.mu = 56.7;
+
+    floatVector voigtEe = { 0.1, -0.2, 0.3, 0.4, -0.5, 0.6 };
+
+    floatVector Ee( 9 );
+
+    tardigradeHydra::linearElasticity::voigt::expand( voigtEe.data( ), Ee.data( ) );
+
+    floatVector C( 81 );
+
+    stiffness.expand( C.data( ) );
+
+    floatVector PK2StressAnswer( 9, 0 );
+
+    for ( unsigned int i = 0; i < 9; i++ ){
+
+        for ( unsigned int j = 0; j < 9; j++ ){
+
+            PK2StressAnswer[ i ] += C[ 9 * i + j ] * Ee[ j ];
+
+        }
+
+    }
+
+    floatVector voigtPK2Stress( 6 );
+
+    stiffness.apply( voigtEe.data( ), voigtPK2Stress.data( ) );
+
+    floatVector PK2Stress( 9 );
+
+    tardigradeHydra::linearElasticity::voigt::expand( voigtPK2Stress.data( ), PK2Stress.data( ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( PK2StressAnswer, PK2Stress ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_voigt_computedPK2StressdFe ){
+    /*!
+     * Test the computation of the derivative of the second Piola-Kirchhoff stress w.r.t. the elastic deformation
+     * gradient using the Voigt rows of the derivative of the elastic strain
+     */
+
+    floatVector Fe = { 0.39293837, -0.42772133, -0.54629709,
+                       0.10262954,  0.43893794, -0.15378708,
+                       0.9615284 ,  0.36965948, -0.0381362 };
+
+    tardigradeHydra::linearElasticity::voigt::isotropicStiffness stiffness;
+
+    stiffness.lambda = 123.4;
+
+    stiffness.mu = 56.7;
+
+    floatVector dEedFe( 81 );
+
+    tardigradeHydra::linearElasticity::voigt::computedEedFe( Fe.data( ), dEedFe.data( ) );
+
+    floatVector voigtdEedFe( 54 );
+
+    for ( unsigned int v = 0; v < 6; v++ ){
+
+        const unsigned int row = 3 * tardigradeHydra::linearElasticity::voigt::voigtIndices[ v ][ 0 ] + tardigradeHydra::linearElasticity::voigt::voigtIndices[ v ][ 1 ];
+
+        std::copy( dEedFe.begin( ) + 9 * row, dEedFe.begin( ) + 9 * ( row + 1 ), voigtdEedFe.begin( ) + 9 * v );
+
+    }
+
+    floatVector C( 81 );
+
+    stiffness.expand( C.data( ) );
+
+    floatVector dPK2StressdFeAnswer( 81, 0 );
+
+    for ( unsigned int i = 0; i < 9; i++ ){
+
+        for ( unsigned int j = 0; j < 9; j++ ){
+
+            for ( unsigned int k = 0; k < 9; k++ ){
+
+                dPK2StressdFeAnswer[ 9 * i + k ] += C[ 9 * i + j ] * dEedFe[ 9 * j + k ];
+
+            }
+
+        }
+
+    }
+
+    floatVector dPK2StressdFe( 81 );
+
+    tardigradeHydra::linearElasticity::voigt::computedPK2StressdFe( stiffness, voigtdEedFe.data( ), dPK2StressdFe.data( ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dPK2StressdFeAnswer, dPK2StressdFe ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_lockstep_computeCauchyStress ){
+    /*!
+     * Test the lockstep computation of the Cauchy stress and its derivative w.r.t. the elastic deformation gradient
+     */
+
+    constexpr unsigned int W = 2;
+
+    floatType lambda = 123.4;
+
+    floatType mu = 56.7;
+
+    floatMatrix Fe = { { 1.05, 0.02, 0.00, 0.01, 0.98, 0.03, 0.00, 0.10, 1.01 },
+                       { 0.97, 0.00, 0.04, 0.02, 1.03, 0.00, 0.01, 0.00, 0.99 } };
+
+    floatVector laneFe( 9 * W ), cauchyStress( 9 * W ), dCauchyStressdFe( 81 * W );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            laneFe[ W * i + l ] = Fe[ l ][ i ];
+
+        }
+
+    }
+
+    tardigradeHydra::linearElasticity::lockstep::computeCauchyStress< W >( lambda, mu, laneFe.data( ), cauchyStress.data( ), dCauchyStressdFe.data( ) );
+
+    floatVector eye( 9 );
+    tardigradeVectorTools::eye( eye );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        floatVector Ee;
+
+        BOOST_CHECK( !tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fe[ l ], Ee ) );
+
+        floatVector PK2Stress = lambda * tardigradeVectorTools::trace( Ee ) * eye + 2 * mu * Ee;
+
+        floatVector cauchyStressAnswer = tardigradeVectorTools::matrixMultiply( tardigradeVectorTools::matrixMultiply( Fe[ l ], PK2Stress, 3, 3, 3, 3, false, false ), Fe[ l ], 3, 3, 3, 3, false, true )
+                                       / tardigradeVectorTools::determinant( Fe[ l ], 3, 3 );
+
+        floatVector cauchyStressResult( 9 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            cauchyStressResult[ i ] = cauchyStress[ W * i + l ];
+
+        }
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( cauchyStressResult, cauchyStressAnswer ) );
+
+    }
+
+    floatType eps = 1e-6;
+
+    for ( unsigned int j = 0; j < 9; j++ ){
+
+        floatVector deltas( 9 * W, 0 );
+
+        for ( unsigned int l = 0; l < W; l++ ){
+
+            deltas[ W * j + l ] = eps * std::fabs( Fe[ l ][ j ] ) + eps;
+
+        }
+
+        floatVector Fep = laneFe + deltas;
+
+        floatVector Fem = laneFe - deltas;
+
+        floatVector cauchyStressp( 9 * W ), cauchyStressm( 9 * W );
+
+        tardigradeHydra::linearElasticity::lockstep::computeCauchyStress< W >( lambda, mu, Fep.data( ), cauchyStressp.data( ) );
+
+        tardigradeHydra::linearElasticity::lockstep::computeCauchyStress< W >( lambda, mu, Fem.data( ), cauchyStressm.data( ) );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            for ( unsigned int l = 0; l < W; l++ ){
+
+                BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dCauchyStressdFe[ W * ( 9 * i + j ) + l ],
+                                                                 ( cauchyStressp[ W * i + l ] - cauchyStressm[ W * i + l ] ) / ( 2 * deltas[ W * j + l ] ), 1e-5, 1e-5 ) );
+
+            }
+
+        }
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_lockstep_residual ){
+    /*!
+     * Test the lockstep linear elastic residual and its use in the lockstep solve of a model with three
+     * configurations where the trailing configurations are prescribed
+     */
+
+    constexpr unsigned int W = 4;
+
+    const unsigned int numConfigurations = 3;
+
+    const unsigned int n = 9 * numConfigurations;
+
+    floatType lambda = 123.4;
+
+    floatType mu = 56.7;
+
+    floatMatrix F = { { 1.05, 0.02, 0.00, 0.01, 0.98, 0.03, 0.00, 0.10, 1.01 },
+                      { 0.97, 0.00, 0.04, 0.02, 1.03, 0.00, 0.01, 0.00, 0.99 },
+                      { 1.00, 0.00, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                      { 1.10, 0.05, 0.00, 0.00, 0.95, 0.00, 0.02, 0.00, 1.02 } };
+
+    floatMatrix F2 = { { 1.01, 0.00, 0.00, 0.00, 1.01, 0.00, 0.00, 0.00, 1.01 },
+                       { 1.00, 0.00, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                       { 1.00, 0.00, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                       { 1.02, 0.01, 0.00, 0.00, 0.99, 0.00, 0.00, 0.03, 1.00 } };
+
+    floatMatrix F3 = { { 1.00, 0.02, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 0.98 },
+                       { 1.00, 0.00, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                       { 1.00, 0.00, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                       { 0.97, 0.00, 0.02, 0.00, 1.04, 0.00, 0.01, 0.00, 1.00 } };
+
+    floatVector laneF( 9 * W ), laneTargets( 18 * W );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            laneF[ W * i + l ] = F[ l ][ i ];
+
+            laneTargets[ W * i + l ] = F2[ l ][ i ];
+
+            laneTargets[ 9 * W + W * i + l ] = F3[ l ][ i ];
+
+        }
+
+    }
+
+    tardigradeHydra::linearElasticity::lockstep::residual< W > elasticity( lambda, mu, numConfigurations, n );
+
+    elasticity.setDeformationGradient( laneF.data( ) );
+
+    // The trailing configurations are prescribed
+    auto residual = [ & ]( const floatType *X, floatType *R, floatType *J ){
+
+        elasticity( X, R, J );
+
+        for ( unsigned int i = 9; i < n; i++ ){
+
+            for ( unsigned int l = 0; l < W; l++ ){
+
+                R[ W * i + l ] = X[ W * i + l ] - laneTargets[ W * ( i - 9 ) + l ];
+
+            }
+
+            for ( unsigned int j = 0; j < n; j++ ){
+
+                for ( unsigned int l = 0; l < W; l++ ){
+
+                    J[ W * ( n * i + j ) + l ] = ( i == j ) ? 1 : 0;
+
+                }
+
+            }
+
+        }
+
+    };
+
+    floatVector X( n * W, 0 );
+
+    for ( unsigned int c = 1; c < numConfigurations; c++ ){
+
+        tardigradeHydra::lockstep::identity< W >( X.data( ) + 9 * W * c );
+
+    }
+
+    // Check the jacobian of the stress equations with finite differences
+    floatVector R( n * W ), J( n * n * W );
+
+    floatVector XJ = X + 0.01;
+
+    elasticity( XJ.data( ), R.data( ), J.data( ) );
+
+    floatType eps = 1e-6;
+
+    for ( unsigned int j = 0; j < n; j++ ){
+
+        floatVector delta( n * W, 0 );
+
+        for ( unsigned int l = 0; l < W; l++ ){
+
+            delta[ W * j + l ] = eps * std::fabs( XJ[ W * j + l ] ) + eps;
+
+        }
+
+        floatVector Rp( n * W ), Rm( n * W ), Jp( n * n * W );
+
+        floatVector Xp = XJ + delta;
+
+        floatVector Xm = XJ - delta;
+
+        elasticity( Xp.data( ), Rp.data( ), Jp.data( ) );
+
+        elasticity( Xm.data( ), Rm.data( ), Jp.data( ) );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            for ( unsigned int l = 0; l < W; l++ ){
+
+                BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( J[ W * ( n * i + j ) + l ], ( Rp[ W * i + l ] - Rm[ W * i + l ] ) / ( 2 * delta[ W * j + l ] ), 1e-5, 1e-5 ) );
+
+            }
+
+        }
+
+    }
+
+    bool converged[ W ];
+
+    unsigned int iterations[ W ];
+
+    floatVector workspace( tardigradeHydra::lockstep::solveWorkspaceSize< W >( n ) );
+
+    tardigradeHydra::lockstep::solve< W >( n, residual, X.data( ), 1e-10, 1e-10, 20, converged, iterations, workspace.data( ) );
+
+    floatVector laneFe( 9 * W ), cauchyStressAnswer( 9 * W );
+
+    for ( unsigned int l = 0; l < W; l++ ){
+
+        BOOST_CHECK( converged[ l ] );
+
+        floatVector Fe = tardigradeVectorTools::matrixMultiply( F[ l ], tardigradeVectorTools::inverse( tardigradeVectorTools::matrixMultiply( F2[ l ], F3[ l ], 3, 3, 3, 3, false, false ), 3, 3 ),
+                                                                3, 3, 3, 3, false, false );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            laneFe[ W * i + l ] = Fe[ i ];
+
+        }
+
+    }
+
+    // The undeformed lane converges immediately
+    BOOST_CHECK( iterations[ 2 ] == 0 );
+
+    BOOST_CHECK( iterations[ 0 ] > 0 );
+
+    tardigradeHydra::linearElasticity::lockstep::computeCauchyStress< W >( lambda, mu, laneFe.data( ), cauchyStressAnswer.data( ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( X.begin( ), X.begin( ) + 9 * W ), cauchyStressAnswer ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( elasticity.getConfigurations( )->begin( ), elasticity.getConfigurations( )->begin( ) + 9 * W ), laneFe ) );
+
+    BOOST_CHECK_THROW( tardigradeHydra::linearElasticity::lockstep::residual< W >( lambda, mu, 0, n ), std::nested_exception );
+
+}
@@ -46,6 +46,54 @@ namespace tardigradeHydra{
 
                 public:
 
+                    static bool get_dPlasticDeformationGradientdFIsSet( tardigradeHydra::peryznaViscoplasticity::residual &R ){
+
+                        return R._dPlasticDeformationGradientdF.first;
+
+                    }
+
+                    static bool get_dPlasticDeformationGradientdTIsSet( tardigradeHydra::peryznaViscoplasticity::residual &R ){
+
+                        return R._dPlasticDeformationGradientdT.first;
+
+                    }
+
+                    static bool get_dPlasticStateVariablesdFIsSet( tardigradeHydra::peryznaViscoplasticity::residual &R ){
+
+                        return R._dPlasticStateVariablesdF.first;
+
+                    }
+
+                    static bool get_dPlasticStateVariablesdTIsSet( tardigradeHydra::peryznaViscoplasticity::residual &R ){
+
+                        return R._dPlasticStateVariablesdT.first;
+
+                    }
+
+                    static bool getFusedPartialsAreSet( tardigradeHydra::peryznaViscoplasticity::residual &R, const bool isPrevious ){
+
+                        if ( isPrevious ){
+
+                            return R._dPreviousFlowDirectiondPreviousDrivingStress.first && R._dPreviousYieldFunctiondPreviousDrivingStress.first && R._previousPlasticMultiplierPartials.first;
+
+                        }
+
+                        return R._dFlowDirectiondDrivingStress.first && R._dYieldFunctiondDrivingStress.first && R._plasticMultiplierPartials.first;
+
+                    }
+
+                    static bool getdFlowDirectiondDrivingStressIsSet( tardigradeHydra::peryznaViscoplasticity::residual &R, const bool isPrevious ){
+
+                        if ( isPrevious ){
+
+                            return R._dPreviousFlowDirectiondPreviousDrivingStress.first;
+
+                        }
+
+                        return R._dFlowDirectiondDrivingStress.first;
+
+                    }
+
                     static void runBasicGetTests( tardigradeHydra::peryznaViscoplasticity::residual &R ){
 
                         try{
@@ -7825,3 +7873,951 @@ BOOST_AUTO_TEST_CASE( test_residual_getdRdF ){
     BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dRdF, *R.getdRdF( ) ) );
 
 }
+
+BOOST_AUTO_TEST_CASE( test_residual_derivativeRequest ){
+    /*!
+     * Test that the derivatives w.r.t. the deformation gradient and temperature are only
+     * computed when they are requested
+     */
+
+    class stressMock : public tardigradeHydra::residualBase {
+
+        public:
+
+            using tardigradeHydra::residualBase::residualBase;
+
+            floatVector previousCauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+        private:
+
+            virtual void setPreviousCauchyStress( ){
+
+                tardigradeHydra::residualBase::setPreviousCauchyStress( previousCauchyStress );
+
+            }
+
+    };
+
+    class residualMock : public tardigradeHydra::peryznaViscoplasticity::residual {
+
+        public:
+
+            using tardigradeHydra::peryznaViscoplasticity::residual::residual;
+
+    };
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+    
+            floatVector elasticityParameters = { 123.4, 56.7 };
+
+            floatVector viscoPlasticParameters = { 10.0,
+                                                   1e1, 1e2,
+                                                   10, 200, 293.15,
+                                                   5, 0.34,
+                                                   0.12,
+                                                   13., 14.};
+                                                   
+
+            std::vector< unsigned int > stateVariableIndices = { 2 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 7e-5, 8e-5, 9e-5, 10e-5, 11e-5, 12e-5 };
+
+            floatVector _local_deltaPreviousCauchyStress = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    
+            stressMock elasticity;
+    
+            residualMock viscoPlasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+    
+            tardigradeHydra::residualBase remainder;
+    
+            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+    
+                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+    
+            }
+
+        private:
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 4 );
+
+                elasticity = stressMock( this, 9 );
+
+                elasticity.previousCauchyStress += _local_deltaPreviousCauchyStress;
+
+                viscoPlasticity = residualMock( this, 10, 1, stateVariableIndices, viscoPlasticParameters );
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 2, thermalParameters );
+
+                remainder = tardigradeHydra::residualBase( this, 4 );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &viscoPlasticity;
+
+                residuals[ 2 ] = &thermalExpansion;
+
+                residuals[ 3 ] = &remainder;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 300.0;
+
+    floatType previousTemperature = 320.4;
+
+    floatVector deformationGradient = { 1.1, 0.1, 0.0,
+                                        0.0, 1.0, 0.0,
+                                        0.0, 0.0, 1.0 };
+
+    floatVector previousDeformationGradient = { 1.0, 0.0, 0.0,
+                                                0.0, 1.0, 0.0,
+                                                0.0, 0.0, 1.0 };
+
+    floatVector previousStateVariables = { 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0.01, 0.02, 0.005, 0.04, 0.05 };
+
+    floatVector parameters = { 123.4, 56.7, 293.15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+    floatVector unknownVector = { 2, 1, 1, 7, 1, 6, 1, 8, 3,
+                                  1.2, 0.0, 0.0,
+                                  0.0, 1.0, 0.0,
+                                  0.0, 0.0, 1.0,
+                                  1.01, 0.0, 0.0,
+                                  0.0,  1.2, 0.0,
+                                  0.0,  0.0, 0.9,
+                                  4, 5, 0.01, 7, 8 };
+
+    unsigned int numConfigurations = 3;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    residualMock R( &hydra, 10, 1, hydra.stateVariableIndices, hydra.viscoPlasticParameters );
+
+    tardigradeHydra::unit_test::hydraBaseTester::updateUnknownVector( hydra, unknownVector );
+
+    residualMock Rfull( &hydra, 10, 1, hydra.stateVariableIndices, hydra.viscoPlasticParameters );
+
+    floatMatrix jacobian = *Rfull.getJacobian( );
+
+    floatMatrix dRdF = *Rfull.getdRdF( );
+
+    floatVector dRdT = *Rfull.getdRdT( );
+
+    hydra.setDerivativeRequest( tardigradeHydra::derivativeRequest::jacobian );
+
+    BOOST_CHECK( *hydra.getDerivativeRequest( ) == tardigradeHydra::derivativeRequest::jacobian );
+
+    BOOST_CHECK( !hydra.isDerivativeRequested( tardigradeHydra::derivativeRequest::dRdF ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( jacobian, *R.getJacobian( ) ) );
+
+    BOOST_CHECK( !tardigradeHydra::peryznaViscoplasticity::unit_test::residualTester::get_dPlasticDeformationGradientdFIsSet( R ) );
+
+    BOOST_CHECK( !tardigradeHydra::peryznaViscoplasticity::unit_test::residualTester::get_dPlasticDeformationGradientdTIsSet( R ) );
+
+    BOOST_CHECK( !tardigradeHydra::peryznaViscoplasticity::unit_test::residualTester::get_dPlasticStateVariablesdFIsSet( R ) );
+
+    BOOST_CHECK( !tardigradeHydra::peryznaViscoplasticity::unit_test::residualTester::get_dPlasticStateVariablesdTIsSet( R ) );
+
+    hydra.setDerivativeRequest( tardigradeHydra::derivativeRequest::all );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dRdF, *R.getdRdF( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dRdT, *R.getdRdT( ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_residual_persistedRates ){
+    /*!
+     * Test of persisting the converged velocity gradient and state variable evolution
+     * rates in the additional state variables
+     */
+
+    class residualMock : public tardigradeHydra::peryznaViscoplasticity::residual {
+
+        public:
+
+            using tardigradeHydra::peryznaViscoplasticity::residual::residual;
+
+            floatVector velocityGradient = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+            floatVector stateVariableEvolutionRates = { 0.7 };
+
+            floatVector previousVelocityGradient = { 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9 };
+
+            floatVector previousStateVariableEvolutionRates = { -0.3 };
+
+        private:
+
+            virtual void setVelocityGradient( const bool isPrevious ) override{
+
+                if ( isPrevious ){
+
+                    tardigradeHydra::peryznaViscoplasticity::residual::setPreviousVelocityGradient( previousVelocityGradient );
+
+                }
+                else{
+
+                    tardigradeHydra::peryznaViscoplasticity::residual::setVelocityGradient( velocityGradient );
+
+                }
+
+            }
+
+            virtual void setStateVariableEvolutionRates( const bool isPrevious ) override{
+
+                if ( isPrevious ){
+
+                    tardigradeHydra::peryznaViscoplasticity::residual::setPreviousStateVariableEvolutionRates( previousStateVariableEvolutionRates );
+
+                }
+                else{
+
+                    tardigradeHydra::peryznaViscoplasticity::residual::setStateVariableEvolutionRates( stateVariableEvolutionRates );
+
+                }
+
+            }
+
+    };
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector viscoPlasticParameters = { 10.0,
+                                                   1e1, 1e2,
+                                                   10, 200, 293.15,
+                                                   5, 0.34,
+                                                   0.12,
+                                                   13., 14.};
+
+            std::vector< unsigned int > stateVariableIndices = { 2 };
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 300.0;
+
+    floatType previousTemperature = 320.4;
+
+    floatVector deformationGradient = { 1.1, 0.1, 0.0,
+                                        0.0, 1.0, 0.0,
+                                        0.0, 0.0, 1.0 };
+
+    floatVector previousDeformationGradient = { 1.0, 0.0, 0.0,
+                                                0.0, 1.0, 0.0,
+                                                0.0, 0.0, 1.0 };
+
+    floatVector persistedVelocityGradient = { -1, -2, -3, -4, -5, -6, -7, -8, -9 };
+
+    floatVector persistedStateVariableEvolutionRates = { 1.23 };
+
+    floatVector previousStateVariables = { 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0.01, 0.02, 0.03, 0.04, 0.05,
+                                           0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    floatVector parameters = { 123.4, 56.7, 293.15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+    unsigned int numConfigurations = 3;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    // The rates have not been written yet so they are re-computed
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    residualMock R( &hydra, 9, 1, hydra.stateVariableIndices, hydra.viscoPlasticParameters );
+
+    BOOST_CHECK( !( *R.getPersistRates( ) ) );
+
+    BOOST_CHECK( R.getCurrentAdditionalStateVariables( )->size( ) == 0 );
+
+    residualMock Rpersist( &hydra, 9, 1, hydra.stateVariableIndices, hydra.viscoPlasticParameters );
+
+    Rpersist.setPersistedRatesIndex( 0 );
+
+    BOOST_CHECK( *Rpersist.getPersistRates( ) );
+
+    BOOST_CHECK( *Rpersist.getPersistedRatesIndex( ) == 0 );
+
+    BOOST_CHECK( Rpersist.getNumPersistedRates( ) == 11 );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( Rpersist.previousVelocityGradient, *Rpersist.getPreviousVelocityGradient( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( Rpersist.previousStateVariableEvolutionRates, *Rpersist.getPreviousStateVariableEvolutionRates( ) ) );
+
+    floatVector answer = tardigradeVectorTools::appendVectors( { { 1 }, Rpersist.velocityGradient, Rpersist.stateVariableEvolutionRates } );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( answer, *Rpersist.getCurrentAdditionalStateVariables( ) ) );
+
+    // The persisted rates are read directly
+    floatVector persistedStateVariables = tardigradeVectorTools::appendVectors( { floatVector( previousStateVariables.begin( ), previousStateVariables.begin( ) + 23 ),
+                                                                                  { 1 }, persistedVelocityGradient, persistedStateVariableEvolutionRates } );
+
+    hydraBaseMock hydraPersisted( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                                  persistedStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    residualMock Rread( &hydraPersisted, 9, 1, hydraPersisted.stateVariableIndices, hydraPersisted.viscoPlasticParameters );
+
+    Rread.setPersistedRatesIndex( 0 );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( persistedVelocityGradient, *Rread.getPreviousVelocityGradient( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( persistedStateVariableEvolutionRates, *Rread.getPreviousStateVariableEvolutionRates( ) ) );
+
+    // The persisted rates must fit in the additional state variables
+    residualMock Rbad( &hydraPersisted, 9, 1, hydraPersisted.stateVariableIndices, hydraPersisted.viscoPlasticParameters );
+
+    Rbad.setPersistedRatesIndex( 1 );
+
+    BOOST_CHECK_THROW( Rbad.getPreviousVelocityGradient( ), std::nested_exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_residual_fusedEvaluations ){
+    /*!
+     * Test that evaluating the yield function, flow direction, and plastic multiplier also
+     * caches their partial derivatives for the derivative stages
+     */
+
+    class stressMock : public tardigradeHydra::residualBase {
+
+        public:
+
+            using tardigradeHydra::residualBase::residualBase;
+
+            floatVector previousCauchyStress = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+        private:
+
+            virtual void setPreviousCauchyStress( ){
+
+                tardigradeHydra::residualBase::setPreviousCauchyStress( previousCauchyStress );
+
+            }
+
+    };
+
+    class residualMock : public tardigradeHydra::peryznaViscoplasticity::residual {
+
+        public:
+
+            using tardigradeHydra::peryznaViscoplasticity::residual::residual;
+
+    };
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector viscoPlasticParameters = { 10.0,
+                                                   1e1, 1e2,
+                                                   10, 200, 293.15,
+                                                   5, 0.34,
+                                                   0.12,
+                                                   13., 14.};
+
+            std::vector< unsigned int > stateVariableIndices = { 2 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 7e-5, 8e-5, 9e-5, 10e-5, 11e-5, 12e-5 };
+
+            stressMock elasticity;
+
+            residualMock viscoPlasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+
+            tardigradeHydra::residualBase remainder;
+
+            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+
+                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+
+            }
+
+        private:
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 4 );
+
+                elasticity = stressMock( this, 9 );
+
+                viscoPlasticity = residualMock( this, 10, 1, stateVariableIndices, viscoPlasticParameters );
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 2, thermalParameters );
+
+                remainder = tardigradeHydra::residualBase( this, 4 );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &viscoPlasticity;
+
+                residuals[ 2 ] = &thermalExpansion;
+
+                residuals[ 3 ] = &remainder;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 300.0;
+
+    floatType previousTemperature = 320.4;
+
+    floatVector deformationGradient = { 1.1, 0.1, 0.0,
+                                        0.0, 1.0, 0.0,
+                                        0.0, 0.0, 1.0 };
+
+    floatVector previousDeformationGradient = { 1.0, 0.0, 0.0,
+                                                0.0, 1.0, 0.0,
+                                                0.0, 0.0, 1.0 };
+
+    floatVector previousStateVariables = { 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                           0.01, 0.02, 0.005, 0.04, 0.05 };
+
+    floatVector parameters = { 123.4, 56.7, 293.15, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+
+    floatVector unknownVector = { 2, 1, 1, 7, 1, 6, 1, 8, 3,
+                                  1.2, 0.0, 0.0,
+                                  0.0, 1.0, 0.0,
+                                  0.0, 0.0, 1.0,
+                                  1.01, 0.0, 0.0,
+                                  0.0,  1.2, 0.0,
+                                  0.0,  0.0, 0.9,
+                                  4, 5, 0.01, 7, 8 };
+
+    unsigned int numConfigurations = 3;
+
+    unsigned int numNonLinearSolveStateVariables = 5;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension );
+
+    tardigradeHydra::unit_test::hydraBaseTester::updateUnknownVector( hydra, unknownVector );
+
+    residualMock R( &hydra, 9, 1, hydra.stateVariableIndices, hydra.viscoPlasticParameters );
+
+    residualMock Rgrad( &hydra, 9, 1, hydra.stateVariableIndices, hydra.viscoPlasticParameters );
+
+    // Request the values before the derivatives
+    floatVector flowDirection = *R.getFlowDirection( );
+
+    floatType plasticMultiplier = *R.getPlasticMultiplier( );
+
+    floatType yieldFunction = *R.getYieldFunction( );
+
+    BOOST_CHECK( tardigradeHydra::peryznaViscoplasticity::unit_test::residualTester::getFusedPartialsAreSet( R, false ) );
+
+    floatVector previousFlowDirection = *R.getPreviousFlowDirection( );
+
+    floatType previousPlasticMultiplier = *R.getPreviousPlasticMultiplier( );
+
+    floatType previousYieldFunction = *R.getPreviousYieldFunction( );
+
+    BOOST_CHECK( tardigradeHydra::peryznaViscoplasticity::unit_test::residualTester::getFusedPartialsAreSet( R, true ) );
+
+    floatMatrix dFlowDirectiondCauchyStress = *R.getdFlowDirectiondCauchyStress( );
+
+    floatVector dPlasticMultiplierdCauchyStress = *R.getdPlasticMultiplierdCauchyStress( );
+
+    floatMatrix dPreviousFlowDirectiondPreviousCauchyStress = *R.getdPreviousFlowDirectiondPreviousCauchyStress( );
+
+    floatVector dPreviousPlasticMultiplierdPreviousCauchyStress = *R.getdPreviousPlasticMultiplierdPreviousCauchyStress( );
+
+    // Request the derivatives without the values
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dFlowDirectiondCauchyStress, *Rgrad.getdFlowDirectiondCauchyStress( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dPlasticMultiplierdCauchyStress, *Rgrad.getdPlasticMultiplierdCauchyStress( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dPreviousFlowDirectiondPreviousCauchyStress, *Rgrad.getdPreviousFlowDirectiondPreviousCauchyStress( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dPreviousPlasticMultiplierdPreviousCauchyStress, *Rgrad.getdPreviousPlasticMultiplierdPreviousCauchyStress( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( flowDirection, *Rgrad.getFlowDirection( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( yieldFunction, *Rgrad.getYieldFunction( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( plasticMultiplier, *Rgrad.getPlasticMultiplier( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( previousFlowDirection, *Rgrad.getPreviousFlowDirection( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( previousYieldFunction, *Rgrad.getPreviousYieldFunction( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( previousPlasticMultiplier, *Rgrad.getPreviousPlasticMultiplier( ) ) );
+
+    // The derivative of the flow direction is only computed with the value if derivatives are requested
+    residualMock Rvalue( &hydra, 9, 1, hydra.stateVariableIndices, hydra.viscoPlasticParameters );
+
+    hydra.setDerivativeRequest( 0 );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( flowDirection, *Rvalue.getFlowDirection( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( previousFlowDirection, *Rvalue.getPreviousFlowDirection( ) ) );
+
+    BOOST_CHECK( !tardigradeHydra::peryznaViscoplasticity::unit_test::residualTester::getdFlowDirectiondDrivingStressIsSet( Rvalue, false ) );
+
+    BOOST_CHECK( !tardigradeHydra::peryznaViscoplasticity::unit_test::residualTester::getdFlowDirectiondDrivingStressIsSet( Rvalue, true ) );
+
+    hydra.setDerivativeRequest( tardigradeHydra::derivativeRequest::all );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dFlowDirectiondCauchyStress, *Rvalue.getdFlowDirectiondCauchyStress( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dPreviousFlowDirectiondPreviousCauchyStress, *Rvalue.getdPreviousFlowDirectiondPreviousCauchyStress( ) ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_residual_persistedRates_consecutiveIncrements ){
+    /*!
+     * Test that the rates persisted at the converged state of an increment match the rates re-computed from the
+     * updated state variables at the next increment and that both converge to the same solution
+     */
+
+    class elasticityWithPreviousStress : public tardigradeHydra::linearElasticity::residual {
+
+        public:
+
+            using tardigradeHydra::linearElasticity::residual::residual;
+
+        private:
+
+            virtual void setPreviousCauchyStress( ) override{
+
+                const floatVector &Fe = ( *hydra->getPreviousConfigurations( ) )[ 0 ];
+
+                floatVector Ee;
+
+                tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fe, Ee );
+
+                floatVector PK2Stress( 9, 0 );
+
+                for ( unsigned int i = 0; i < 9; i++ ){
+
+                    PK2Stress[ i ] = 2 * ( *getMu( ) ) * Ee[ i ];
+
+                }
+
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    PK2Stress[ 3 * i + i ] += ( *getLambda( ) ) * ( Ee[ 0 ] + Ee[ 4 ] + Ee[ 8 ] );
+
+                }
+
+                floatType Je = tardigradeVectorTools::determinant( Fe, 3, 3 );
+
+                floatVector previousCauchyStress( 9, 0 );
+
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    for ( unsigned int j = 0; j < 3; j++ ){
+
+                        for ( unsigned int A = 0; A < 3; A++ ){
+
+                            for ( unsigned int B = 0; B < 3; B++ ){
+
+                                previousCauchyStress[ 3 * i + j ] += Fe[ 3 * i + A ] * PK2Stress[ 3 * A + B ] * Fe[ 3 * j + B ] / Je;
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+                tardigradeHydra::residualBase::setPreviousCauchyStress( previousCauchyStress );
+
+            }
+
+    };
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            bool persistRates = false; // Must be set before the residual classes are requested
+
+            floatVector elasticityParameters = { 123.4, 56.7 };
+
+            floatVector viscoPlasticParameters = { 10.0, 1e1, 1e2, 10, 200, 293.15, 5, 0.34, 0.12, 13., 14. };
+
+            std::vector< unsigned int > stateVariableIndices = { 0 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 7e-5, 8e-5, 9e-5, 10e-5, 11e-5, 12e-5 };
+
+            elasticityWithPreviousStress elasticity;
+
+            tardigradeHydra::peryznaViscoplasticity::residual viscoPlasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+
+        private:
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 3 );
+
+                elasticity = elasticityWithPreviousStress( this, 9, elasticityParameters );
+
+                viscoPlasticity = tardigradeHydra::peryznaViscoplasticity::residual( this, 10, 1, stateVariableIndices, viscoPlasticParameters );
+
+                if ( persistRates ){
+
+                    viscoPlasticity.setPersistedRatesIndex( 0 );
+
+                }
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 2, thermalParameters );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &viscoPlasticity;
+
+                residuals[ 2 ] = &thermalExpansion;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatVector eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector deformationGradient0 = { 1.05, 0.05, 0.00,
+                                         0.00, 1.00, 0.00,
+                                         0.00, 0.00, 1.00 };
+
+    floatVector deformationGradient1 = { 1.10, 0.10, 0.00,
+                                         0.00, 0.99, 0.00,
+                                         0.00, 0.00, 1.01 };
+
+    // The configurations, the plastic state variable, and the unwritten persisted rates
+    floatVector previousStateVariables( 19 + 11, 0 );
+
+    // Solve increment n - 1 persisting the converged rates
+    hydraBaseMock hydra0( 1.1, 0.1, 293.5, 293.15, deformationGradient0, eye, previousStateVariables, { }, 3, 1 );
+
+    hydra0.persistRates = true;
+
+    BOOST_CHECK_NO_THROW( hydra0.evaluate( ) );
+
+    floatVector stateVariables0 = *hydra0.getUpdatedStateVariables( );
+
+    BOOST_TEST( stateVariables0[ 19 ] == 1 );
+
+    // Solve increment n from the updated state variables with and without the persisted rates
+    hydraBaseMock hydraPersisted( 1.2, 0.1, 293.8, 293.5, deformationGradient1, deformationGradient0, stateVariables0, { }, 3, 1 );
+
+    hydraPersisted.persistRates = true;
+
+    hydraBaseMock hydraRecomputed( 1.2, 0.1, 293.8, 293.5, deformationGradient1, deformationGradient0, stateVariables0, { }, 3, 1 );
+
+    BOOST_CHECK( *hydraPersisted.viscoPlasticity.getPersistRates( ) );
+
+    BOOST_CHECK( !( *hydraRecomputed.viscoPlasticity.getPersistRates( ) ) );
+
+    // The persisted previous rates are the converged rates of increment n - 1
+    floatVector persistedVelocityGradient( stateVariables0.begin( ) + 20, stateVariables0.begin( ) + 29 );
+
+    floatVector persistedStateVariableEvolutionRates( stateVariables0.begin( ) + 29, stateVariables0.begin( ) + 30 );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( persistedVelocityGradient, *hydraPersisted.viscoPlasticity.getPreviousVelocityGradient( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( persistedStateVariableEvolutionRates, *hydraPersisted.viscoPlasticity.getPreviousStateVariableEvolutionRates( ) ) );
+
+    // and match the rates re-computed from the updated state variables to the tolerance of the solve
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydraRecomputed.viscoPlasticity.getPreviousVelocityGradient( ),
+                                                     *hydraPersisted.viscoPlasticity.getPreviousVelocityGradient( ), 1e-6, 1e-8 ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydraRecomputed.viscoPlasticity.getPreviousStateVariableEvolutionRates( ),
+                                                     *hydraPersisted.viscoPlasticity.getPreviousStateVariableEvolutionRates( ), 1e-6, 1e-8 ) );
+
+    BOOST_CHECK_NO_THROW( hydraPersisted.evaluate( ) );
+
+    BOOST_CHECK_NO_THROW( hydraRecomputed.evaluate( ) );
+
+    // The derivative stages don't replace the persisted previous rates
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( persistedVelocityGradient, *hydraPersisted.viscoPlasticity.getPreviousVelocityGradient( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( persistedStateVariableEvolutionRates, *hydraPersisted.viscoPlasticity.getPreviousStateVariableEvolutionRates( ) ) );
+
+    // Both increments converge to the same solution
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *hydraRecomputed.getCauchyStress( ), *hydraPersisted.getCauchyStress( ), 1e-6, 1e-8 ) );
+
+    floatVector persistedStateVariables1( hydraPersisted.getUpdatedStateVariables( )->begin( ), hydraPersisted.getUpdatedStateVariables( )->begin( ) + 19 );
+
+    floatVector recomputedStateVariables1( hydraRecomputed.getUpdatedStateVariables( )->begin( ), hydraRecomputed.getUpdatedStateVariables( )->begin( ) + 19 );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( recomputedStateVariables1, persistedStateVariables1, 1e-6, 1e-8 ) );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_materialPointBatch_evaluate ){
+    /*!
+     * Test the evaluation of a thermo-elasto-viscoplastic model at a batch of material points with distinct previous
+     * state variables against the solves of each point by a new hydra object. The previous driving stress and rates
+     * of the viscoplastic residual must be re-computed for each point of the batch.
+     */
+
+    class elasticityWithPreviousStress : public tardigradeHydra::linearElasticity::residual {
+
+        public:
+
+            using tardigradeHydra::linearElasticity::residual::residual;
+
+        private:
+
+            virtual void setPreviousCauchyStress( ) override{
+
+                const floatVector &Fe = ( *hydra->getPreviousConfigurations( ) )[ 0 ];
+
+                floatVector Ee;
+
+                tardigradeConstitutiveTools::computeGreenLagrangeStrain( Fe, Ee );
+
+                floatVector PK2Stress( 9, 0 );
+
+                for ( unsigned int i = 0; i < 9; i++ ){
+
+                    PK2Stress[ i ] = 2 * ( *getMu( ) ) * Ee[ i ];
+
+                }
+
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    PK2Stress[ 3 * i + i ] += ( *getLambda( ) ) * ( Ee[ 0 ] + Ee[ 4 ] + Ee[ 8 ] );
+
+                }
+
+                floatType Je = tardigradeVectorTools::determinant( Fe, 3, 3 );
+
+                floatVector previousCauchyStress( 9, 0 );
+
+                for ( unsigned int i = 0; i < 3; i++ ){
+
+                    for ( unsigned int j = 0; j < 3; j++ ){
+
+                        for ( unsigned int A = 0; A < 3; A++ ){
+
+                            for ( unsigned int B = 0; B < 3; B++ ){
+
+                                previousCauchyStress[ 3 * i + j ] += Fe[ 3 * i + A ] * PK2Stress[ 3 * A + B ] * Fe[ 3 * j + B ] / Je;
+
+                            }
+
+                        }
+
+                    }
+
+                }
+
+                tardigradeHydra::residualBase::setPreviousCauchyStress( previousCauchyStress );
+
+            }
+
+    };
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector elasticityParameters = { 123.4, 56.7 };
+
+            floatVector viscoPlasticParameters = { 10.0, 1e1, 1e2, 10, 200, 293.15, 5, 0.34, 0.12, 13., 14. };
+
+            std::vector< unsigned int > stateVariableIndices = { 0 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 7e-5, 8e-5, 9e-5, 10e-5, 11e-5, 12e-5 };
+
+            elasticityWithPreviousStress elasticity;
+
+            tardigradeHydra::peryznaViscoplasticity::residual viscoPlasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+
+        private:
+
+            using tardigradeHydra::hydraBase::setResidualClasses;
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 3 );
+
+                elasticity = elasticityWithPreviousStress( this, 9, elasticityParameters );
+
+                viscoPlasticity = tardigradeHydra::peryznaViscoplasticity::residual( this, 10, 1, stateVariableIndices, viscoPlasticParameters );
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 2, thermalParameters );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &viscoPlasticity;
+
+                residuals[ 2 ] = &thermalExpansion;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    const unsigned int numPoints = 3;
+
+    // The plastic and thermal configurations followed by the plastic state variable
+    const unsigned int numStateVariables = 19;
+
+    floatType time = 1.2;
+
+    floatType deltaTime = 0.1;
+
+    floatVector eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector temperature = { 293.8, 293.7, 293.9 };
+
+    floatVector previousTemperature = { 293.5, 293.6, 293.4 };
+
+    floatMatrix previousDeformationGradient = { { 1.05, 0.05, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                                                { 1.00, 0.00, 0.03, 0.00, 0.97, 0.00, 0.02, 0.00, 1.01 },
+                                                { 0.98, 0.00, 0.00, 0.04, 1.02, 0.00, 0.00, 0.01, 1.00 } };
+
+    floatMatrix deformationGradient = { { 1.10, 0.10, 0.00, 0.00, 0.99, 0.00, 0.00, 0.00, 1.01 },
+                                        { 1.01, 0.00, 0.06, 0.00, 0.95, 0.00, 0.03, 0.00, 1.02 },
+                                        { 0.96, 0.00, 0.00, 0.07, 1.03, 0.00, 0.00, 0.02, 1.00 } };
+
+    // Solve the previous increment of each point from a stress free state so that the points have distinct
+    // previous state variables
+    floatMatrix previousStateVariables( numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        hydraBaseMock previous( time - deltaTime, deltaTime, previousTemperature[ p ], 293.15, previousDeformationGradient[ p ], eye,
+                                floatVector( numStateVariables, 0 ), { }, 3, 1 );
+
+        BOOST_CHECK_NO_THROW( previous.evaluate( ) );
+
+        previousStateVariables[ p ] = *previous.getUpdatedStateVariables( );
+
+        BOOST_REQUIRE( previousStateVariables[ p ].size( ) == numStateVariables );
+
+    }
+
+    BOOST_REQUIRE( !tardigradeVectorTools::fuzzyEquals( previousStateVariables[ 0 ], previousStateVariables[ 1 ] ) );
+
+    // Transpose the inputs into structures of arrays
+    floatVector F( 9 * numPoints ), Fn( 9 * numPoints ), ISVs( numStateVariables * numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            F[ numPoints * i + p ] = deformationGradient[ p ][ i ];
+
+            Fn[ numPoints * i + p ] = previousDeformationGradient[ p ][ i ];
+
+        }
+
+        for ( unsigned int i = 0; i < numStateVariables; i++ ){
+
+            ISVs[ numPoints * i + p ] = previousStateVariables[ p ][ i ];
+
+        }
+
+    }
+
+    floatVector cauchyStress( 9 * numPoints ), stateVariables( numStateVariables * numPoints ), dCauchyStressdF( 81 * numPoints );
+
+    hydraBaseMock hydra( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( numStateVariables, 0 ), { }, 3, 1 );
+
+    tardigradeHydra::materialPointBatch batch( &hydra );
+
+    BOOST_CHECK_NO_THROW( batch.evaluate( numPoints, time, deltaTime, temperature.data( ), previousTemperature.data( ),
+                                          F.data( ), Fn.data( ), ISVs.data( ),
+                                          cauchyStress.data( ), stateVariables.data( ), dCauchyStressdF.data( ) ) );
+
+    BOOST_CHECK( *batch.getNumEvaluatedPoints( ) == numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        hydraBaseMock single( time, deltaTime, temperature[ p ], previousTemperature[ p ], deformationGradient[ p ], previousDeformationGradient[ p ],
+                              previousStateVariables[ p ], { }, 3, 1 );
+
+        BOOST_CHECK_NO_THROW( single.evaluate( ) );
+
+        floatVector tangentAnswer = tardigradeVectorTools::appendVectors( *single.getdCauchyStressdF( ) );
+
+        floatVector stressResult( 9 ), stateVariableResult( numStateVariables ), tangentResult( 81 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            stressResult[ i ] = cauchyStress[ numPoints * i + p ];
+
+        }
+
+        for ( unsigned int i = 0; i < numStateVariables; i++ ){
+
+            stateVariableResult[ i ] = stateVariables[ numPoints * i + p ];
+
+        }
+
+        for ( unsigned int i = 0; i < 81; i++ ){
+
+            tangentResult[ i ] = dCauchyStressdF[ numPoints * i + p ];
+
+        }
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( stressResult, *single.getCauchyStress( ) ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( stateVariableResult, *single.getUpdatedStateVariables( ) ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( tangentResult, tangentAnswer ) );
+
+    }
+
+}
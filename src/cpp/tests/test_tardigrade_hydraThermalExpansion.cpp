@@ -1128,3 +1128,712 @@ BOOST_AUTO_TEST_CASE( test_residual_setResidualDerivatives ){
     BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dRdT, *R.getdRdT( ) ) );
 
 }
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_thermoElasticTotalDerivatives ){
+    /*!
+     * Test the total derivatives of the converged unknown vector for a thermo-elastic model
+     */
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector elasticityParameters = { 123.4, 56.7 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 1e-8, 2e-8, 3e-8, 4e-8, 5e-8, 6e-8 };
+
+            tardigradeHydra::linearElasticity::residual elasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+
+            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+
+                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+
+            }
+
+        private:
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 2 );
+
+                elasticity = tardigradeHydra::linearElasticity::residual( this, 9, elasticityParameters );
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 1, thermalParameters );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &thermalExpansion;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 300.0;
+
+    floatType previousTemperature = 320.4;
+
+    floatVector deformationGradient = { 1.05, 0.02, 0.00,
+                                        0.01, 0.98, 0.03,
+                                        0.00, 0.10, 1.01 };
+
+    floatVector previousDeformationGradient = { 1.0, 0.0, 0.0,
+                                                0.0, 1.0, 0.0,
+                                                0.0, 0.0, 1.0 };
+
+    floatVector previousStateVariables = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    floatVector parameters = { };
+
+    unsigned int numConfigurations = 2;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock hydra( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                         previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    BOOST_CHECK_NO_THROW( hydra.evaluate( ) );
+
+    // Newton's method factors the jacobian once per iteration
+    const unsigned int numJacobianFactorizations = *hydra.getNumJacobianFactorizations( );
+
+    BOOST_CHECK( numJacobianFactorizations == *hydra.getNumIterations( ) );
+
+    BOOST_CHECK( *hydra.getNumTangentFactorizations( ) == 0 );
+
+    floatVector unknownVector = *hydra.getUnknownVector( );
+
+    floatMatrix dXdF( unknownVector.size( ), floatVector( deformationGradient.size( ), 0 ) );
+
+    floatVector dXdT( unknownVector.size( ), 0 );
+
+    floatType eps = 1e-6;
+
+    for ( unsigned int i = 0; i < deformationGradient.size( ); i++ ){
+
+        floatVector deltas( deformationGradient.size( ), 0 );
+
+        deltas[ i ] = eps * std::fabs( deformationGradient[ i ] ) + eps;
+
+        hydraBaseMock hydrap( time, deltaTime, temperature, previousTemperature, deformationGradient + deltas, previousDeformationGradient,
+                              previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+        hydraBaseMock hydram( time, deltaTime, temperature, previousTemperature, deformationGradient - deltas, previousDeformationGradient,
+                              previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+        hydrap.evaluate( );
+
+        hydram.evaluate( );
+
+        for ( unsigned int j = 0; j < unknownVector.size( ); j++ ){
+
+            dXdF[ j ][ i ] = ( ( *hydrap.getUnknownVector( ) )[ j ] - ( *hydram.getUnknownVector( ) )[ j ] ) / ( 2 * deltas[ i ] );
+
+        }
+
+    }
+
+    for ( unsigned int i = 0; i < 1; i++ ){
+
+        floatType delta = eps * std::fabs( temperature ) + eps;
+
+        hydraBaseMock hydrap( time, deltaTime, temperature + delta, previousTemperature, deformationGradient, previousDeformationGradient,
+                              previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+        hydraBaseMock hydram( time, deltaTime, temperature - delta, previousTemperature, deformationGradient, previousDeformationGradient,
+                              previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+        hydrap.evaluate( );
+
+        hydram.evaluate( );
+
+        for ( unsigned int j = 0; j < unknownVector.size( ); j++ ){
+
+            dXdT[ j ] = ( ( *hydrap.getUnknownVector( ) )[ j ] - ( *hydram.getUnknownVector( ) )[ j ] ) / ( 2 * delta );
+
+        }
+
+    }
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dXdF, hydra.getdXdF( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dXdT, *hydra.getdXdT( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( dXdT.begin( ), dXdT.begin( ) + 9 ), *hydra.getdCauchyStressdT( ) ) );
+
+    // The factorization of the consistent tangent is not counted as a factorization of the iterations
+    BOOST_CHECK( *hydra.getNumJacobianFactorizations( ) == numJacobianFactorizations );
+
+    BOOST_CHECK( *hydra.getNumTangentFactorizations( ) == 1 );
+
+    // The thermal configuration is condensed out of the factored jacobian
+    BOOST_CHECK( hydra.getJacobianFactorization( )->getNumCondensedUnknowns( ) == 9 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_hydraBase_thermoElasticSymmetricCauchyStress ){
+    /*!
+     * Test that solving for the symmetric components of the Cauchy stress gives the same solution and total
+     * derivatives as solving for all of the components
+     */
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector elasticityParameters = { 123.4, 56.7 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 1e-8, 2e-8, 3e-8, 4e-8, 5e-8, 6e-8 };
+
+            tardigradeHydra::linearElasticity::residual elasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+
+            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+
+                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+
+            }
+
+        private:
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 2 );
+
+                elasticity = tardigradeHydra::linearElasticity::residual( this, 9, elasticityParameters );
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 1, thermalParameters );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &thermalExpansion;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    floatType temperature = 300.0;
+
+    floatType previousTemperature = 320.4;
+
+    floatVector deformationGradient = { 1.05, 0.02, 0.00,
+                                        0.01, 0.98, 0.03,
+                                        0.00, 0.10, 1.01 };
+
+    floatVector previousDeformationGradient = { 1.0, 0.0, 0.0,
+                                                0.0, 1.0, 0.0,
+                                                0.0, 0.0, 1.0 };
+
+    floatVector previousStateVariables = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+    floatVector parameters = { };
+
+    unsigned int numConfigurations = 2;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    hydraBaseMock full( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                        previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    hydraBaseMock symmetric( time, deltaTime, temperature, previousTemperature, deformationGradient, previousDeformationGradient,
+                             previousStateVariables, parameters, numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    BOOST_CHECK( !( *symmetric.getSymmetricCauchyStress( ) ) );
+
+    symmetric.setSymmetricCauchyStress( true );
+
+    BOOST_CHECK( *symmetric.getSymmetricCauchyStress( ) );
+
+    BOOST_CHECK_NO_THROW( full.evaluate( ) );
+
+    BOOST_CHECK_NO_THROW( symmetric.evaluate( ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *full.getUnknownVector( ), *symmetric.getUnknownVector( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( full.getdXdF( ), symmetric.getdXdF( ) ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( *full.getdXdT( ), *symmetric.getdXdT( ) ) );
+
+    // The stress unknowns are reduced and the thermal configuration is condensed out of the factored jacobian
+    BOOST_CHECK( !full.getJacobianFactorization( )->usesSymmetricStress( ) );
+
+    BOOST_CHECK( symmetric.getJacobianFactorization( )->usesSymmetricStress( ) );
+
+    BOOST_CHECK( symmetric.getJacobianFactorization( )->getNumCondensedUnknowns( ) == 9 );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_materialPointBatch_evaluate ){
+    /*!
+     * Test the evaluation of a thermo-elastic model at a batch of material points
+     */
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector elasticityParameters = { 123.4, 56.7 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 1e-8, 2e-8, 3e-8, 4e-8, 5e-8, 6e-8 };
+
+            tardigradeHydra::linearElasticity::residual elasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+
+            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+
+                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+
+            }
+
+        private:
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 2 );
+
+                elasticity = tardigradeHydra::linearElasticity::residual( this, 9, elasticityParameters );
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 1, thermalParameters );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &thermalExpansion;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    const unsigned int numPoints = 3;
+
+    floatVector temperature = { 300.0, 310.0, 290.0 };
+
+    floatVector previousTemperature = { 320.4, 300.0, 295.0 };
+
+    floatMatrix deformationGradient = { { 1.05, 0.02, 0.00, 0.01, 0.98, 0.03, 0.00, 0.10, 1.01 },
+                                        { 0.97, 0.00, 0.04, 0.02, 1.03, 0.00, 0.01, 0.00, 0.99 },
+                                        { 1.00, 0.05, 0.00, 0.00, 1.00, 0.00, 0.02, 0.00, 1.02 } };
+
+    floatMatrix previousDeformationGradient = { { 1.00, 0.00, 0.00, 0.00, 1.00, 0.00, 0.00, 0.00, 1.00 },
+                                                { 0.99, 0.00, 0.01, 0.00, 1.01, 0.00, 0.00, 0.00, 1.00 },
+                                                { 1.00, 0.02, 0.00, 0.00, 1.00, 0.00, 0.01, 0.00, 1.01 } };
+
+    floatMatrix previousStateVariables = { { 0, 0, 0, 0, 0, 0, 0, 0, 0 },
+                                           { 1e-3, 0, 0, 0, 2e-3, 0, 0, 0, 3e-3 },
+                                           { -1e-3, 0, 0, 0, -1e-3, 0, 0, 0, -1e-3 } };
+
+    floatVector parameters = { };
+
+    unsigned int numConfigurations = 2;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    // Transpose the inputs into structures of arrays
+    floatVector F( 9 * numPoints ), Fn( 9 * numPoints ), ISVs( 9 * numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            F[ numPoints * i + p ] = deformationGradient[ p ][ i ];
+
+            Fn[ numPoints * i + p ] = previousDeformationGradient[ p ][ i ];
+
+            ISVs[ numPoints * i + p ] = previousStateVariables[ p ][ i ];
+
+        }
+
+    }
+
+    floatVector cauchyStress( 9 * numPoints ), stateVariables( 9 * numPoints ), dCauchyStressdF( 81 * numPoints ), dCauchyStressdT( 9 * numPoints );
+
+    floatVector eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    hydraBaseMock hydra( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( 9, 0 ), parameters,
+                         numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    tardigradeHydra::materialPointBatch batch( &hydra );
+
+    BOOST_CHECK_NO_THROW( batch.evaluate( numPoints, time, deltaTime, temperature.data( ), previousTemperature.data( ),
+                                          F.data( ), Fn.data( ), ISVs.data( ),
+                                          cauchyStress.data( ), stateVariables.data( ), dCauchyStressdF.data( ), dCauchyStressdT.data( ) ) );
+
+    BOOST_CHECK( *batch.getNumEvaluatedPoints( ) == numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        hydraBaseMock single( time, deltaTime, temperature[ p ], previousTemperature[ p ], deformationGradient[ p ], previousDeformationGradient[ p ],
+                              previousStateVariables[ p ], parameters, numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+        single.evaluate( );
+
+        floatVector stressAnswer( single.getUnknownVector( )->begin( ), single.getUnknownVector( )->begin( ) + 9 );
+
+        floatVector stateVariableAnswer( 9 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            // The thermal configuration is stored as F - I
+            stateVariableAnswer[ i ] = ( *single.getUnknownVector( ) )[ 9 + i ] - eye[ i ];
+
+        }
+
+        floatVector tangentAnswer = tardigradeVectorTools::appendVectors( *single.getdCauchyStressdF( ) );
+
+        floatVector stressResult( 9 ), stateVariableResult( 9 ), dCauchyStressdTResult( 9 ), tangentResult( 81 );
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            stressResult[ i ] = cauchyStress[ numPoints * i + p ];
+
+            stateVariableResult[ i ] = stateVariables[ numPoints * i + p ];
+
+            dCauchyStressdTResult[ i ] = dCauchyStressdT[ numPoints * i + p ];
+
+        }
+
+        for ( unsigned int i = 0; i < 81; i++ ){
+
+            tangentResult[ i ] = dCauchyStressdF[ numPoints * i + p ];
+
+        }
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( stressResult, stressAnswer ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( stateVariableResult, stateVariableAnswer ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( stateVariableResult, *single.getUpdatedStateVariables( ) ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( tangentResult, tangentAnswer ) );
+
+        BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dCauchyStressdTResult, *single.getdCauchyStressdT( ) ) );
+
+    }
+
+}
+
+BOOST_AUTO_TEST_CASE( test_parallelMaterialPointBatch_evaluate ){
+    /*!
+     * Test the evaluation of a thermo-elastic model at a batch of material points using multiple threads
+     */
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector elasticityParameters = { 123.4, 56.7 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 1e-8, 2e-8, 3e-8, 4e-8, 5e-8, 6e-8 };
+
+            tardigradeHydra::linearElasticity::residual elasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+
+            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+
+                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+
+            }
+
+        private:
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 2 );
+
+                elasticity = tardigradeHydra::linearElasticity::residual( this, 9, elasticityParameters );
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 1, thermalParameters );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &thermalExpansion;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    const unsigned int numPoints = 23;
+
+    floatVector parameters = { };
+
+    unsigned int numConfigurations = 2;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    floatVector eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    // Build structures of arrays with a different loading at each point
+    floatVector temperature( numPoints ), previousTemperature( numPoints );
+
+    floatVector F( 9 * numPoints ), Fn( 9 * numPoints ), ISVs( 9 * numPoints );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        temperature[ p ] = 290.0 + p;
+
+        previousTemperature[ p ] = 300.0 - 0.5 * p;
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            F[ numPoints * i + p ] = eye[ i ] + 0.002 * ( ( 3 * p + 5 * i ) % 7 ) - 0.006;
+
+            Fn[ numPoints * i + p ] = eye[ i ] + 0.001 * ( ( p + 2 * i ) % 5 );
+
+            ISVs[ numPoints * i + p ] = ( i % 4 == 0 ) ? 1e-4 * ( p % 3 ) : 0;
+
+        }
+
+    }
+
+    floatVector cauchyStressAnswer( 9 * numPoints ), stateVariablesAnswer( 9 * numPoints ), dCauchyStressdFAnswer( 81 * numPoints ), dCauchyStressdTAnswer( 9 * numPoints );
+
+    floatVector cauchyStress( 9 * numPoints ), stateVariables( 9 * numPoints ), dCauchyStressdF( 81 * numPoints ), dCauchyStressdT( 9 * numPoints );
+
+    hydraBaseMock hydra( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( 9, 0 ), parameters,
+                         numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    tardigradeHydra::materialPointBatch batch( &hydra );
+
+    BOOST_CHECK_NO_THROW( batch.evaluate( numPoints, time, deltaTime, temperature.data( ), previousTemperature.data( ),
+                                          F.data( ), Fn.data( ), ISVs.data( ),
+                                          cauchyStressAnswer.data( ), stateVariablesAnswer.data( ), dCauchyStressdFAnswer.data( ), dCauchyStressdTAnswer.data( ) ) );
+
+    // Each thread requires its own hydra object
+    hydraBaseMock hydra0( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( 9, 0 ), parameters,
+                          numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    hydraBaseMock hydra1( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( 9, 0 ), parameters,
+                          numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    hydraBaseMock hydra2( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( 9, 0 ), parameters,
+                          numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    std::vector< tardigradeHydra::hydraBase* > hydraPointers = { &hydra0, &hydra1, &hydra2 };
+
+    tardigradeHydra::parallelMaterialPointBatch parallelBatch( hydraPointers );
+
+    BOOST_CHECK( parallelBatch.getNumThreads( ) == 3 );
+
+    BOOST_CHECK_THROW( parallelBatch.setGrainSize( 0 ), std::nested_exception );
+
+    parallelBatch.setGrainSize( 2 );
+
+    BOOST_CHECK( *parallelBatch.getGrainSize( ) == 2 );
+
+    tardigradeHydra::materialPointBuffers buffers = { numPoints, time, deltaTime, temperature.data( ), previousTemperature.data( ),
+                                                      F.data( ), Fn.data( ), ISVs.data( ),
+                                                      cauchyStress.data( ), stateVariables.data( ), dCauchyStressdF.data( ), dCauchyStressdT.data( ) };
+
+    BOOST_CHECK_NO_THROW( parallelBatch.evaluate( buffers ) );
+
+    BOOST_CHECK( *parallelBatch.getFailedPoint( ) == numPoints );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( cauchyStress, cauchyStressAnswer ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( stateVariables, stateVariablesAnswer ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dCauchyStressdF, dCauchyStressdFAnswer ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( dCauchyStressdT, dCauchyStressdTAnswer ) );
+
+    // The tangents are optional
+    buffers.dCauchyStressdF = NULL;
+
+    buffers.dCauchyStressdT = NULL;
+
+    std::fill( cauchyStress.begin( ), cauchyStress.end( ), 0 );
+
+    BOOST_CHECK_NO_THROW( parallelBatch.evaluate( buffers ) );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( cauchyStress, cauchyStressAnswer ) );
+
+    BOOST_CHECK_THROW( tardigradeHydra::parallelMaterialPointBatch( { } ), std::nested_exception );
+
+}
+
+BOOST_AUTO_TEST_CASE( test_parallelMaterialPointBatch_failedPoint ){
+    /*!
+     * Test that the failure of a point in a parallel batch is reported and that the worker threads can evaluate
+     * further batches afterwards
+     */
+
+    class hydraBaseMock : public tardigradeHydra::hydraBase {
+
+        public:
+
+            using tardigradeHydra::hydraBase::hydraBase;
+
+            floatVector elasticityParameters = { 123.4, 56.7 };
+
+            floatVector thermalParameters = { 293.15, 1e-5, 2e-5, 3e-5, 4e-5, 5e-5, 6e-5, 1e-8, 2e-8, 3e-8, 4e-8, 5e-8, 6e-8 };
+
+            tardigradeHydra::linearElasticity::residual elasticity;
+
+            tardigradeHydra::thermalExpansion::residual thermalExpansion;
+
+            floatType failingTemperature = -1;
+
+            void setResidualClasses( std::vector< tardigradeHydra::residualBase* > &residuals ){
+
+                tardigradeHydra::hydraBase::setResidualClasses( residuals );
+
+            }
+
+            virtual void evaluate( ) override {
+
+                if ( *getTemperature( ) == failingTemperature ){
+
+                    TARDIGRADE_ERROR_TOOLS_CATCH( throw std::runtime_error( "The point failed" ) );
+
+                }
+
+                tardigradeHydra::hydraBase::evaluate( );
+
+            }
+
+        private:
+
+            virtual void setResidualClasses( ){
+
+                std::vector< tardigradeHydra::residualBase* > residuals( 2 );
+
+                elasticity = tardigradeHydra::linearElasticity::residual( this, 9, elasticityParameters );
+
+                thermalExpansion = tardigradeHydra::thermalExpansion::residual( this, 9, 1, thermalParameters );
+
+                residuals[ 0 ] = &elasticity;
+
+                residuals[ 1 ] = &thermalExpansion;
+
+                setResidualClasses( residuals );
+
+            }
+
+    };
+
+    floatType time = 1.1;
+
+    floatType deltaTime = 2.2;
+
+    const unsigned int numPoints = 23;
+
+    const unsigned int failedPoint = 11;
+
+    floatVector parameters = { };
+
+    unsigned int numConfigurations = 2;
+
+    unsigned int numNonLinearSolveStateVariables = 0;
+
+    unsigned int dimension = 3;
+
+    floatVector eye = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector temperature( numPoints ), previousTemperature( numPoints );
+
+    floatVector F( 9 * numPoints ), Fn( 9 * numPoints ), ISVs( 9 * numPoints, 0 );
+
+    for ( unsigned int p = 0; p < numPoints; p++ ){
+
+        temperature[ p ] = 290.0 + p;
+
+        previousTemperature[ p ] = 300.0 - 0.5 * p;
+
+        for ( unsigned int i = 0; i < 9; i++ ){
+
+            F[ numPoints * i + p ] = eye[ i ] + 0.002 * ( ( 3 * p + 5 * i ) % 7 ) - 0.006;
+
+            Fn[ numPoints * i + p ] = eye[ i ];
+
+        }
+
+    }
+
+    floatVector cauchyStress( 9 * numPoints ), stateVariables( 9 * numPoints );
+
+    hydraBaseMock hydra0( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( 9, 0 ), parameters,
+                          numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    hydraBaseMock hydra1( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( 9, 0 ), parameters,
+                          numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    hydraBaseMock hydra2( time, deltaTime, 293.15, 293.15, eye, eye, floatVector( 9, 0 ), parameters,
+                          numConfigurations, numNonLinearSolveStateVariables, dimension, 1e-12, 1e-12 );
+
+    std::vector< hydraBaseMock* > hydras = { &hydra0, &hydra1, &hydra2 };
+
+    for ( auto h = hydras.begin( ); h != hydras.end( ); h++ ){
+
+        ( *h )->failingTemperature = temperature[ failedPoint ];
+
+    }
+
+    std::vector< tardigradeHydra::hydraBase* > hydraPointers = { &hydra0, &hydra1, &hydra2 };
+
+    tardigradeHydra::parallelMaterialPointBatch parallelBatch( hydraPointers );
+
+    parallelBatch.setGrainSize( 2 );
+
+    tardigradeHydra::materialPointBuffers buffers = { numPoints, time, deltaTime, temperature.data( ), previousTemperature.data( ),
+                                                      F.data( ), Fn.data( ), ISVs.data( ),
+                                                      cauchyStress.data( ), stateVariables.data( ), NULL, NULL };
+
+    BOOST_CHECK_THROW( parallelBatch.evaluate( buffers ), std::nested_exception );
+
+    BOOST_CHECK( *parallelBatch.getFailedPoint( ) == failedPoint );
+
+    // The workers are still available once the point no longer fails
+    for ( auto h = hydras.begin( ); h != hydras.end( ); h++ ){
+
+        ( *h )->failingTemperature = -1;
+
+    }
+
+    BOOST_CHECK_NO_THROW( parallelBatch.evaluate( buffers ) );
+
+    BOOST_CHECK( *parallelBatch.getFailedPoint( ) == numPoints );
+
+}
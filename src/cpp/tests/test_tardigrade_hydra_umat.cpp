@@ -0,0 +1,108 @@
+/**
+  * \file test_tardigrade-hydra_umat.cpp
+  *
+  * Tests for the tardigrade-hydra Abaqus UMAT
+  */
+
+#include<tardigrade_hydra_umat.h>
+
+#define BOOST_TEST_MODULE test_tardigrade-hydra_umat
+#include <boost/test/included/unit_test.hpp>
+#include <boost/test/tools/output_test_stream.hpp>
+
+typedef tardigradeHydra::floatType floatType; //!< Redefinition of the floating point type
+typedef tardigradeHydra::floatVector floatVector; //!< Redefinition of the vector of floating points type
+typedef tardigradeHydra::floatMatrix floatMatrix; //!< Redefinition of the matrix of floating points type
+
+extern "C" void umat_( double *STRESS,       double *STATEV,       double *DDSDDE,       double &SSE,          double &SPD,
+                       double &SCD,          double &RPL,          double *DDSDDT,       double *DRPLDE,       double &DRPLDT,
+                       const double *STRAN,  const double *DSTRAN, const double *TIME,   const double &DTIME,  const double &TEMP,
+                       const double &DTEMP,  const double *PREDEF, const double *DPRED,  const char *CMNAME,   const int &NDI,
+                       const int &NSHR,      const int &NTENS,     const int &NSTATEV,    const double *PROPS,  const int &NPROPS,
+                       const double *COORDS, const double *DROT,   double &PNEWDT,       const double &CELENT, const double *DFGRD0,
+                       const double *DFGRD1, const int &NOEL,      const int &NPT,       const int &LAYER,     const int &KSPT,
+                       const int *JSTEP,     const int &KINC );
+
+BOOST_AUTO_TEST_CASE( test_umat_linearElastic ){
+    /*!
+     * Test that the UMAT evaluates the linear elastic material it registers
+     */
+
+    // Fortran pads the material name with spaces
+    char CMNAME[ 81 ];
+
+    std::fill( CMNAME, CMNAME + 80, ' ' );
+
+    CMNAME[ 80 ] = '\0';
+
+    std::copy( tardigradeHydra::umat::linearElasticMaterialName.begin( ), tardigradeHydra::umat::linearElasticMaterialName.end( ), CMNAME );
+
+    int NDI = 3, NSHR = 3, NTENS = 6, NSTATV = 1, NPROPS = 2;
+
+    int NOEL = 1, NPT = 1, LAYER = 1, KSPT = 1, KINC = 1;
+
+    int JSTEP[ 4 ] = { 1, 1, 1, 0 };
+
+    double SSE = 0, SPD = 0, SCD = 0, RPL = 0, DRPLDT = 0, CELENT = 1;
+
+    double TIME[ 2 ] = { 0.1, 1.1 };
+
+    double DTIME = 0.2, TEMP = 293.15, DTEMP = 1.5, PNEWDT = 1.;
+
+    double PROPS[ 2 ] = { 123.4, 56.7 };
+
+    double STATEV[ 1 ] = { 3.4 };
+
+    double STRESS[ 6 ] = { 0, 0, 0, 0, 0, 0 };
+
+    double DDSDDE[ 36 ], DDSDDT[ 6 ], DRPLDE[ 6 ];
+
+    double STRAN[ 6 ], DSTRAN[ 6 ], PREDEF[ 1 ], DPRED[ 1 ], COORDS[ 3 ], DROT[ 9 ];
+
+    double DFGRD0[ 9 ] = { 1, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+    floatVector deformationGradient = { 1.01, 0.02, 0.00,
+                                        0.00, 0.99, 0.01,
+                                        0.03, 0.00, 1.02 };
+
+    double DFGRD1[ 9 ];
+
+    for ( unsigned int i = 0; i < 3; i++ ){
+
+        for ( unsigned int j = 0; j < 3; j++ ){
+
+            DFGRD1[ i + 3 * j ] = deformationGradient[ 3 * i + j ];
+
+        }
+
+    }
+
+    floatVector previousStateVariables( STATEV, STATEV + NSTATV );
+
+    tardigradeHydra::umat::linearElasticHydra hydra( TIME[ 1 ] + DTIME, DTIME, TEMP + DTEMP, TEMP, deformationGradient, floatVector( DFGRD0, DFGRD0 + 9 ),
+                                                     previousStateVariables, floatVector( PROPS, PROPS + NPROPS ), 1, 0 );
+
+    hydra.evaluate( );
+
+    const floatVector *cauchyStress = hydra.getCauchyStress( );
+
+    floatVector stressAnswer = { ( *cauchyStress )[ 0 ], ( *cauchyStress )[ 4 ], ( *cauchyStress )[ 8 ],
+                                 ( *cauchyStress )[ 1 ], ( *cauchyStress )[ 2 ], ( *cauchyStress )[ 5 ] };
+
+    umat_( STRESS, STATEV, DDSDDE, SSE,    SPD,
+           SCD,    RPL,    DDSDDT, DRPLDE, DRPLDT,
+           STRAN,  DSTRAN, TIME,   DTIME,  TEMP,
+           DTEMP,  PREDEF, DPRED,  CMNAME, NDI,
+           NSHR,   NTENS,  NSTATV, PROPS,  NPROPS,
+           COORDS, DROT,   PNEWDT, CELENT, DFGRD0,
+           DFGRD1, NOEL,   NPT,    LAYER,  KSPT,
+           JSTEP,  KINC );
+
+    BOOST_TEST( PNEWDT == 1. );
+
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( STRESS, STRESS + 6 ), stressAnswer ) );
+
+    // The state variables of the linear elastic material are passed through unchanged
+    BOOST_CHECK( tardigradeVectorTools::fuzzyEquals( floatVector( STATEV, STATEV + NSTATV ), previousStateVariables ) );
+
+}